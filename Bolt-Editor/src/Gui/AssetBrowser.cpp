@@ -45,9 +45,12 @@ namespace Bolt {
 		m_CurrentDirectory = rootDirectory;
 		m_Thumbnails.Initialize();
 		m_NeedsRefresh = true;
+		// Info: Only files the registry gives a kind are watched, other files show up on the next navigation or manual refresh
+		m_Watcher.Watch(std::vector<std::string>{ rootDirectory }, AssetRegistry::GetKnownExtensions(), [this](const std::vector<FileChangeEvent>& events) { OnFilesChanged(events); });
 	}
 
 	void AssetBrowser::Shutdown() {
+		m_Watcher.Stop();
 		m_Thumbnails.Shutdown();
 	}
 
@@ -76,6 +79,20 @@ namespace Bolt {
 		m_NeedsRefresh = false;
 	}
 
+	void AssetBrowser::OnFilesChanged(const std::vector<FileChangeEvent>& events) {
+		for (const FileChangeEvent& event : events) {
+			AssetRegistry::NotifyAssetChanged(event.Path);
+			if (event.Type != FileChangeType::Added) {
+				m_Thumbnails.Invalidate(event.Path);
+			}
+			if (!event.OldPath.empty()) {
+				AssetRegistry::NotifyAssetChanged(event.OldPath);
+				m_Thumbnails.Invalidate(event.OldPath);
+			}
+		}
+		m_NeedsRefresh = true;
+	}
+
 	void AssetBrowser::Render() {
 		m_SelectionActivated = false;
 
@@ -108,6 +125,7 @@ namespace Bolt {
 
 		ImGui::Begin("Project");
 
+		m_Watcher.Poll(k_WatcherPollIntervalSeconds);
 		if (m_NeedsRefresh) {
 			Refresh();
 		}
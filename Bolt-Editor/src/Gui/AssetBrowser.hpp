@@ -1,6 +1,7 @@
 #pragma once
 #include "Gui/ThumbnailCache.hpp"
 #include "Serialization/Directory.hpp"
+#include "Serialization/FileWatcher.hpp"
 #include <string>
 #include <vector>
 
@@ -36,6 +37,7 @@ namespace Bolt {
 		void NavigateTo(const std::string& directory);
 		void NavigateUp();
 		void Refresh();
+		void OnFilesChanged(const std::vector<FileChangeEvent>& events);
 
 		void RenderBreadcrumb();
 		void RenderGrid();
@@ -86,6 +88,11 @@ namespace Bolt {
 
 		ThumbnailCache m_Thumbnails;
 
+		// Changes made outside the browser (IDE, file manager, VCS) feed the asset registry and the listing
+		FileWatcher m_Watcher;
+		// Info: Only throttles the full-tree rescan used where native notifications are unavailable, native events drain every frame
+		static constexpr float k_WatcherPollIntervalSeconds = 10.0f;
+
 		// Pending OS file drops — set externally, consumed in Render()
 		std::vector<std::string> m_PendingExternalDrops;
 	};
@@ -9,6 +9,7 @@
 #include "Graphics/Texture2D.hpp"
 #include "Audio/AudioManager.hpp"
 #include "Physics/PhysicsTypes.hpp"
+#include "Physics/CollisionLayers2D.hpp"
 #include <Project/ProjectManager.hpp>
 #include <Project/BoltProject.hpp>
 #include "Scene/SceneManager.hpp"
@@ -357,9 +358,14 @@ namespace Bolt {
 	void DrawTransform2DInspector(Entity entity)
 	{
 		auto& transform = entity.GetComponent<Transform2DComponent>();
-		ImGui::DragFloat2("Position", &transform.Position.x, 0.05f);
-		ImGui::DragFloat2("Scale", &transform.Scale.x, 0.05f, 0.001f);
-		ImGui::DragFloat("Rotation", &transform.Rotation, 0.01f);
+		bool changed = ImGui::DragFloat2("Position", &transform.Position.x, 0.05f);
+		changed |= ImGui::DragFloat2("Scale", &transform.Scale.x, 0.05f, 0.001f);
+		changed |= ImGui::DragFloat("Rotation", &transform.Rotation, 0.01f);
+
+		Scene* scene = SceneManager::Get().GetActiveScene();
+		if (changed && scene && scene->IsValid(entity.GetHandle())) {
+			scene->NotifyTransformChanged(entity.GetHandle());
+		}
 	}
 
 	void DrawRigidbody2DInspector(Entity entity)
@@ -386,6 +392,10 @@ namespace Bolt {
 		ImGuiUtils::DrawEnumCombo<BodyType>("Body Type", rb2D.GetBodyType(), [&rb2D](BodyType newType) {
 			rb2D.SetBodyType(newType);
 			});
+
+		ImGuiUtils::DrawEnumCombo<InterpolationMode>("Interpolation", rb2D.GetInterpolation(), [&rb2D](InterpolationMode mode) {
+			rb2D.SetInterpolation(mode);
+			});
 	}
 
 	void DrawSpriteRendererInspector(Entity entity)
@@ -496,6 +506,11 @@ namespace Bolt {
 		if (ImGui::RadioButton("Random Colors", ps.ParticleSettings.UseRandomColors))
 			ps.ParticleSettings.UseRandomColors = !ps.ParticleSettings.UseRandomColors;
 
+		int simulation = static_cast<int>(ps.ParticleSettings.Simulation);
+		const char* simulationModes[] = { "CPU", "GPU" };
+		if (ImGui::Combo("Simulation", &simulation, simulationModes, 2))
+			ps.ParticleSettings.Simulation = static_cast<ParticleSystem2DComponent::SimulationMode>(simulation);
+
 		if (ImGui::CollapsingHeader("Emission", ImGuiTreeNodeFlags_DefaultOpen)) {
 			ImGui::PushID("Emission");
 			ImGui::InputInt("Emit Over Time", (int*)&ps.EmissionSettings.EmitOverTime);
@@ -601,9 +616,18 @@ namespace Bolt {
 			collider.SetBounciness(bounciness);
 		}
 
-		uint64_t layerMask = collider.GetLayer();
-		if (ImGui::InputScalar("Layer Mask", ImGuiDataType_U64, &layerMask)) {
-			collider.SetLayer(layerMask);
+		const int layer = collider.GetLayer();
+		if (ImGui::BeginCombo("Layer", CollisionLayers2D::GetLayerName(layer).c_str())) {
+			const int layerCount = CollisionLayers2D::GetLayerCount();
+			for (int i = 0; i < layerCount; i++) {
+				const std::string layerName = CollisionLayers2D::GetLayerName(i);
+				ImGui::PushID(i);
+				if (ImGui::Selectable(layerName.c_str(), i == layer)) {
+					collider.SetLayer(i);
+				}
+				ImGui::PopID();
+			}
+			ImGui::EndCombo();
 		}
 
 		ImGuiUtils::DrawVec2ReadOnly("Local Size", localSize);
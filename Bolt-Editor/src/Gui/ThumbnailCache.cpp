@@ -2,6 +2,7 @@
 #include "Gui/ThumbnailCache.hpp"
 #include <imgui.h>
 #include <algorithm>
+#include <chrono>
 
 namespace Bolt {
 
@@ -16,6 +17,9 @@ namespace Bolt {
 	unsigned int ThumbnailCache::GetThumbnail(const std::string& absolutePath) {
 		auto it = m_Cache.find(absolutePath);
 		if (it != m_Cache.end()) {
+			if (it->second.Pending) {
+				TryUpload(it->second);
+			}
 			return it->second.GlHandle;
 		}
 
@@ -27,25 +31,36 @@ namespace Bolt {
 			return 0;
 		}
 
-		auto tex = std::make_unique<Texture2D>(
-			absolutePath.c_str(),
-			Filter::Bilinear,
-			Wrap::Clamp,
-			Wrap::Clamp,
-			false,   // no mipmaps for thumbnails
-			false,
-			true
-		);
-
-		if (!tex->IsValid()) {
-			// Cache a null entry so we don't retry
-			m_Cache[absolutePath] = { nullptr, 0 };
-			return 0;
+		m_Cache[absolutePath].Pending = TextureDecodeJob::Start(absolutePath);
+		return 0;
+	}
+
+	void ThumbnailCache::TryUpload(CachedThumbnail& thumbnail) {
+		if (!thumbnail.Pending->IsDone()) {
+			return;
+		}
+
+		const int frame = ImGui::GetFrameCount();
+		if (frame != m_UploadFrame) {
+			m_UploadFrame = frame;
+			m_UploadTimeMs = 0.0f;
+		}
+		if (m_UploadTimeMs >= k_UploadBudgetMs) {
+			return;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		auto tex = std::make_unique<Texture2D>();
+		tex->SetSampler(Filter::Bilinear, Wrap::Clamp, Wrap::Clamp);
+		// No mipmaps for thumbnails, a failed decode keeps the null entry so we don't retry
+		if (thumbnail.Pending->Succeeded && tex->Create(thumbnail.Pending->Image, false)) {
+			thumbnail.GlHandle = tex->GetHandle();
+			thumbnail.Texture = std::move(tex);
 		}
+		thumbnail.Pending.reset();
 
-		unsigned int handle = tex->GetHandle();
-		m_Cache[absolutePath] = { std::move(tex), handle };
-		return handle;
+		m_UploadTimeMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
 	}
 
 	Texture2D* ThumbnailCache::GetCacheEntry(const std::string& absolutePath) {
@@ -1,5 +1,6 @@
 #pragma once
 #include "Graphics/Texture2D.hpp"
+#include "Graphics/TextureDecodeJob.hpp"
 #include "Gui/AssetType.hpp"
 
 #include <imgui.h>
@@ -16,7 +17,8 @@ namespace Bolt {
 		void Shutdown();
 
 		// Returns the OpenGL texture ID for the given asset, or 0 if none.
-		// For image files, loads and caches the actual image as a thumbnail.
+		// For image files, decodes the image on a background worker and caches it as a thumbnail,
+		// 0 is returned until it has been uploaded.
 		// For other types, returns 0 (caller should use DrawAssetIcon instead).
 		unsigned int GetThumbnail(const std::string& absolutePath);
 
@@ -43,9 +45,17 @@ namespace Bolt {
 		struct CachedThumbnail {
 			std::unique_ptr<Texture2D> Texture;
 			unsigned int GlHandle = 0;
+			std::shared_ptr<TextureDecodeJob> Pending;
 		};
 
+		void TryUpload(CachedThumbnail& thumbnail);
+
+		// Uploads share a per-frame time budget so scrolling into a folder of large images doesn't stall the editor
+		static constexpr float k_UploadBudgetMs = 2.0f;
+
 		std::unordered_map<std::string, CachedThumbnail> m_Cache;
+		int m_UploadFrame = -1;
+		float m_UploadTimeMs = 0.0f;
 	};
 
 } // namespace Bolt
@@ -177,20 +177,16 @@ namespace Bolt {
 					return;
 				}
 
-				auto view = scene.GetRegistry().view<UUIDComponent>();
-				for (EntityHandle entityHandle : view) {
-					const auto& uuidComponent = view.get<UUIDComponent>(entityHandle);
-					if (static_cast<uint64_t>(uuidComponent.Id) != entityId) {
-						continue;
-					}
-
-					resolved = SceneEntityReference{
-						entityId,
-						GetEntityName(scene, entityHandle, entityId),
-						scene.GetName()
-					};
+				const EntityHandle entityHandle = scene.FindEntityByUUID(entityId);
+				if (entityHandle == entt::null) {
 					return;
 				}
+
+				resolved = SceneEntityReference{
+					entityId,
+					GetEntityName(scene, entityHandle, entityId),
+					scene.GetName()
+				};
 			});
 
 			return resolved;
@@ -361,12 +361,9 @@ namespace Bolt {
 			return;
 		}
 
-		auto view = active->GetRegistry().view<UUIDComponent>();
-		for (auto [ent, uuid] : view.each()) {
-			if (static_cast<uint64_t>(uuid.Id) == selectedUUID) {
-				m_SelectedEntity = ent;
-				break;
-			}
+		const EntityHandle selected = active->FindEntityByUUID(selectedUUID);
+		if (selected != entt::null) {
+			m_SelectedEntity = selected;
 		}
 	}
 
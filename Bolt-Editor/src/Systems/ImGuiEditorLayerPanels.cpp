@@ -10,6 +10,7 @@
 #include "Gui/ImGuiUtils.hpp"
 #include "Packages/GitHubSource.hpp"
 #include "Packages/NuGetSource.hpp"
+#include "Physics/CollisionLayers2D.hpp"
 #include "Project/BoltProject.hpp"
 #include "Project/ProjectManager.hpp"
 #include "Scene/Scene.hpp"
@@ -19,10 +20,12 @@
 #include "Serialization/File.hpp"
 #include "Serialization/Path.hpp"
 #include "Serialization/SceneSerializer.hpp"
+#include "Serialization/BinarySceneSerializer.hpp"
 #include "Utils/Process.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
 #include <filesystem>
 
 namespace Bolt {
@@ -58,6 +61,23 @@ namespace Bolt {
 			}
 			return copied;
 		}
+
+		// Info: Exports a .bscene next to every .scene so the player skips JSON parsing, unchanged scenes are skipped
+		int ExportBinaryScenes(const std::filesystem::path& assetsDir) {
+			int exported = 0;
+			for (auto& entry : std::filesystem::recursive_directory_iterator(assetsDir)) {
+				if (!entry.is_regular_file() || entry.path().extension() != ".scene") {
+					continue;
+				}
+
+				const std::string scenePath = entry.path().string();
+				const std::string binaryPath = BinarySceneSerializer::GetBinaryPath(scenePath);
+				if (NeedsCopy(entry.path(), binaryPath) && BinarySceneSerializer::ConvertJsonToBinary(scenePath, binaryPath)) {
+					exported++;
+				}
+			}
+			return exported;
+		}
 	}
 
 	void ImGuiEditorLayer::RenderLogPanel() {
@@ -321,6 +341,9 @@ namespace Bolt {
 		if (std::filesystem::exists(project->AssetsDirectory)) {
 			int updatedFiles = CopyDirIncremental(project->AssetsDirectory, outDir / "Assets");
 			BT_INFO_TAG("Build", "Assets: {} file(s) updated", updatedFiles);
+
+			int exportedScenes = ExportBinaryScenes(outDir / "Assets");
+			BT_INFO_TAG("Build", "Binary scenes: {} exported", exportedScenes);
 		}
 
 		{
@@ -593,6 +616,80 @@ namespace Bolt {
 			ImGui::Unindent(8);
 		}
 
+		if (ImGui::CollapsingHeader("Physics 2D", ImGuiTreeNodeFlags_DefaultOpen)) {
+			ImGui::Indent(8);
+			bool matrixChanged = false;
+			const int layerCount = static_cast<int>(project->CollisionLayers.size());
+
+			ImGui::TextDisabled("Collision Layers");
+			for (int i = 0; i < layerCount; i++) {
+				ImGui::PushID(i);
+				char nameBuf[64];
+				std::snprintf(nameBuf, sizeof(nameBuf), "%s", project->CollisionLayers[static_cast<size_t>(i)].c_str());
+				ImGui::Text("%2d", i);
+				ImGui::SameLine();
+				ImGui::SetNextItemWidth(180.0f);
+				if (ImGui::InputText("##LayerName", nameBuf, sizeof(nameBuf), ImGuiInputTextFlags_EnterReturnsTrue) && nameBuf[0] != '\0') {
+					project->CollisionLayers[static_cast<size_t>(i)] = nameBuf;
+					changed = true;
+				}
+				ImGui::PopID();
+			}
+
+			if (layerCount < BoltProject::k_MaxCollisionLayers && ImGui::Button("Add Layer")) {
+				project->CollisionLayers.push_back("Layer " + std::to_string(layerCount));
+				changed = true;
+			}
+			if (layerCount > 1) {
+				ImGui::SameLine();
+				if (ImGui::Button("Remove Last")) {
+					// Info: Reset the row so colliders still on the removed layer collide with everything until moved
+					const int removed = layerCount - 1;
+					for (int i = 0; i < layerCount; i++) {
+						project->SetLayersCollide(removed, i, true);
+					}
+					project->CollisionLayers.pop_back();
+					changed = true;
+					matrixChanged = true;
+				}
+			}
+
+			ImGui::Spacing();
+			ImGui::TextDisabled("Layer Collision Matrix");
+			const int rows = static_cast<int>(project->CollisionLayers.size());
+			if (ImGui::BeginTable("##CollisionMatrix", rows + 1, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollX)) {
+				ImGui::TableSetupColumn("");
+				for (int j = rows - 1; j >= 0; j--) {
+					ImGui::TableSetupColumn(project->CollisionLayers[static_cast<size_t>(j)].c_str());
+				}
+				ImGui::TableHeadersRow();
+
+				// Info: Triangular like the matrix itself, each pair is shown once
+				for (int i = 0; i < rows; i++) {
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(project->CollisionLayers[static_cast<size_t>(i)].c_str());
+					for (int j = rows - 1; j >= i; j--) {
+						ImGui::TableNextColumn();
+						ImGui::PushID(i * BoltProject::k_MaxCollisionLayers + j);
+						bool collide = (project->GetCollisionMask(i) & (uint32_t{ 1 } << j)) != 0;
+						if (ImGui::Checkbox("##Collide", &collide)) {
+							project->SetLayersCollide(i, j, collide);
+							changed = true;
+							matrixChanged = true;
+						}
+						ImGui::PopID();
+					}
+				}
+				ImGui::EndTable();
+			}
+
+			if (matrixChanged) {
+				CollisionLayers2D::RefreshShapeFilters();
+			}
+			ImGui::Unindent(8);
+		}
+
 		if (changed) {
 			project->Save();
 		}
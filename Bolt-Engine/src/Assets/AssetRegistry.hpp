@@ -19,6 +19,21 @@
 namespace Bolt {
 
 	class AssetRegistry {
+		struct KindExtension {
+			std::string_view Extension;
+			AssetKind Kind;
+		};
+
+		static constexpr KindExtension k_KindExtensions[] = {
+			{ ".png", AssetKind::Texture }, { ".jpg", AssetKind::Texture }, { ".jpeg", AssetKind::Texture },
+			{ ".bmp", AssetKind::Texture }, { ".tga", AssetKind::Texture },
+			{ ".wav", AssetKind::Audio }, { ".mp3", AssetKind::Audio }, { ".ogg", AssetKind::Audio }, { ".flac", AssetKind::Audio },
+			{ ".scene", AssetKind::Scene },
+			{ ".prefab", AssetKind::Prefab },
+			{ ".cs", AssetKind::Script }, { ".cpp", AssetKind::Script }, { ".c", AssetKind::Script },
+			{ ".hpp", AssetKind::Script }, { ".h", AssetKind::Script },
+		};
+
 	public:
 		struct Record {
 			uint64_t Id = 0;
@@ -28,6 +43,15 @@ namespace Bolt {
 
 		static constexpr std::string_view MetaExtension = ".meta";
 
+		// Info: Extensions with a dedicated asset kind, any other extension is indexed as AssetKind::Other
+		static std::vector<std::string> GetKnownExtensions() {
+			std::vector<std::string> extensions;
+			for (const KindExtension& entry : k_KindExtensions) {
+				extensions.emplace_back(entry.Extension);
+			}
+			return extensions;
+		}
+
 		static bool IsMetaFilePath(std::string_view path) {
 			const std::string normalized = ToLowerCopy(std::string(path));
 			const std::string metaExtension(MetaExtension);
@@ -38,10 +62,23 @@ namespace Bolt {
 			return normalized.compare(normalized.size() - metaExtension.size(), metaExtension.size(), metaExtension) == 0;
 		}
 
+		// Info: Forces a full rescan on the next query, unchanged files are still served from the persistent index
 		static void MarkDirty() {
 			s_Dirty = true;
 		}
 
+		// Info: Queues a single file or directory that was added, changed or removed, handled without a full rescan
+		static void NotifyAssetChanged(const std::string& path) {
+			std::string normalizedPath = NormalizePath(path);
+			if (IsMetaFilePath(normalizedPath)) {
+				normalizedPath.resize(normalizedPath.size() - MetaExtension.size());
+			}
+
+			if (!normalizedPath.empty() && std::find(s_PendingPaths.begin(), s_PendingPaths.end(), normalizedPath) == s_PendingPaths.end()) {
+				s_PendingPaths.push_back(std::move(normalizedPath));
+			}
+		}
+
 		static void Sync() {
 			EnsureUpToDate();
 		}
@@ -61,14 +98,8 @@ namespace Bolt {
 				return it->second;
 			}
 
-			uint64_t id = ReadMetaId(normalizedPath);
-			if (id == 0 || s_IdToRecord.contains(id)) {
-				id = static_cast<uint64_t>(UUID());
-			}
-
-			WriteMeta(normalizedPath, id, Classify(normalizedPath));
-			Register(normalizedPath, id, Classify(normalizedPath));
-			return id;
+			// The index file catches up with the next batch, a lost entry only costs one .meta read at startup
+			return IndexAsset(normalizedPath, ReadStamp(normalizedPath));
 		}
 
 		static std::string ResolvePath(uint64_t assetId) {
@@ -156,7 +187,7 @@ namespace Bolt {
 			const std::string metaPath = GetMetaPath(normalizedPath);
 			std::error_code ec;
 			std::filesystem::remove(metaPath, ec);
-			MarkDirty();
+			NotifyAssetChanged(normalizedPath);
 		}
 
 		static void MoveCompanionMetadata(const std::string& from, const std::string& to) {
@@ -166,9 +197,12 @@ namespace Bolt {
 				return;
 			}
 
+			// The source is handled first, so the destination can take over its UUID from the moved .meta
+			NotifyAssetChanged(normalizedFrom);
+			NotifyAssetChanged(normalizedTo);
+
 			const std::string metaFrom = GetMetaPath(normalizedFrom);
 			if (!File::Exists(metaFrom)) {
-				MarkDirty();
 				return;
 			}
 
@@ -189,8 +223,6 @@ namespace Bolt {
 					std::filesystem::remove(metaFrom, ec);
 				}
 			}
-
-			MarkDirty();
 		}
 
 	private:
@@ -207,29 +239,65 @@ namespace Bolt {
 			return NormalizePath(fallback);
 		}
 
+		// Info: What the index remembers about a file, any difference means its .meta has to be looked at again
+		struct FileStamp {
+			int64_t WriteTime = 0;
+			uint64_t Size = 0;
+			int64_t MetaWriteTime = 0;
+
+			bool operator==(const FileStamp&) const = default;
+		};
+
+		struct MetaInfo {
+			uint64_t Id = 0;
+			std::string Kind;
+		};
+
+		static constexpr int k_IndexVersion = 1;
+
 		static void EnsureUpToDate() {
 			const std::string root = GetAssetsRoot();
 			if (root != s_TrackedRoot) {
 				s_TrackedRoot = root;
+				s_PendingPaths.clear();
+				LoadIndex();
 				s_Dirty = true;
 			}
 
-			if (!s_Dirty) {
+			if (s_Dirty) {
+				Rebuild();
+			}
+			else if (!s_PendingPaths.empty()) {
+				ProcessPendingPaths();
+			}
+			else {
 				return;
 			}
 
-			Rebuild();
+			if (s_IndexChanged) {
+				SaveIndex();
+			}
 		}
 
+		// Info: Walks the tree but only touches .meta files of assets whose stamp differs from the index
 		static void Rebuild() {
+			auto previousRecords = std::move(s_IdToRecord);
+			auto previousPaths = std::move(s_PathToId);
+			auto previousStamps = std::move(s_Stamps);
 			s_IdToRecord.clear();
 			s_PathToId.clear();
+			s_Stamps.clear();
+			s_PendingPaths.clear();
+			s_Dirty = false;
 
 			if (s_TrackedRoot.empty() || !std::filesystem::exists(s_TrackedRoot)) {
-				s_Dirty = false;
+				s_IndexChanged = false;
 				return;
 			}
 
+			std::vector<std::pair<std::string, FileStamp>> files;
+			std::unordered_map<std::string, int64_t> metaWriteTimes;
+
 			std::error_code ec;
 			for (std::filesystem::recursive_directory_iterator it(
 				 s_TrackedRoot,
@@ -247,33 +315,285 @@ namespace Bolt {
 					continue;
 				}
 
-				const std::string assetPath = NormalizePath(it->path().string());
-				if (assetPath.empty() || IsMetaFilePath(assetPath)) {
+				// Entries are already below the canonical root, only symlinked files need the full normalization
+				std::string assetPath = it->is_symlink(ec)
+					? NormalizePath(it->path().string())
+					: it->path().lexically_normal().make_preferred().string();
+				if (assetPath.empty()) {
+					continue;
+				}
+
+				const int64_t writeTime = it->last_write_time(ec).time_since_epoch().count();
+				if (IsMetaFilePath(assetPath)) {
+					assetPath.resize(assetPath.size() - MetaExtension.size());
+					metaWriteTimes[std::move(assetPath)] = writeTime;
 					continue;
 				}
 
-				IndexAsset(assetPath);
+				FileStamp stamp;
+				stamp.WriteTime = writeTime;
+				stamp.Size = static_cast<uint64_t>(it->file_size(ec));
+				files.emplace_back(std::move(assetPath), stamp);
 			}
 
-			s_Dirty = false;
+			size_t reused = 0;
+			for (auto& [assetPath, stamp] : files) {
+				if (const auto meta = metaWriteTimes.find(assetPath); meta != metaWriteTimes.end()) {
+					stamp.MetaWriteTime = meta->second;
+				}
+
+				const auto previousPath = previousPaths.find(assetPath);
+				const auto previousStamp = previousStamps.find(assetPath);
+				if (previousPath != previousPaths.end()
+					&& previousStamp != previousStamps.end()
+					&& previousStamp->second == stamp
+					&& !s_IdToRecord.contains(previousPath->second)) {
+					const auto previousRecord = previousRecords.find(previousPath->second);
+					Register(assetPath, previousPath->second, previousRecord != previousRecords.end() ? previousRecord->second.Kind : Classify(assetPath));
+					s_Stamps[assetPath] = stamp;
+					reused++;
+					continue;
+				}
+
+				IndexAsset(assetPath, stamp);
+			}
+
+			if (reused != previousPaths.size()) {
+				s_IndexChanged = true;
+			}
 		}
 
-		static void IndexAsset(const std::string& assetPath) {
-			if (!IsTrackedAsset(assetPath)) {
+		static void ProcessPendingPaths() {
+			std::vector<std::string> pendingPaths = std::move(s_PendingPaths);
+			s_PendingPaths.clear();
+
+			std::error_code ec;
+			for (const std::string& path : pendingPaths) {
+				if (std::filesystem::is_directory(path, ec)) {
+					for (std::filesystem::recursive_directory_iterator it(path, std::filesystem::directory_options::skip_permission_denied, ec), end;
+						 it != end;
+						 it.increment(ec)) {
+						if (ec) {
+							ec.clear();
+							continue;
+						}
+
+						const std::string assetPath = NormalizePath(it->path().string());
+						if (it->is_regular_file(ec) && !IsMetaFilePath(assetPath)) {
+							RefreshAsset(assetPath);
+						}
+						ec.clear();
+					}
+					continue;
+				}
+				ec.clear();
+
+				if (IsTrackedAsset(path)) {
+					RefreshAsset(path);
+					continue;
+				}
+
+				// Gone: drop the file itself or everything below a removed directory
+				std::vector<std::string> removed;
+				for (const auto& [assetPath, id] : s_PathToId) {
+					const bool isBelow = assetPath.size() > path.size()
+						&& assetPath.compare(0, path.size(), path) == 0
+						&& (assetPath[path.size()] == '\\' || assetPath[path.size()] == '/');
+					if (assetPath == path || isBelow) {
+						removed.push_back(assetPath);
+					}
+				}
+
+				for (const std::string& assetPath : removed) {
+					Unregister(assetPath);
+				}
+			}
+		}
+
+		static void RefreshAsset(const std::string& assetPath) {
+			const FileStamp stamp = ReadStamp(assetPath);
+			if (const auto it = s_Stamps.find(assetPath); it != s_Stamps.end() && it->second == stamp && s_PathToId.contains(assetPath)) {
 				return;
 			}
 
-			AssetKind kind = Classify(assetPath);
-			uint64_t id = ReadMetaId(assetPath);
-			if (id == 0 || s_IdToRecord.contains(id)) {
+			// Dropping the old record first lets the file keep its UUID instead of reading as a duplicate
+			Unregister(assetPath);
+			IndexAsset(assetPath, stamp);
+		}
+
+		// Info: Only writes the .meta when it is missing, unreadable, a duplicate or names the wrong kind
+		static uint64_t IndexAsset(const std::string& assetPath, FileStamp stamp) {
+			const AssetKind kind = Classify(assetPath);
+			const MetaInfo meta = ReadMeta(assetPath);
+
+			uint64_t id = meta.Id;
+			const bool needsNewId = id == 0 || s_IdToRecord.contains(id);
+			if (needsNewId) {
 				id = static_cast<uint64_t>(UUID());
-				WriteMeta(assetPath, id, kind);
 			}
-			else {
+
+			if (needsNewId || meta.Kind != ToString(kind)) {
 				WriteMeta(assetPath, id, kind);
+				std::error_code ec;
+				stamp.MetaWriteTime = std::filesystem::last_write_time(GetMetaPath(assetPath), ec).time_since_epoch().count();
 			}
 
 			Register(assetPath, id, kind);
+			s_Stamps[assetPath] = stamp;
+			s_IndexChanged = true;
+			return id;
+		}
+
+		static FileStamp ReadStamp(const std::string& assetPath) {
+			FileStamp stamp;
+			std::error_code ec;
+			stamp.WriteTime = std::filesystem::last_write_time(assetPath, ec).time_since_epoch().count();
+			stamp.Size = static_cast<uint64_t>(std::filesystem::file_size(assetPath, ec));
+			ec.clear();
+
+			const auto metaWriteTime = std::filesystem::last_write_time(GetMetaPath(assetPath), ec);
+			stamp.MetaWriteTime = ec ? 0 : metaWriteTime.time_since_epoch().count();
+			return stamp;
+		}
+
+		static void Unregister(const std::string& assetPath) {
+			const auto it = s_PathToId.find(assetPath);
+			if (it == s_PathToId.end()) {
+				return;
+			}
+
+			if (const auto record = s_IdToRecord.find(it->second); record != s_IdToRecord.end() && record->second.Path == assetPath) {
+				s_IdToRecord.erase(record);
+			}
+			s_PathToId.erase(it);
+			s_Stamps.erase(assetPath);
+			s_IndexChanged = true;
+		}
+
+		// ── Persistent index ────────────────────────────────────────────
+		// <Assets>/../Library/AssetIndex.json, paths are stored relative to the Assets root
+
+		static std::string GetIndexPath() {
+			if (s_TrackedRoot.empty()) {
+				return {};
+			}
+			return (std::filesystem::path(s_TrackedRoot).parent_path() / "Library" / "AssetIndex.json").string();
+		}
+
+		static void LoadIndex() {
+			s_IdToRecord.clear();
+			s_PathToId.clear();
+			s_Stamps.clear();
+			s_IndexChanged = false;
+
+			const std::string indexPath = GetIndexPath();
+			if (indexPath.empty() || !File::Exists(indexPath)) {
+				return;
+			}
+
+			const std::string indexText = File::ReadAllText(indexPath);
+			Json::Reader reader(indexText);
+			if (reader.Next() != Json::Token::BeginObject) {
+				return;
+			}
+
+			const std::filesystem::path assetsRoot(s_TrackedRoot);
+			Json::Value entryValue;
+			while (reader.Next() == Json::Token::Key) {
+				const std::string key(reader.GetString());
+				const Json::Token token = reader.Next();
+
+				if (key == "version") {
+					if (token != Json::Token::Number || static_cast<int>(reader.GetNumber()) != k_IndexVersion) {
+						break;
+					}
+					continue;
+				}
+
+				if (key != "assets" || token != Json::Token::BeginArray) {
+					reader.SkipValue();
+					continue;
+				}
+
+				while (reader.Next() != Json::Token::EndArray) {
+					if (!reader.ReadValue(entryValue) || !entryValue.IsObject()) {
+						break;
+					}
+
+					const Json::Value* pathValue = entryValue.FindMember("path");
+					const uint64_t id = ParseUInt64(entryValue.FindMember("uuid"));
+					if (!pathValue || id == 0 || s_IdToRecord.contains(id)) {
+						continue;
+					}
+
+					const std::string assetPath = (assetsRoot / std::filesystem::path(pathValue->AsStringView())).lexically_normal().make_preferred().string();
+					FileStamp stamp;
+					stamp.WriteTime = static_cast<int64_t>(ParseUInt64(entryValue.FindMember("time")));
+					stamp.Size = ParseUInt64(entryValue.FindMember("size"));
+					stamp.MetaWriteTime = static_cast<int64_t>(ParseUInt64(entryValue.FindMember("metaTime")));
+
+					Register(assetPath, id, Classify(assetPath));
+					s_Stamps[assetPath] = stamp;
+				}
+			}
+
+			if (reader.HasError()) {
+				s_IdToRecord.clear();
+				s_PathToId.clear();
+				s_Stamps.clear();
+			}
+		}
+
+		static void SaveIndex() {
+			s_IndexChanged = false;
+			const std::string indexPath = GetIndexPath();
+			if (indexPath.empty()) {
+				return;
+			}
+
+			const std::filesystem::path assetsRoot(s_TrackedRoot);
+			Json::Value assets = Json::Value::MakeArray();
+			assets.GetArray().reserve(s_PathToId.size());
+			for (const auto& [assetPath, id] : s_PathToId) {
+				const FileStamp& stamp = s_Stamps[assetPath];
+				Json::Value entry = Json::Value::MakeObject();
+				entry.AddMember("path", Json::Value(std::filesystem::path(assetPath).lexically_relative(assetsRoot).generic_string()));
+				entry.AddMember("uuid", Json::Value(std::to_string(id)));
+				// Info: File times are stored as strings, their tick counts don't fit a double
+				entry.AddMember("time", Json::Value(std::to_string(static_cast<uint64_t>(stamp.WriteTime))));
+				entry.AddMember("size", Json::Value(std::to_string(stamp.Size)));
+				entry.AddMember("metaTime", Json::Value(std::to_string(static_cast<uint64_t>(stamp.MetaWriteTime))));
+				assets.Append(std::move(entry));
+			}
+
+			Json::Value root = Json::Value::MakeObject();
+			root.AddMember("version", Json::Value(k_IndexVersion));
+			root.AddMember("assets", std::move(assets));
+
+			try {
+				std::filesystem::create_directories(std::filesystem::path(indexPath).parent_path());
+				File::WriteAllText(indexPath, Json::Stringify(root, false));
+			}
+			catch (const std::exception&) {
+				// The index is only a cache, the next run rebuilds it from the .meta files
+			}
+		}
+
+		static uint64_t ParseUInt64(const Json::Value* value) {
+			if (!value) {
+				return 0;
+			}
+
+			if (value->IsString()) {
+				try {
+					return static_cast<uint64_t>(std::stoull(value->AsStringOr()));
+				}
+				catch (...) {
+					return 0;
+				}
+			}
+
+			return value->AsUInt64Or(0);
 		}
 
 		static void Register(const std::string& assetPath, uint64_t id, AssetKind kind) {
@@ -345,20 +665,10 @@ namespace Bolt {
 
 		static AssetKind Classify(const std::string& assetPath) {
 			const std::string extension = ToLowerCopy(std::filesystem::path(assetPath).extension().string());
-			if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".bmp" || extension == ".tga") {
-				return AssetKind::Texture;
-			}
-			if (extension == ".wav" || extension == ".mp3" || extension == ".ogg" || extension == ".flac") {
-				return AssetKind::Audio;
-			}
-			if (extension == ".scene") {
-				return AssetKind::Scene;
-			}
-			if (extension == ".prefab") {
-				return AssetKind::Prefab;
-			}
-			if (extension == ".cs" || extension == ".cpp" || extension == ".c" || extension == ".hpp" || extension == ".h") {
-				return AssetKind::Script;
+			for (const KindExtension& entry : k_KindExtensions) {
+				if (extension == entry.Extension) {
+					return entry.Kind;
+				}
 			}
 			if (!extension.empty()) {
 				return AssetKind::Other;
@@ -367,33 +677,42 @@ namespace Bolt {
 			return AssetKind::Unknown;
 		}
 
-		static uint64_t ReadMetaId(const std::string& assetPath) {
+		static MetaInfo ReadMeta(const std::string& assetPath) {
+			MetaInfo meta;
 			const std::string metaPath = GetMetaPath(assetPath);
 			if (!File::Exists(metaPath)) {
-				return 0;
+				return meta;
 			}
 
-			Json::Value meta;
-			std::string parseError;
-			if (!Json::TryParse(File::ReadAllText(metaPath), meta, &parseError) || !meta.IsObject()) {
-				return 0;
+			// Info: Streams the top level members, no DOM is built for the meta file
+			const std::string metaText = File::ReadAllText(metaPath);
+			Json::Reader reader(metaText);
+			if (reader.Next() != Json::Token::BeginObject) {
+				return meta;
 			}
 
-			const Json::Value* uuidValue = meta.FindMember("uuid");
-			if (!uuidValue) {
-				return 0;
-			}
+			Json::Value memberValue;
+			while (reader.Next() == Json::Token::Key) {
+				const std::string key(reader.GetString());
+				reader.Next();
+				if (key != "uuid" && key != "kind") {
+					reader.SkipValue();
+					continue;
+				}
 
-			if (uuidValue->IsString()) {
-				try {
-					return static_cast<uint64_t>(std::stoull(uuidValue->AsStringOr()));
+				if (!reader.ReadValue(memberValue)) {
+					break;
 				}
-				catch (...) {
-					return 0;
+
+				if (key == "uuid") {
+					meta.Id = ParseUInt64(&memberValue);
+				}
+				else {
+					meta.Kind = memberValue.AsStringOr();
 				}
 			}
 
-			return uuidValue->AsUInt64Or(0);
+			return meta;
 		}
 
 		static void WriteMeta(const std::string& assetPath, uint64_t id, AssetKind kind) {
@@ -429,6 +748,9 @@ namespace Bolt {
 		inline static std::string s_TrackedRoot;
 		inline static std::unordered_map<uint64_t, Record> s_IdToRecord;
 		inline static std::unordered_map<std::string, uint64_t> s_PathToId;
+		inline static std::unordered_map<std::string, FileStamp> s_Stamps;
+		inline static std::vector<std::string> s_PendingPaths;
+		inline static bool s_IndexChanged = false;
 	};
 
 }
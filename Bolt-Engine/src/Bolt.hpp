@@ -40,6 +40,7 @@ Bolt specific includes
 
 // Physics
 #include "Physics/Collision2D.hpp"
+#include "Physics/ContactEvent2D.hpp"
 #include "Physics/PhysicsUtility.hpp"
 #include "Physics/Box2DWorld.hpp"
 #include "Physics/Physics2D.hpp"
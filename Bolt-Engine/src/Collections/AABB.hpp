@@ -15,7 +15,11 @@ namespace Bolt {
 
 		static AABB Create(const Vec2& center, const Vec2& halfExtents, float degrees)
 		{
-			float radians = Bolt::Radians<float>(degrees);
+			return CreateRotated(center, halfExtents, Bolt::Radians<float>(degrees));
+		}
+
+		static AABB CreateRotated(const Vec2& center, const Vec2& halfExtents, float radians)
+		{
 			Mat2 rotation = Bolt::Rotation(radians);
 
 
@@ -60,10 +64,10 @@ namespace Bolt {
 				);
 			}
 			else {
-				return AABB::Create(
+				return AABB::CreateRotated(
 					transform.Position,
 					transform.Scale * 0.5f,
-					transform.GetRotationDegrees()
+					transform.Rotation
 				);
 			}
 		}
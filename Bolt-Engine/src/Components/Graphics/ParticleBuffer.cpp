@@ -0,0 +1,163 @@
+#include "pch.hpp"
+#include "Components/Graphics/ParticleBuffer.hpp"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define BT_PARTICLE_SIMD_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BT_PARTICLE_SIMD_SSE
+#endif
+
+namespace Bolt {
+	void ParticleBuffer::Reserve(size_t capacity) {
+		m_PositionX.reserve(capacity);
+		m_PositionY.reserve(capacity);
+		m_VelocityX.reserve(capacity);
+		m_VelocityY.reserve(capacity);
+		m_ScaleX.reserve(capacity);
+		m_ScaleY.reserve(capacity);
+		m_Rotation.reserve(capacity);
+		m_LifeTime.reserve(capacity);
+		m_Color.reserve(capacity);
+	}
+
+	void ParticleBuffer::Clear() {
+		m_PositionX.clear();
+		m_PositionY.clear();
+		m_VelocityX.clear();
+		m_VelocityY.clear();
+		m_ScaleX.clear();
+		m_ScaleY.clear();
+		m_Rotation.clear();
+		m_LifeTime.clear();
+		m_Color.clear();
+	}
+
+	void ParticleBuffer::Push(const Vec2& position, const Vec2& velocity, const Vec2& scale, float rotation, const Color& color, float lifeTime) {
+		m_PositionX.push_back(position.x);
+		m_PositionY.push_back(position.y);
+		m_VelocityX.push_back(velocity.x);
+		m_VelocityY.push_back(velocity.y);
+		m_ScaleX.push_back(scale.x);
+		m_ScaleY.push_back(scale.y);
+		m_Rotation.push_back(rotation);
+		m_LifeTime.push_back(lifeTime);
+		m_Color.push_back(color);
+	}
+
+	void ParticleBuffer::Simulate(float deltaTime, const Vec2& gravity) {
+		if (Integrate(0, Size(), deltaTime, gravity)) {
+			RemoveExpired();
+		}
+	}
+
+	bool ParticleBuffer::Integrate(size_t begin, size_t end, float deltaTime, const Vec2& gravity) {
+		float* positionX = m_PositionX.data();
+		float* positionY = m_PositionY.data();
+		float* velocityX = m_VelocityX.data();
+		float* velocityY = m_VelocityY.data();
+		float* lifeTime = m_LifeTime.data();
+
+		const float gravityX = gravity.x * deltaTime;
+		const float gravityY = gravity.y * deltaTime;
+		bool anyExpired = false;
+		size_t i = begin;
+
+		const auto integrateScalar = [&](size_t index) {
+			velocityX[index] += gravityX;
+			velocityY[index] += gravityY;
+			positionX[index] += velocityX[index] * deltaTime;
+			positionY[index] += velocityY[index] * deltaTime;
+			lifeTime[index] -= deltaTime;
+			anyExpired |= lifeTime[index] <= 0.0f;
+		};
+
+#if defined(BT_PARTICLE_SIMD_AVX)
+		for (; i < end && (i % 8) != 0; i++) integrateScalar(i);
+
+		const __m256 dt8 = _mm256_set1_ps(deltaTime);
+		const __m256 gx8 = _mm256_set1_ps(gravityX);
+		const __m256 gy8 = _mm256_set1_ps(gravityY);
+		const __m256 zero8 = _mm256_setzero_ps();
+		__m256 expired8 = zero8;
+
+		for (; i + 8 <= end; i += 8) {
+			__m256 vx = _mm256_add_ps(_mm256_load_ps(velocityX + i), gx8);
+			__m256 vy = _mm256_add_ps(_mm256_load_ps(velocityY + i), gy8);
+			_mm256_store_ps(velocityX + i, vx);
+			_mm256_store_ps(velocityY + i, vy);
+			_mm256_store_ps(positionX + i, _mm256_add_ps(_mm256_load_ps(positionX + i), _mm256_mul_ps(vx, dt8)));
+			_mm256_store_ps(positionY + i, _mm256_add_ps(_mm256_load_ps(positionY + i), _mm256_mul_ps(vy, dt8)));
+
+			__m256 life = _mm256_sub_ps(_mm256_load_ps(lifeTime + i), dt8);
+			_mm256_store_ps(lifeTime + i, life);
+			expired8 = _mm256_or_ps(expired8, _mm256_cmp_ps(life, zero8, _CMP_LE_OQ));
+		}
+		anyExpired |= _mm256_movemask_ps(expired8) != 0;
+#elif defined(BT_PARTICLE_SIMD_SSE)
+		for (; i < end && (i % 4) != 0; i++) integrateScalar(i);
+
+		const __m128 dt4 = _mm_set1_ps(deltaTime);
+		const __m128 gx4 = _mm_set1_ps(gravityX);
+		const __m128 gy4 = _mm_set1_ps(gravityY);
+		const __m128 zero4 = _mm_setzero_ps();
+		__m128 expired4 = zero4;
+
+		for (; i + 4 <= end; i += 4) {
+			__m128 vx = _mm_add_ps(_mm_load_ps(velocityX + i), gx4);
+			__m128 vy = _mm_add_ps(_mm_load_ps(velocityY + i), gy4);
+			_mm_store_ps(velocityX + i, vx);
+			_mm_store_ps(velocityY + i, vy);
+			_mm_store_ps(positionX + i, _mm_add_ps(_mm_load_ps(positionX + i), _mm_mul_ps(vx, dt4)));
+			_mm_store_ps(positionY + i, _mm_add_ps(_mm_load_ps(positionY + i), _mm_mul_ps(vy, dt4)));
+
+			__m128 life = _mm_sub_ps(_mm_load_ps(lifeTime + i), dt4);
+			_mm_store_ps(lifeTime + i, life);
+			expired4 = _mm_or_ps(expired4, _mm_cmple_ps(life, zero4));
+		}
+		anyExpired |= _mm_movemask_ps(expired4) != 0;
+#endif
+
+		for (; i < end; i++) integrateScalar(i);
+
+		return anyExpired;
+	}
+
+	void ParticleBuffer::RemoveExpired() {
+		size_t index = 0;
+		while (index < Size()) {
+			if (m_LifeTime[index] <= 0.0f) {
+				RemoveAt(index);
+			}
+			else {
+				index++;
+			}
+		}
+	}
+
+	void ParticleBuffer::RemoveAt(size_t index) {
+		const size_t last = Size() - 1;
+		if (index != last) {
+			m_PositionX[index] = m_PositionX[last];
+			m_PositionY[index] = m_PositionY[last];
+			m_VelocityX[index] = m_VelocityX[last];
+			m_VelocityY[index] = m_VelocityY[last];
+			m_ScaleX[index] = m_ScaleX[last];
+			m_ScaleY[index] = m_ScaleY[last];
+			m_Rotation[index] = m_Rotation[last];
+			m_LifeTime[index] = m_LifeTime[last];
+			m_Color[index] = m_Color[last];
+		}
+
+		m_PositionX.pop_back();
+		m_PositionY.pop_back();
+		m_VelocityX.pop_back();
+		m_VelocityY.pop_back();
+		m_ScaleX.pop_back();
+		m_ScaleY.pop_back();
+		m_Rotation.pop_back();
+		m_LifeTime.pop_back();
+		m_Color.pop_back();
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "Collections/Vec2.hpp"
+#include "Collections/Color.hpp"
+#include "Core/Export.hpp"
+#include "Core/Memory.hpp"
+
+#include <vector>
+
+namespace Bolt {
+	// Info: Structure-of-arrays particle storage. Every stream is 32 byte aligned so the
+	// simulation kernel can run over it in SIMD lanes; removal is swap-and-pop, order is not kept.
+	class BOLT_API ParticleBuffer {
+	public:
+		static constexpr size_t k_Alignment = 32;
+		using FloatArray = std::vector<float, AlignedAllocator<float, k_Alignment>>;
+		using ColorArray = std::vector<Color, AlignedAllocator<Color, k_Alignment>>;
+
+		size_t Size() const { return m_LifeTime.size(); }
+		bool Empty() const { return m_LifeTime.empty(); }
+
+		void Reserve(size_t capacity);
+		void Clear();
+
+		void Push(const Vec2& position, const Vec2& velocity, const Vec2& scale, float rotation, const Color& color, float lifeTime);
+
+		// Info: Applies gravity and velocity, ages every particle by deltaTime and swap-removes the expired ones
+		void Simulate(float deltaTime, const Vec2& gravity);
+
+		// Info: Simulate split in two so disjoint ranges can integrate on different threads.
+		// Returns whether a particle in [begin, end) expired; RemoveExpired must then run once on a single thread.
+		bool Integrate(size_t begin, size_t end, float deltaTime, const Vec2& gravity);
+		void RemoveExpired();
+
+		Vec2 GetPosition(size_t index) const { return { m_PositionX[index], m_PositionY[index] }; }
+		Vec2 GetVelocity(size_t index) const { return { m_VelocityX[index], m_VelocityY[index] }; }
+		Vec2 GetScale(size_t index) const { return { m_ScaleX[index], m_ScaleY[index] }; }
+		float GetRotation(size_t index) const { return m_Rotation[index]; }
+		float GetLifeTime(size_t index) const { return m_LifeTime[index]; }
+		const Color& GetColor(size_t index) const { return m_Color[index]; }
+
+	private:
+		void RemoveAt(size_t index);
+
+		FloatArray m_PositionX;
+		FloatArray m_PositionY;
+		FloatArray m_VelocityX;
+		FloatArray m_VelocityY;
+		FloatArray m_ScaleX;
+		FloatArray m_ScaleY;
+		FloatArray m_Rotation;
+		FloatArray m_LifeTime;
+		ColorArray m_Color;
+	};
+}
@@ -7,6 +7,8 @@
 #include <Core/Time.hpp>
 #include <Core/Application.hpp>
 
+#include <algorithm>
+
 namespace Bolt {
 	Transform2DComponent& ParticleSystem2DComponent::GetTransform2D() {
 		Transform2DComponent* transform = const_cast<Transform2DComponent*>(TryGetEmitterTransform());
@@ -33,55 +35,43 @@ namespace Bolt {
 		return &m_EmitterScene->GetComponent<Transform2DComponent>(m_EmitterEntity);
 	}
 
-	void ParticleSystem2DComponent::Update() {
-		float deltaTime = Application::GetInstance()->GetTime().GetDeltaTime();
-		if (deltaTime == 0.f) return;
-
-		if (m_IsEmitting) {
-			float toEmit = EmissionSettings.EmitOverTime * deltaTime + m_EmitAccumulator;
-			int emitCount = static_cast<int>(toEmit);
-			m_EmitAccumulator = toEmit - emitCount;
-			Emit(emitCount);
-
-			for (auto& burst : m_Bursts) {
-				burst.TimeUntilNext += deltaTime;
-				if (burst.TimeUntilNext >= burst.Interval) {
-					Emit(burst.Count);
-					burst.TimeUntilNext = 0;
-				}
-			}
-		}
-		if (m_IsSimulating) {
-			for (auto& particle : m_Particles) {
-				if (ParticleSettings.UseGravity) {
-					particle.Velocity += ParticleSettings.Gravity * deltaTime;
-				}
+	void ParticleSystem2DComponent::UpdateEmission(float deltaTime, const Transform2DComponent* emitterTransform) {
+		if (!m_IsEmitting || deltaTime == 0.f) return;
 
-				particle.Transform.Position += particle.Velocity * deltaTime;
-			}
+		float toEmit = EmissionSettings.EmitOverTime * deltaTime + m_EmitAccumulator;
+		int emitCount = static_cast<int>(toEmit);
+		m_EmitAccumulator = toEmit - emitCount;
+		EmitInternal(emitCount, emitterTransform);
 
-			m_Particles.erase(std::remove_if(m_Particles.begin(), m_Particles.end(),
-				[deltaTime](Particle& p) {
-					return (p.LifeTime -= deltaTime) <= 0.f;
-				}), m_Particles.end());
+		for (auto& burst : m_Bursts) {
+			burst.TimeUntilNext += deltaTime;
+			if (burst.TimeUntilNext >= burst.Interval) {
+				EmitInternal(burst.Count, emitterTransform);
+				burst.TimeUntilNext = 0;
+			}
 		}
 	}
 
 	void ParticleSystem2DComponent::Emit(size_t count) {
+		EmitInternal(count, TryGetEmitterTransform());
+	}
+
+	void ParticleSystem2DComponent::EmitInternal(size_t count, const Transform2DComponent* emitterTransform) {
 		if(!m_IsEmitting || count == 0)
 			return;
 
 		const uint32_t maxParticles = RenderingSettings.MaxParticles;
 
-		if (m_Particles.size() >= maxParticles)
+		// Info: GPU emitters only count here, the slots are respawned by the next StepGpuSimulation
+		if (UsesGpuSimulation()) {
+			m_PendingGpuEmit = static_cast<uint32_t>(std::min<size_t>(m_PendingGpuEmit + count, maxParticles));
 			return;
+		}
 
-		m_Particles.reserve(Clamp<uint32_t>(m_Particles.size() + count, 0, maxParticles));
+		if (m_Particles.Size() >= maxParticles)
+			return;
 
 		while (count > 0) {
-			Particle particle;
-			particle.LifeTime = ParticleSettings.LifeTime;
-
 			Vec2 position{ 0 };
 			Vec2 scale{ ParticleSettings.Scale, ParticleSettings.Scale };
 			float rot{ 0.f };
@@ -89,30 +79,77 @@ namespace Bolt {
 			std::visit([&](auto const& s) {
 				using T = std::decay_t<decltype(s)>;
 				if constexpr (std::is_same_v<T, CircleParams>) {
-					position = s.IsOnCircle ? RandomOnCircle(s.Radius) : RandomInCircle(s.Radius);
+					position = s.IsOnCircle ? m_Random.NextOnCircle(s.Radius) : m_Random.NextInCircle(s.Radius);
 				}
 				else if constexpr (std::is_same_v<T, SquareParams>) {
-					position = Vec2(Random::NextFloat(-s.HalfExtends.x, s.HalfExtends.x), Random::NextFloat(-s.HalfExtends.y, s.HalfExtends.y));
+					const float x = m_Random.NextFloat(-s.HalfExtends.x, s.HalfExtends.x);
+					const float y = m_Random.NextFloat(-s.HalfExtends.y, s.HalfExtends.y);
+					position = Vec2(x, y);
 				}
 				}, Shape);
 
-			if (EmissionSettings.EmissionSpace == Space::World) {
-				if (const Transform2DComponent* emitterTransform = TryGetEmitterTransform()) {
-					position = emitterTransform->TransformPoint(position);
-				}
+			if (EmissionSettings.EmissionSpace == Space::World && emitterTransform) {
+				position = emitterTransform->TransformPoint(position);
 			}
 
-			particle.Velocity = ParticleSettings.MoveDirection * ParticleSettings.Speed;
-			particle.Transform.Position = position;
-			particle.Transform.Rotation = rot;
-			particle.Transform.Scale = scale;
-			particle.Color = ParticleSettings.UseRandomColors ? Bolt::Color(Random::NextFloat(0.f, 1.f), Random::NextFloat(0.f, 1.f), Random::NextFloat(0.f, 1.f)) : RenderingSettings.Color;
-			m_Particles.push_back(particle);
+			const Vec2 velocity = ParticleSettings.MoveDirection * ParticleSettings.Speed;
+			Bolt::Color color = RenderingSettings.Color;
+			if (ParticleSettings.UseRandomColors) {
+				const float r = m_Random.NextFloat();
+				const float g = m_Random.NextFloat();
+				const float b = m_Random.NextFloat();
+				color = Bolt::Color(r, g, b);
+			}
+			m_Particles.Push(position, velocity, scale, rot, color, ParticleSettings.LifeTime);
 
-			if (m_Particles.size() >= maxParticles)
+			if (m_Particles.Size() >= maxParticles)
 				break;
 
 			count--;
 		}
 	}
+
+	bool ParticleSystem2DComponent::UsesGpuSimulation() const {
+		return ParticleSettings.Simulation == SimulationMode::GPU && GpuParticleSimulation::IsSupported();
+	}
+
+	void ParticleSystem2DComponent::StepGpuSimulation(float deltaTime, const Transform2DComponent* emitterTransform) {
+		m_GpuSimulation.EnsureCapacity(RenderingSettings.MaxParticles);
+		if (m_GpuResetRequested) {
+			m_GpuSimulation.Reset();
+			m_GpuResetRequested = false;
+		}
+
+		GpuParticleEmitParams emit;
+		emit.Count = m_PendingGpuEmit;
+		emit.Seed = m_Random.NextUInt();
+		emit.LifeTime = ParticleSettings.LifeTime;
+		emit.Velocity = ParticleSettings.MoveDirection * ParticleSettings.Speed;
+		emit.Scale = Vec2(ParticleSettings.Scale, ParticleSettings.Scale);
+		emit.Color = RenderingSettings.Color;
+		emit.UseRandomColors = ParticleSettings.UseRandomColors;
+
+		std::visit([&](auto const& s) {
+			using T = std::decay_t<decltype(s)>;
+			if constexpr (std::is_same_v<T, CircleParams>) {
+				emit.ShapeType = 0;
+				emit.ShapeParams = Vec2(s.Radius, s.IsOnCircle ? 1.f : 0.f);
+			}
+			else if constexpr (std::is_same_v<T, SquareParams>) {
+				emit.ShapeType = 1;
+				emit.ShapeParams = s.HalfExtends;
+			}
+			}, Shape);
+
+		emit.WorldSpace = EmissionSettings.EmissionSpace == Space::World && emitterTransform;
+		if (emitterTransform) {
+			emit.EmitterPosition = emitterTransform->Position;
+			emit.EmitterScale = emitterTransform->Scale;
+			emit.EmitterRotation = emitterTransform->Rotation;
+		}
+
+		const Vec2 gravity = ParticleSettings.UseGravity ? ParticleSettings.Gravity : Vec2(0.f, 0.f);
+		m_GpuSimulation.Step(deltaTime, gravity, emit);
+		m_PendingGpuEmit = 0;
+	}
 }
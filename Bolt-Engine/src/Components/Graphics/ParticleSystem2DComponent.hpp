@@ -1,12 +1,14 @@
 #pragma once
 #include "Components/General/Transform2DComponent.hpp"
+#include "Components/Graphics/ParticleBuffer.hpp"
+#include "Graphics/GpuParticleSimulation.hpp"
 #include "Core/Export.hpp"
 #include "Core/UUID.hpp"
 #include "Graphics/TextureHandle.hpp"
 #include "Collections/Color.hpp"
 #include "Scene/EntityHandle.hpp"
+#include "Math/RandomStream.hpp"
 #include <variant>
-#include <span>
 
 namespace Bolt {
 	class Scene;
@@ -18,13 +20,6 @@ namespace Bolt {
 
 	public:
 
-		struct Particle {
-			Transform2DComponent Transform;
-			Color Color;
-			float LifeTime;
-			Vec2 Velocity;
-		};
-
 		enum class Space {
 			Local,
 			World
@@ -43,6 +38,13 @@ namespace Bolt {
 			uint8_t SortingLayer{ 0 };
 		};
 
+		// Info: GPU keeps particle state in GL buffers updated by a transform feedback pass,
+		// falls back to CPU when the update program is unavailable
+		enum class SimulationMode {
+			CPU,
+			GPU
+		};
+
 		struct ParticleSettings {
 			float LifeTime{ 1.f };
 			float Speed{ 5.f };
@@ -51,6 +53,7 @@ namespace Bolt {
 			bool UseRandomColors{ false };
 			float Scale{ 1.f };
 			Vec2 MoveDirection{ 0.f, 0.f };
+			SimulationMode Simulation{ SimulationMode::CPU };
 		};
 
 		struct EmissionSettings {
@@ -81,7 +84,7 @@ namespace Bolt {
 		UUID GetTextureAssetId() const { return m_TextureAssetId; }
 		void Emit(size_t count);
 		void AddBurst(const Burst& burst) { m_Bursts.push_back(burst); }
-		std::span<const Particle> GetParticles() const noexcept { return m_Particles; }
+		const ParticleBuffer& GetParticles() const noexcept { return m_Particles; }
 		bool IsPlaying() const { return m_IsEmitting; }
 		Transform2DComponent& GetTransform2D();
 		const Transform2DComponent& GetTransform2D() const;
@@ -101,7 +104,9 @@ namespace Bolt {
 		bool IsEmitting() const { return m_IsEmitting; }
 		bool IsSimulating() const { return m_IsSimulating; }
 
-		void Clear() { m_Particles.clear(); m_Bursts.clear();  m_EmitAccumulator = 0.f; }
+		void Clear() { m_Particles.Clear(); m_Bursts.clear();  m_EmitAccumulator = 0.f; m_PendingGpuEmit = 0; m_GpuResetRequested = true; }
+
+		bool UsesGpuSimulation() const;
 
 		bool PlayOnAwake{ true };
 		ParticleSettings ParticleSettings;
@@ -110,9 +115,19 @@ namespace Bolt {
 		RenderingSettings RenderingSettings;
 
 	private:
-		void Update();
+		// Info: Emission half of the per-frame update. The emitter transform is resolved by the caller so
+		// this can run on a worker thread without touching the registry.
+		void UpdateEmission(float deltaTime, const Transform2DComponent* emitterTransform);
+		void EmitInternal(size_t count, const Transform2DComponent* emitterTransform);
 		const Transform2DComponent* TryGetEmitterTransform() const;
-		std::vector<Particle> m_Particles;
+		// Info: Runs the GPU pass, needs the GL context so it is called from the main thread only
+		void StepGpuSimulation(float deltaTime, const Transform2DComponent* emitterTransform);
+		ParticleBuffer m_Particles;
+		// Info: Own stream split from Random's seed on construct, so emission is reproducible however the emitters are scheduled
+		RandomStream m_Random;
+		GpuParticleSimulation m_GpuSimulation;
+		uint32_t m_PendingGpuEmit{ 0 };
+		bool m_GpuResetRequested{ false };
 		std::vector<Burst> m_Bursts;
 
 		Scene* m_EmitterScene{ nullptr };
@@ -43,7 +43,7 @@ namespace Bolt {
 		const Vec2 center = GetCenter();
 		const float friction = GetFriction();
 		const float bounciness = GetBounciness();
-		const uint64_t layer = GetLayer();
+		const int layer = GetLayer();
 		const bool enabled = IsEnabled();
 		const bool registerContacts = CanRegisterContacts();
 
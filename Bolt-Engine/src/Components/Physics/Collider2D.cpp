@@ -3,6 +3,9 @@
 #include <Components/General/Transform2DComponent.hpp>
 
 #include <Math/Trigonometry.hpp>
+#include <Physics/CollisionLayers2D.hpp>
+
+#include <bit>
 
 
 namespace Bolt {
@@ -11,12 +14,11 @@ namespace Bolt {
 	float Collider2D::GetFriction() const { return b2Shape_GetFriction(m_ShapeId); }
 	void Collider2D::SetBounciness(float bounciness) { b2Shape_SetRestitution(m_ShapeId, bounciness); }
 	float Collider2D::GetBounciness() const { return b2Shape_GetRestitution(m_ShapeId); }
-	void Collider2D::SetLayer(uint64_t layer) {
-		b2Filter filter = b2Shape_GetFilter(m_ShapeId);
-		filter.maskBits = layer;
-		b2Shape_SetFilter(m_ShapeId, filter);
+	void Collider2D::SetLayer(int layer) { b2Shape_SetFilter(m_ShapeId, CollisionLayers2D::MakeShapeFilter(layer)); }
+	int Collider2D::GetLayer() const {
+		const uint64_t categoryBits = b2Shape_GetFilter(m_ShapeId).categoryBits & ~CollisionLayers2D::k_QueryCategoryBit;
+		return categoryBits != 0 ? std::countr_zero(categoryBits) : 0;
 	}
-	uint64_t Collider2D::GetLayer() const { return b2Shape_GetFilter(m_ShapeId).maskBits; }
 	bool Collider2D::IsEnabled() const { return b2Body_IsEnabled(m_BodyId); }
 	bool Collider2D::IsSensor() const { return b2Shape_IsSensor(m_ShapeId); }
 
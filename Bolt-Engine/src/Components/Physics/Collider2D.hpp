@@ -24,8 +24,9 @@ namespace Bolt {
 		float GetFriction() const;
 		void SetBounciness(float bounciness);
 		float GetBounciness() const;
-		void SetLayer(uint64_t layer);
-		uint64_t GetLayer() const;
+		// Info: Collision layer index from the project's layer matrix, sets both category and mask bits
+		void SetLayer(int layer);
+		int GetLayer() const;
 		bool IsEnabled() const;
 		bool IsSensor() const;
 
@@ -1,11 +1,13 @@
 #pragma once
 #include "Collections/Vec2.hpp"
 #include <box2d/types.h>
+#include <cstdint>
 
 namespace Bolt {
 	class Scene;
 	struct Transform2DComponent;
 	enum class BodyType;
+	enum class InterpolationMode : int;
 }
 
 namespace Bolt {
@@ -43,6 +45,10 @@ namespace Bolt {
 
 		void SetEnabled(bool enabled);
 
+		// Info: Interpolated bodies keep Transform2D between their last two simulated poses, GetPosition/GetRotation stay exact
+		void SetInterpolation(InterpolationMode mode) { m_Interpolation = mode; }
+		InterpolationMode GetInterpolation() const { return m_Interpolation; }
+
 		b2BodyId GetBodyHandle() const;
 		bool IsValid() const;
 
@@ -50,6 +56,14 @@ namespace Bolt {
 	private:
 		b2BodyId m_BodyId{ b2_nullBodyId };
 
+		InterpolationMode m_Interpolation{};
+		// Info: Poses of the last two fixed steps, valid while m_InterpolationStep is the step that wrote them
+		Vec2 m_PreviousPosition{ 0.0f, 0.0f };
+		Vec2 m_CurrentPosition{ 0.0f, 0.0f };
+		float m_PreviousRotation = 0.0f;
+		float m_CurrentRotation = 0.0f;
+		uint32_t m_InterpolationStep = 0;	// Info: 0 means never simulated, the first step blends from the transform
+
 
 		friend class BoxCollider2DComponent;
 		friend class Collider2D;
@@ -4,6 +4,7 @@
 #include "Graphics/TextureManager.hpp"
 #include "Graphics/OpenGL.hpp"
 #include "Core/SingleInstance.hpp"
+#include "Core/JobSystem.hpp"
 #include "Audio/AudioManager.hpp"
 #include "Events/EventDispatcher.hpp"
 #include "Events/WindowEvents.hpp"
@@ -15,6 +16,8 @@
 #include "Project/BoltProject.hpp"
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+
 namespace Bolt {
 	const float Application::k_PausedTargetFrameRate = 10;
 
@@ -104,6 +107,12 @@ namespace Bolt {
 					m_FixedUpdateAccumulator -= m_Time.GetUnscaledFixedDeltaTime();
 				}
 
+				// Info: Rendered physics transforms lag one fixed step behind and blend by the leftover accumulator
+				if (m_PhysicsSystem2D && !m_IsPaused && !m_IsPlaymodePaused) {
+					const double alpha = m_FixedUpdateAccumulator / m_Time.GetUnscaledFixedDeltaTime();
+					m_PhysicsSystem2D->Interpolate(static_cast<float>(std::clamp(alpha, 0.0, 1.0)));
+				}
+
 				BeginFrame();
 				EndFrame();
 				TryCompleteQuitRequest();
@@ -127,6 +136,10 @@ namespace Bolt {
 		SetName(m_Configuration.WindowSpecification.Title);
 
 		Timer timer = Timer();
+		JobSystem::Initialize(m_Configuration.WorkerThreadCount);
+		BT_INFO_TAG("JobSystem", "Initialization took " + StringHelper::ToString(timer));
+
+		timer.Reset();
 		Window::Initialize();
 		m_Window = std::make_unique<Window>(m_Configuration.WindowSpecification);
 		m_Window->SetVsync(m_Configuration.Vsync);
@@ -213,6 +226,7 @@ namespace Bolt {
 
 	void Application::BeginFrame() {
 		CoreInput();
+		TextureManager::ProcessPendingLoads(m_Configuration.TextureUploadBudgetMs);
 
 		if (!m_IsPaused) {
 			bool gameplayActive = m_IsPlaying && !m_IsPlaymodePaused;
@@ -227,6 +241,7 @@ namespace Bolt {
 			}
 
 			if (gameplayActive && m_SceneManager) m_SceneManager->UpdateScenes();
+			if (m_PhysicsSystem2D) m_PhysicsSystem2D->EndFrame();
 
 			if (m_ImGuiRenderer) {
 				BOLT_TRY_CATCH_LOG(m_ImGuiRenderer->BeginFrame());
@@ -447,6 +462,8 @@ namespace Bolt {
 		if (AudioManager::IsInitialized())
 			AudioManager::Shutdown();
 
+		JobSystem::Shutdown();
+
 		if (m_Window) {
 			m_Window->SetEventCallback({});
 			m_Window->Destroy();
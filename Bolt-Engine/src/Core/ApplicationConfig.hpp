@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/WindowSpecification.hpp"
+#include <cstdint>
 
 namespace Bolt {
 
@@ -13,6 +14,10 @@ namespace Bolt {
 		bool EnableAudio = true;
 		bool SetWindowIcon = true;
 		bool Vsync = true;
+		// Info: Background JobSystem threads, 0 uses hardware_concurrency - 1. Box2D steps on these threads as well
+		uint32_t WorkerThreadCount = 0;
+		// Info: Main thread time per frame for uploading textures decoded by async loads
+		float TextureUploadBudgetMs = 2.0f;
 	};
 
 } // namespace Bolt
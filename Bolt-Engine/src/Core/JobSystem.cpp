@@ -0,0 +1,239 @@
+#include "pch.hpp"
+#include "Core/JobSystem.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+
+namespace Bolt {
+	std::vector<std::thread> JobSystem::s_Workers;
+	std::deque<std::function<void()>> JobSystem::s_Jobs;
+	std::deque<std::function<void()>> JobSystem::s_BackgroundJobs;
+	std::mutex JobSystem::s_Mutex;
+	std::condition_variable JobSystem::s_WakeCondition;
+	bool JobSystem::s_IsInitialized = false;
+	bool JobSystem::s_IsRunning = false;
+
+	namespace {
+		thread_local uint32_t s_ThreadIndex = 0;
+	}
+
+	void JobSystem::Initialize(uint32_t workerCount) {
+		if (s_IsInitialized) {
+			BT_CORE_WARN_TAG("JobSystem", "JobSystem is already initialized");
+			return;
+		}
+
+		if (workerCount == 0) {
+			const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+			workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+		}
+
+		s_IsRunning = true;
+		s_Workers.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; i++) {
+			s_Workers.emplace_back(&JobSystem::WorkerLoop, i + 1);
+		}
+
+		s_IsInitialized = true;
+		BT_CORE_INFO_TAG("JobSystem", "Started {} worker threads", workerCount);
+	}
+
+	void JobSystem::Shutdown() {
+		if (!s_IsInitialized) return;
+
+		{
+			std::lock_guard<std::mutex> lock(s_Mutex);
+			s_IsRunning = false;
+		}
+		s_WakeCondition.notify_all();
+
+		for (std::thread& worker : s_Workers) {
+			if (worker.joinable()) worker.join();
+		}
+
+		s_Workers.clear();
+		s_Jobs.clear();
+		s_BackgroundJobs.clear();
+		s_IsInitialized = false;
+	}
+
+	uint32_t JobSystem::GetThreadIndex() {
+		return s_ThreadIndex;
+	}
+
+	size_t JobSystem::GetChunkCount(size_t count, size_t minChunkSize) {
+		if (count == 0) return 0;
+
+		const size_t chunkSize = std::max<size_t>(minChunkSize, 1);
+		const size_t maxChunks = static_cast<size_t>(s_Workers.size()) + 1;
+		return std::min(maxChunks, (count + chunkSize - 1) / chunkSize);
+	}
+
+	void JobSystem::ParallelFor(size_t count, size_t minChunkSize, const RangeFunction& function) {
+		const size_t chunkCount = GetChunkCount(count, minChunkSize);
+		if (chunkCount == 0) return;
+
+		if (chunkCount == 1) {
+			function(0, count, 0);
+			return;
+		}
+
+		Counter state;
+		state.Remaining = chunkCount - 1;
+
+		const auto chunkBegin = [count, chunkCount](size_t chunk) { return count * chunk / chunkCount; };
+
+		{
+			std::lock_guard<std::mutex> lock(s_Mutex);
+			for (size_t chunk = 1; chunk < chunkCount; chunk++) {
+				s_Jobs.emplace_back([&function, &state, begin = chunkBegin(chunk), end = chunkBegin(chunk + 1), chunk]() {
+					try {
+						function(begin, end, chunk);
+					}
+					catch (const std::exception& e) {
+						BT_CORE_ERROR_TAG("JobSystem", "Job error: {}", e.what());
+					}
+					catch (...) {
+						BT_CORE_ERROR_TAG("JobSystem", "Unknown job error");
+					}
+
+					std::lock_guard<std::mutex> doneLock(state.Mutex);
+					if (--state.Remaining == 0) state.Done.notify_all();
+				});
+			}
+		}
+		s_WakeCondition.notify_all();
+
+		// Info: Queued chunks reference this frame, so an exception from chunk 0 is rethrown only after they finished
+		std::exception_ptr inlineException;
+		try {
+			function(0, chunkBegin(1), 0);
+		}
+		catch (...) {
+			inlineException = std::current_exception();
+		}
+
+		// Info: Help with queued work before sleeping, this also keeps nested ParallelFor calls from deadlocking
+		Wait(state);
+
+		if (inlineException) std::rethrow_exception(inlineException);
+	}
+
+	void JobSystem::Dispatch(Counter& counter, size_t count, size_t minChunkSize, RangeFunction function) {
+		const size_t chunkCount = GetChunkCount(count, minChunkSize);
+		if (chunkCount == 0) return;
+
+		{
+			std::lock_guard<std::mutex> lock(counter.Mutex);
+			counter.Remaining += chunkCount;
+		}
+
+		auto shared = std::make_shared<const RangeFunction>(std::move(function));
+		{
+			std::lock_guard<std::mutex> lock(s_Mutex);
+			for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+				const size_t begin = count * chunk / chunkCount;
+				const size_t end = count * (chunk + 1) / chunkCount;
+				s_Jobs.emplace_back([shared, &counter, begin, end, chunk]() {
+					try {
+						(*shared)(begin, end, chunk);
+					}
+					catch (const std::exception& e) {
+						BT_CORE_ERROR_TAG("JobSystem", "Job error: {}", e.what());
+					}
+					catch (...) {
+						BT_CORE_ERROR_TAG("JobSystem", "Unknown job error");
+					}
+
+					std::lock_guard<std::mutex> doneLock(counter.Mutex);
+					if (--counter.Remaining == 0) counter.Done.notify_all();
+				});
+			}
+		}
+		s_WakeCondition.notify_all();
+	}
+
+	void JobSystem::Wait(Counter& counter) {
+		while (true) {
+			{
+				std::lock_guard<std::mutex> lock(counter.Mutex);
+				if (counter.Remaining == 0) return;
+			}
+			if (!TryRunPendingJob()) {
+				std::unique_lock<std::mutex> lock(counter.Mutex);
+				counter.Done.wait(lock, [&counter]() { return counter.Remaining == 0; });
+				return;
+			}
+		}
+	}
+
+	void JobSystem::SubmitBackground(Counter& counter, std::function<void()> job) {
+		{
+			std::lock_guard<std::mutex> lock(counter.Mutex);
+			counter.Remaining++;
+		}
+
+		auto run = [job = std::move(job), &counter]() {
+			try {
+				job();
+			}
+			catch (const std::exception& e) {
+				BT_CORE_ERROR_TAG("JobSystem", "Background job error: {}", e.what());
+			}
+			catch (...) {
+				BT_CORE_ERROR_TAG("JobSystem", "Unknown background job error");
+			}
+
+			std::lock_guard<std::mutex> doneLock(counter.Mutex);
+			if (--counter.Remaining == 0) counter.Done.notify_all();
+		};
+
+		{
+			std::lock_guard<std::mutex> lock(s_Mutex);
+			if (s_IsRunning && !s_Workers.empty()) {
+				s_BackgroundJobs.emplace_back(std::move(run));
+				s_WakeCondition.notify_one();
+				return;
+			}
+		}
+		run();
+	}
+
+	bool JobSystem::IsDone(Counter& counter) {
+		std::lock_guard<std::mutex> lock(counter.Mutex);
+		return counter.Remaining == 0;
+	}
+
+	void JobSystem::WorkerLoop(uint32_t threadIndex) {
+		s_ThreadIndex = threadIndex;
+		while (true) {
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> lock(s_Mutex);
+				s_WakeCondition.wait(lock, []() { return !s_IsRunning || !s_Jobs.empty() || !s_BackgroundJobs.empty(); });
+
+				// Info: Frame work first, background jobs are drained before shutdown so their counters still complete
+				std::deque<std::function<void()>>& queue = !s_Jobs.empty() ? s_Jobs : s_BackgroundJobs;
+				if (queue.empty()) return;
+
+				job = std::move(queue.front());
+				queue.pop_front();
+			}
+			job();
+		}
+	}
+
+	bool JobSystem::TryRunPendingJob() {
+		std::function<void()> job;
+		{
+			std::lock_guard<std::mutex> lock(s_Mutex);
+			if (s_Jobs.empty()) return false;
+
+			job = std::move(s_Jobs.front());
+			s_Jobs.pop_front();
+		}
+		job();
+		return true;
+	}
+}
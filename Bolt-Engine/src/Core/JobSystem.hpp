@@ -0,0 +1,66 @@
+#pragma once
+#include "Core/Export.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Bolt {
+	// Info: Fixed pool of worker threads for data-parallel engine work.
+	// The calling thread always takes part, so a pool with 0 workers runs everything inline.
+	class BOLT_API JobSystem {
+	public:
+		using RangeFunction = std::function<void(size_t begin, size_t end, size_t chunkIndex)>;
+
+		// Info: Completion counter for work started with Dispatch(), every Dispatch() needs a matching Wait()
+		struct Counter {
+			std::mutex Mutex;
+			std::condition_variable Done;
+			size_t Remaining = 0;
+		};
+
+		// Info: workerCount 0 picks hardware_concurrency - 1
+		static void Initialize(uint32_t workerCount = 0);
+		static void Shutdown();
+		static bool IsInitialized() { return s_IsInitialized; }
+
+		static uint32_t GetWorkerCount() { return static_cast<uint32_t>(s_Workers.size()); }
+		// Info: 0 for any thread outside the pool, 1..GetWorkerCount() for pool workers
+		static uint32_t GetThreadIndex();
+
+		// Info: Number of chunks ParallelFor splits count items into, callers size per-chunk buffers with it
+		static size_t GetChunkCount(size_t count, size_t minChunkSize);
+
+		// Info: Splits [0, count) into GetChunkCount() contiguous chunks and blocks until all of them ran.
+		// Chunk indices are dense and ordered by range, so per-chunk results can be merged deterministically.
+		static void ParallelFor(size_t count, size_t minChunkSize, const RangeFunction& function);
+
+		// Info: Queues the same chunks as ParallelFor but returns immediately, the caller does not run any of them.
+		// The function is copied, so it may outlive the caller's frame until Wait() returns.
+		static void Dispatch(Counter& counter, size_t count, size_t minChunkSize, RangeFunction function);
+		// Info: Runs queued jobs until the counter reaches zero
+		static void Wait(Counter& counter);
+
+		// Info: Queues a long running job (file IO, decoding) that must not stall a frame. Only pool workers run it,
+		// after any pending ParallelFor/Dispatch chunks, and Wait() never picks it up inline. Runs inline without workers.
+		static void SubmitBackground(Counter& counter, std::function<void()> job);
+		// Info: Non blocking check for counters of background jobs
+		static bool IsDone(Counter& counter);
+
+	private:
+		static void WorkerLoop(uint32_t threadIndex);
+		static bool TryRunPendingJob();
+
+		static std::vector<std::thread> s_Workers;
+		static std::deque<std::function<void()>> s_Jobs;
+		static std::deque<std::function<void()>> s_BackgroundJobs;
+		static std::mutex s_Mutex;
+		static std::condition_variable s_WakeCondition;
+		static bool s_IsInitialized;
+		static bool s_IsRunning;
+	};
+}
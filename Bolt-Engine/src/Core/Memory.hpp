@@ -5,6 +5,7 @@
 #include <limits>
 #include <map>
 #include <mutex>
+#include <new>
 #include <utility>
 
 namespace Bolt {
@@ -53,6 +54,34 @@ namespace Bolt {
 		}
 	};
 
+	// Info: Allocator for SIMD-friendly containers, storage starts on an Alignment byte boundary
+	template <class T, std::size_t Alignment>
+	struct AlignedAllocator
+	{
+		static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+		typedef T value_type;
+		template <class U> struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+		AlignedAllocator() = default;
+		template <class U> constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+		T* allocate(std::size_t n)
+		{
+			if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+				throw std::bad_array_new_length();
+
+			return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+		}
+
+		void deallocate(T* p, std::size_t) noexcept {
+			::operator delete(p, std::align_val_t(Alignment));
+		}
+
+		template <class U> bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+		template <class U> bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+	};
+
 	struct AllocatorData
 	{
 		using MapAlloc = Mallocator<std::pair<const void* const, Allocation>>;
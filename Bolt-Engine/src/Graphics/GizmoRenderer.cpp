@@ -8,23 +8,11 @@
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <cstring>
+
 namespace Bolt {
 	namespace {
-		struct UploadVertex {
-			float x, y, z;
-			float r, g, b, a;
-		};
-
-		constexpr GLsizei GizmoVertexStride = static_cast<GLsizei>(sizeof(UploadVertex));
-
-		static void ConvertVertices(const std::vector<PosColorVertex>& src, std::vector<UploadVertex>& dst) {
-			dst.clear();
-			dst.reserve(src.size());
-			for (const auto& v : src) {
-				Color c = Color::FromABGR32(v.color);
-				dst.push_back({ v.x, v.y, v.z, c.r, c.g, c.b, c.a });
-			}
-		}
+		constexpr GLsizei GizmoVertexStride = static_cast<GLsizei>(sizeof(PosColorVertex));
 	}
 
 	bool GizmoRenderer2D::m_IsInitialized = false;
@@ -33,12 +21,9 @@ namespace Bolt {
 	std::vector<uint16_t> GizmoRenderer2D::m_GizmoIndices;
 	uint16_t GizmoRenderer2D::m_GizmoViewId = 1;
 	unsigned int GizmoRenderer2D::m_VAO = 0;
-	unsigned int GizmoRenderer2D::m_VBO = 0;
-	unsigned int GizmoRenderer2D::m_EBO = 0;
+	StreamingBuffer GizmoRenderer2D::m_StreamingBuffer;
 	int GizmoRenderer2D::m_uMVP = -1;
 
-	static std::vector<UploadVertex> s_UploadBuffer;
-
 	bool GizmoRenderer2D::Initialize() {
 		if (m_IsInitialized)
 			return true;
@@ -54,26 +39,13 @@ namespace Bolt {
 		GLuint program = m_GizmoShader->GetHandle();
 		m_uMVP = glGetUniformLocation(program, "uMVP");
 
-		glGenVertexArrays(1, &m_VAO);
-		glGenBuffers(1, &m_VBO);
-		glGenBuffers(1, &m_EBO);
+		m_StreamingBuffer.Initialize(4096 * sizeof(PosColorVertex) + 8192 * sizeof(uint16_t));
 
+		glGenVertexArrays(1, &m_VAO);
 		glBindVertexArray(m_VAO);
-		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-		glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
-
 		glEnableVertexAttribArray(0);
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, GizmoVertexStride, reinterpret_cast<void*>(0));
-
 		glEnableVertexAttribArray(1);
-		glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, GizmoVertexStride, reinterpret_cast<void*>(sizeof(float) * 3));
-
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
-
 		glBindVertexArray(0);
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
 		m_GizmoVertices.reserve(4096);
 		m_GizmoIndices.reserve(8192);
@@ -86,14 +58,7 @@ namespace Bolt {
 		if (!m_IsInitialized)
 			return;
 
-		if (m_EBO) {
-			glDeleteBuffers(1, &m_EBO);
-			m_EBO = 0;
-		}
-		if (m_VBO) {
-			glDeleteBuffers(1, &m_VBO);
-			m_VBO = 0;
-		}
+		m_StreamingBuffer.Shutdown();
 		if (m_VAO) {
 			glDeleteVertexArrays(1, &m_VAO);
 			m_VAO = 0;
@@ -102,7 +67,6 @@ namespace Bolt {
 		m_GizmoShader.reset();
 		m_GizmoVertices.clear();
 		m_GizmoIndices.clear();
-		s_UploadBuffer.clear();
 
 		m_IsInitialized = false;
 	}
@@ -191,30 +155,11 @@ namespace Bolt {
 		if (!m_IsInitialized || m_GizmoVertices.empty() || !m_GizmoShader || !m_GizmoShader->IsValid())
 			return;
 
-		ConvertVertices(m_GizmoVertices, s_UploadBuffer);
-
-		glBindVertexArray(m_VAO);
-
-		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-		glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(s_UploadBuffer.size() * sizeof(UploadVertex)), s_UploadBuffer.data(), GL_DYNAMIC_DRAW);
-
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_GizmoIndices.size() * sizeof(uint16_t)), m_GizmoIndices.data(), GL_DYNAMIC_DRAW);
-
-		m_GizmoShader->Submit();
-
-		if (Camera2DComponent::Main()) {
-			glm::mat4 mvp = Camera2DComponent::Main()->GetViewProjectionMatrix();
-			if (m_uMVP >= 0) {
-				glUniformMatrix4fv(m_uMVP, 1, GL_FALSE, glm::value_ptr(mvp));
-			}
+		if (!Camera2DComponent::Main()) {
+			return;
 		}
 
-		glLineWidth(Gizmo::s_LineWidth);
-		glDrawElements(GL_LINES, static_cast<GLsizei>(m_GizmoIndices.size()), GL_UNSIGNED_SHORT, nullptr);
-
-		glBindVertexArray(0);
-		glUseProgram(0);
+		FlushGizmosWithVP(Camera2DComponent::Main()->GetViewProjectionMatrix());
 	}
 
 	void GizmoRenderer2D::RenderWithVP(const glm::mat4& vp) {
@@ -287,15 +232,26 @@ namespace Bolt {
 		if (!m_IsInitialized || m_GizmoVertices.empty() || !m_GizmoShader || !m_GizmoShader->IsValid())
 			return;
 
-		ConvertVertices(m_GizmoVertices, s_UploadBuffer);
+		// Info: Vertices and indices share one streamed allocation; PosColorVertex is uploaded as-is,
+		// the packed ABGR color is read as normalized RGBA bytes.
+		const size_t vertexBytes = m_GizmoVertices.size() * sizeof(PosColorVertex);
+		const size_t indexBytes = m_GizmoIndices.size() * sizeof(uint16_t);
 
-		glBindVertexArray(m_VAO);
+		size_t offset = 0;
+		auto* data = static_cast<uint8_t*>(m_StreamingBuffer.Map(vertexBytes + indexBytes, offset));
+		if (!data)
+			return;
 
-		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-		glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(s_UploadBuffer.size() * sizeof(UploadVertex)), s_UploadBuffer.data(), GL_DYNAMIC_DRAW);
+		std::memcpy(data, m_GizmoVertices.data(), vertexBytes);
+		std::memcpy(data + vertexBytes, m_GizmoIndices.data(), indexBytes);
+		m_StreamingBuffer.Unmap();
 
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_GizmoIndices.size() * sizeof(uint16_t)), m_GizmoIndices.data(), GL_DYNAMIC_DRAW);
+		glBindVertexArray(m_VAO);
+
+		glBindBuffer(GL_ARRAY_BUFFER, m_StreamingBuffer.GetHandle());
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, GizmoVertexStride, reinterpret_cast<void*>(offset + offsetof(PosColorVertex, x)));
+		glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, GizmoVertexStride, reinterpret_cast<void*>(offset + offsetof(PosColorVertex, color)));
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_StreamingBuffer.GetHandle());
 
 		m_GizmoShader->Submit();
 
@@ -304,9 +260,10 @@ namespace Bolt {
 		}
 
 		glLineWidth(Gizmo::s_LineWidth);
-		glDrawElements(GL_LINES, static_cast<GLsizei>(m_GizmoIndices.size()), GL_UNSIGNED_SHORT, nullptr);
+		glDrawElements(GL_LINES, static_cast<GLsizei>(m_GizmoIndices.size()), GL_UNSIGNED_SHORT, reinterpret_cast<void*>(offset + vertexBytes));
 
 		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
 		glUseProgram(0);
 	}
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "Graphics/PosColorVertex.hpp"
+#include "Graphics/StreamingBuffer.hpp"
 
 #include <glm/glm.hpp>
 
@@ -34,8 +35,7 @@ namespace Bolt {
         static uint16_t m_GizmoViewId;
 
         static unsigned int m_VAO;
-        static unsigned int m_VBO;
-        static unsigned int m_EBO;
+        static StreamingBuffer m_StreamingBuffer;
         static int m_uMVP;
     };
 }
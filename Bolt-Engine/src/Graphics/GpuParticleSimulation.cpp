@@ -0,0 +1,225 @@
+#include "pch.hpp"
+#include "Graphics/GpuParticleSimulation.hpp"
+#include "Serialization/Path.hpp"
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace Bolt {
+	std::optional<Shader> GpuParticleSimulation::s_UpdateProgram;
+
+	namespace {
+		struct UpdateUniforms {
+			GLint DeltaTime = -1, Gravity = -1;
+			GLint EmitStart = -1, EmitCount = -1, Capacity = -1, Seed = -1;
+			GLint LifeTime = -1, Velocity = -1, Scale = -1, Color = -1, UseRandomColors = -1;
+			GLint ShapeType = -1, ShapeParams = -1;
+			GLint WorldSpace = -1, EmitterPosition = -1, EmitterScale = -1, EmitterRotation = -1;
+		};
+		UpdateUniforms s_Uniforms;
+
+		constexpr GLsizei k_Stride = static_cast<GLsizei>(sizeof(GpuParticleVertex));
+	}
+
+	GpuParticleSimulation::~GpuParticleSimulation() {
+		Release();
+	}
+
+	GpuParticleSimulation& GpuParticleSimulation::operator=(const GpuParticleSimulation& other) {
+		if (this != &other) {
+			Release();
+		}
+		return *this;
+	}
+
+	GpuParticleSimulation::GpuParticleSimulation(GpuParticleSimulation&& other) noexcept {
+		*this = std::move(other);
+	}
+
+	GpuParticleSimulation& GpuParticleSimulation::operator=(GpuParticleSimulation&& other) noexcept {
+		if (this == &other) {
+			return *this;
+		}
+
+		Release();
+		for (int i = 0; i < 2; i++) {
+			m_Buffers[i] = other.m_Buffers[i];
+			m_VAOs[i] = other.m_VAOs[i];
+			other.m_Buffers[i] = 0;
+			other.m_VAOs[i] = 0;
+		}
+		m_Capacity = other.m_Capacity;
+		m_Current = other.m_Current;
+		m_EmitCursor = other.m_EmitCursor;
+		other.m_Capacity = other.m_Current = other.m_EmitCursor = 0;
+		return *this;
+	}
+
+	bool GpuParticleSimulation::IsSupported() {
+		return s_UpdateProgram.has_value() && s_UpdateProgram->IsValid();
+	}
+
+	void GpuParticleSimulation::InitializeProgram() {
+		if (s_UpdateProgram.has_value()) {
+			return;
+		}
+
+		std::string shaderDir = Path::ResolveBoltAssets("Shader");
+		if (shaderDir.empty()) {
+			BT_CORE_ERROR("BoltAssets/Shader not found");
+			shaderDir = Path::Combine(Path::ExecutableDir(), "BoltAssets", "Shader");
+		}
+
+		s_UpdateProgram.emplace(Shader::TransformFeedback(Path::Combine(shaderDir, "2D/particle_update.vert.glsl"),
+			{ "tfPosition", "tfScale", "tfRotation", "tfColor", "tfVelocity", "tfLifeTime" }));
+
+		if (!s_UpdateProgram->IsValid()) {
+			BT_CORE_ERROR_TAG("GpuParticles", "Failed to create particle update program, GPU simulation falls back to CPU");
+			return;
+		}
+
+		GLuint handle = s_UpdateProgram->GetHandle();
+		s_Uniforms.DeltaTime = glGetUniformLocation(handle, "uDeltaTime");
+		s_Uniforms.Gravity = glGetUniformLocation(handle, "uGravity");
+		s_Uniforms.EmitStart = glGetUniformLocation(handle, "uEmitStart");
+		s_Uniforms.EmitCount = glGetUniformLocation(handle, "uEmitCount");
+		s_Uniforms.Capacity = glGetUniformLocation(handle, "uCapacity");
+		s_Uniforms.Seed = glGetUniformLocation(handle, "uSeed");
+		s_Uniforms.LifeTime = glGetUniformLocation(handle, "uLifeTime");
+		s_Uniforms.Velocity = glGetUniformLocation(handle, "uVelocity");
+		s_Uniforms.Scale = glGetUniformLocation(handle, "uScale");
+		s_Uniforms.Color = glGetUniformLocation(handle, "uColor");
+		s_Uniforms.UseRandomColors = glGetUniformLocation(handle, "uUseRandomColors");
+		s_Uniforms.ShapeType = glGetUniformLocation(handle, "uShapeType");
+		s_Uniforms.ShapeParams = glGetUniformLocation(handle, "uShapeParams");
+		s_Uniforms.WorldSpace = glGetUniformLocation(handle, "uWorldSpace");
+		s_Uniforms.EmitterPosition = glGetUniformLocation(handle, "uEmitterPosition");
+		s_Uniforms.EmitterScale = glGetUniformLocation(handle, "uEmitterScale");
+		s_Uniforms.EmitterRotation = glGetUniformLocation(handle, "uEmitterRotation");
+	}
+
+	void GpuParticleSimulation::ShutdownProgram() {
+		s_UpdateProgram.reset();
+		s_Uniforms = UpdateUniforms{};
+	}
+
+	void GpuParticleSimulation::EnsureCapacity(uint32_t capacity) {
+		if (capacity == 0) {
+			Release();
+			return;
+		}
+		if (IsInitialized() && capacity == m_Capacity) {
+			return;
+		}
+
+		Release();
+		Allocate(capacity);
+	}
+
+	void GpuParticleSimulation::Step(float deltaTime, const Vec2& gravity, const GpuParticleEmitParams& emit) {
+		if (!IsInitialized() || !IsSupported()) {
+			return;
+		}
+
+		const uint32_t emitCount = std::min(emit.Count, m_Capacity);
+		const uint32_t next = 1 - m_Current;
+
+		s_UpdateProgram->Submit();
+		glUniform1f(s_Uniforms.DeltaTime, deltaTime);
+		glUniform2f(s_Uniforms.Gravity, gravity.x, gravity.y);
+		glUniform1ui(s_Uniforms.EmitStart, m_EmitCursor);
+		glUniform1ui(s_Uniforms.EmitCount, emitCount);
+		glUniform1ui(s_Uniforms.Capacity, m_Capacity);
+		glUniform1ui(s_Uniforms.Seed, emit.Seed);
+		glUniform1f(s_Uniforms.LifeTime, emit.LifeTime);
+		glUniform2f(s_Uniforms.Velocity, emit.Velocity.x, emit.Velocity.y);
+		glUniform2f(s_Uniforms.Scale, emit.Scale.x, emit.Scale.y);
+		glUniform4f(s_Uniforms.Color, emit.Color.r, emit.Color.g, emit.Color.b, emit.Color.a);
+		glUniform1i(s_Uniforms.UseRandomColors, emit.UseRandomColors ? 1 : 0);
+		glUniform1i(s_Uniforms.ShapeType, emit.ShapeType);
+		glUniform2f(s_Uniforms.ShapeParams, emit.ShapeParams.x, emit.ShapeParams.y);
+		glUniform1i(s_Uniforms.WorldSpace, emit.WorldSpace ? 1 : 0);
+		glUniform2f(s_Uniforms.EmitterPosition, emit.EmitterPosition.x, emit.EmitterPosition.y);
+		glUniform2f(s_Uniforms.EmitterScale, emit.EmitterScale.x, emit.EmitterScale.y);
+		glUniform1f(s_Uniforms.EmitterRotation, emit.EmitterRotation);
+
+		glEnable(GL_RASTERIZER_DISCARD);
+		glBindVertexArray(m_VAOs[m_Current]);
+		glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, m_Buffers[next]);
+
+		glBeginTransformFeedback(GL_POINTS);
+		glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(m_Capacity));
+		glEndTransformFeedback();
+
+		glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+		glBindVertexArray(0);
+		glDisable(GL_RASTERIZER_DISCARD);
+		glUseProgram(0);
+
+		m_Current = next;
+		m_EmitCursor = (m_EmitCursor + emitCount) % m_Capacity;
+	}
+
+	void GpuParticleSimulation::Reset() {
+		if (!IsInitialized()) {
+			return;
+		}
+
+		const uint32_t capacity = m_Capacity;
+		Release();
+		Allocate(capacity);
+	}
+
+	void GpuParticleSimulation::Release() {
+		if (m_VAOs[0] != 0) {
+			glDeleteVertexArrays(2, m_VAOs);
+		}
+		if (m_Buffers[0] != 0) {
+			glDeleteBuffers(2, m_Buffers);
+		}
+
+		m_VAOs[0] = m_VAOs[1] = 0;
+		m_Buffers[0] = m_Buffers[1] = 0;
+		m_Capacity = 0;
+		m_Current = 0;
+		m_EmitCursor = 0;
+	}
+
+	void GpuParticleSimulation::Allocate(uint32_t capacity) {
+		// Info: Zeroed slots read as dead particles with a zero sized quad, this is the only upload the ring ever gets
+		const GLsizeiptr bytes = static_cast<GLsizeiptr>(capacity) * k_Stride;
+
+		const std::vector<GpuParticleVertex> zero(capacity, GpuParticleVertex{});
+
+		glGenBuffers(2, m_Buffers);
+		glGenVertexArrays(2, m_VAOs);
+
+		for (int i = 0; i < 2; i++) {
+			glBindVertexArray(m_VAOs[i]);
+			glBindBuffer(GL_ARRAY_BUFFER, m_Buffers[i]);
+			glBufferData(GL_ARRAY_BUFFER, bytes, zero.data(), GL_DYNAMIC_COPY);
+
+			glEnableVertexAttribArray(0);
+			glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, k_Stride, reinterpret_cast<void*>(offsetof(GpuParticleVertex, x)));
+			glEnableVertexAttribArray(1);
+			glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, k_Stride, reinterpret_cast<void*>(offsetof(GpuParticleVertex, scaleX)));
+			glEnableVertexAttribArray(2);
+			glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, k_Stride, reinterpret_cast<void*>(offsetof(GpuParticleVertex, rotation)));
+			glEnableVertexAttribArray(3);
+			glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, k_Stride, reinterpret_cast<void*>(offsetof(GpuParticleVertex, r)));
+			glEnableVertexAttribArray(4);
+			glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, k_Stride, reinterpret_cast<void*>(offsetof(GpuParticleVertex, velocityX)));
+			glEnableVertexAttribArray(5);
+			glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, k_Stride, reinterpret_cast<void*>(offsetof(GpuParticleVertex, lifeTime)));
+		}
+
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		m_Capacity = capacity;
+		m_Current = 0;
+		m_EmitCursor = 0;
+	}
+}
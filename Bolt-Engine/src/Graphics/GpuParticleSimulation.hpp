@@ -0,0 +1,78 @@
+#pragma once
+#include "Collections/Vec2.hpp"
+#include "Collections/Color.hpp"
+#include "Core/Export.hpp"
+#include "Graphics/Shader.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace Bolt {
+	// Info: Per-particle state written by the transform feedback pass, the render pass reads it as instance data
+	struct GpuParticleVertex {
+		float x, y;
+		float scaleX, scaleY;
+		float rotation;
+		float r, g, b, a;
+		float velocityX, velocityY;
+		float lifeTime;
+	};
+
+	struct GpuParticleEmitParams {
+		uint32_t Count = 0;
+		uint32_t Seed = 0;
+		float LifeTime = 1.0f;
+		Vec2 Velocity{ 0.0f, 0.0f };
+		Vec2 Scale{ 1.0f, 1.0f };
+		Color Color{};
+		bool UseRandomColors = false;
+		int ShapeType = 0;			// Info: 0 = circle, 1 = square
+		Vec2 ShapeParams{ 1.0f, 0.0f };
+		bool WorldSpace = true;
+		Vec2 EmitterPosition{ 0.0f, 0.0f };
+		Vec2 EmitterScale{ 1.0f, 1.0f };
+		float EmitterRotation = 0.0f;
+	};
+
+	// Info: Particle ring that lives entirely in two ping-pong GL buffers. Each Step() respawns the next
+	// Count slots of the ring and integrates the rest in a transform feedback pass, so the CPU never
+	// touches particle data. When the ring is full the oldest particles are recycled first.
+	// Copies start empty; GL objects are never shared between components.
+	class BOLT_API GpuParticleSimulation {
+	public:
+		GpuParticleSimulation() = default;
+		~GpuParticleSimulation();
+
+		GpuParticleSimulation(const GpuParticleSimulation&) {}
+		GpuParticleSimulation& operator=(const GpuParticleSimulation& other);
+		GpuParticleSimulation(GpuParticleSimulation&& other) noexcept;
+		GpuParticleSimulation& operator=(GpuParticleSimulation&& other) noexcept;
+
+		static bool IsSupported();
+		static void InitializeProgram();
+		static void ShutdownProgram();
+
+		// Info: Reallocates (and clears) the ring when capacity changes
+		void EnsureCapacity(uint32_t capacity);
+		void Step(float deltaTime, const Vec2& gravity, const GpuParticleEmitParams& emit);
+		void Reset();
+		void Release();
+
+		bool IsInitialized() const { return m_Buffers[0] != 0; }
+		uint32_t GetCapacity() const { return m_Capacity; }
+		// Info: Buffer holding the latest state, laid out as GpuParticleVertex
+		unsigned GetRenderBuffer() const { return m_Buffers[m_Current]; }
+
+	private:
+		void Allocate(uint32_t capacity);
+
+		unsigned m_Buffers[2]{ 0, 0 };
+		unsigned m_VAOs[2]{ 0, 0 };
+		uint32_t m_Capacity = 0;
+		uint32_t m_Current = 0;
+		uint32_t m_EmitCursor = 0;
+
+		static std::optional<Shader> s_UpdateProgram;
+	};
+}
@@ -1,5 +1,6 @@
 #include "pch.hpp"
 #include "QuadMesh.hpp"
+#include "Graphics/GpuParticleSimulation.hpp"
 #include <glad/glad.h>
 
 namespace Bolt {
@@ -17,6 +18,8 @@ namespace Bolt {
         };
 
         constexpr unsigned short QUAD_INDICES[6] = { 0, 1, 2, 0, 2, 3 };
+
+        constexpr GLsizei InstanceStride = static_cast<GLsizei>(sizeof(SpriteInstanceVertex));
     }
 
     void QuadMesh::Initialize() {
@@ -42,9 +45,36 @@ namespace Bolt {
         glEnableVertexAttribArray(1);
         glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(V2UV), reinterpret_cast<void*>(offsetof(V2UV, u)));
 
-        glDisableVertexAttribArray(2);
+        glDisableVertexAttribArray(k_SpriteColorLocation);
+
+        glBindVertexArray(0);
+    }
+
+    void QuadMesh::InitializeInstancing(size_t initialCapacity) {
+        if (m_VAO == 0 || m_InstanceBuffer.IsInitialized()) {
+            return;
+        }
+
+        m_InstanceBuffer.Initialize((initialCapacity > 0 ? initialCapacity : 1) * sizeof(SpriteInstanceVertex));
+
+        glBindVertexArray(m_VAO);
+
+        const GLuint locations[] = {
+            k_SpriteColorLocation,
+            k_SpriteInstancePositionLocation,
+            k_SpriteInstanceScaleLocation,
+            k_SpriteInstanceRotationLocation,
+            k_SpriteInstanceUVRectLocation,
+            k_SpriteInstanceAtlasLayerLocation
+        };
+        for (GLuint location : locations) {
+            glEnableVertexAttribArray(location);
+            glVertexAttribDivisor(location, 1);
+        }
+        SetInstanceAttributeOffset(0);
 
         glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
     void QuadMesh::Bind() const {
@@ -59,7 +89,79 @@ namespace Bolt {
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
     }
 
+    SpriteInstanceVertex* QuadMesh::MapInstances(size_t count) {
+        if (!m_InstanceBuffer.IsInitialized() || count == 0) {
+            return nullptr;
+        }
+
+        // Info: Writes go straight into GPU-visible memory, DrawInstanced() offsets into this allocation.
+        void* data = m_InstanceBuffer.Map(count * sizeof(SpriteInstanceVertex), m_InstanceBaseOffset);
+        return static_cast<SpriteInstanceVertex*>(data);
+    }
+
+    void QuadMesh::UnmapInstances() {
+        m_InstanceBuffer.Unmap();
+    }
+
+    void QuadMesh::DrawInstanced(size_t firstInstance, size_t instanceCount) const {
+        if (!m_InstanceBuffer.IsInitialized() || instanceCount == 0) {
+            return;
+        }
+
+        // Info: GL 3.3 has no base-instance draw, so the instance attributes are re-pointed per run instead.
+        SetInstanceAttributeOffset(firstInstance);
+        glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr, static_cast<GLsizei>(instanceCount));
+    }
+
+    void QuadMesh::DrawInstancedFromParticleBuffer(unsigned buffer, size_t instanceCount, const float uvRect[4], float atlasLayer) const {
+        if (!m_InstanceBuffer.IsInitialized() || buffer == 0 || instanceCount == 0) {
+            return;
+        }
+
+        constexpr GLsizei particleStride = static_cast<GLsizei>(sizeof(GpuParticleVertex));
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glVertexAttribPointer(k_SpriteInstancePositionLocation, 2, GL_FLOAT, GL_FALSE, particleStride,
+            reinterpret_cast<void*>(offsetof(GpuParticleVertex, x)));
+        glVertexAttribPointer(k_SpriteInstanceScaleLocation, 2, GL_FLOAT, GL_FALSE, particleStride,
+            reinterpret_cast<void*>(offsetof(GpuParticleVertex, scaleX)));
+        glVertexAttribPointer(k_SpriteInstanceRotationLocation, 1, GL_FLOAT, GL_FALSE, particleStride,
+            reinterpret_cast<void*>(offsetof(GpuParticleVertex, rotation)));
+        glVertexAttribPointer(k_SpriteColorLocation, 4, GL_FLOAT, GL_FALSE, particleStride,
+            reinterpret_cast<void*>(offsetof(GpuParticleVertex, r)));
+
+        glDisableVertexAttribArray(k_SpriteInstanceUVRectLocation);
+        glDisableVertexAttribArray(k_SpriteInstanceAtlasLayerLocation);
+        glVertexAttrib4f(k_SpriteInstanceUVRectLocation, uvRect[0], uvRect[1], uvRect[2], uvRect[3]);
+        glVertexAttrib1f(k_SpriteInstanceAtlasLayerLocation, atlasLayer);
+
+        glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr, static_cast<GLsizei>(instanceCount));
+
+        glEnableVertexAttribArray(k_SpriteInstanceUVRectLocation);
+        glEnableVertexAttribArray(k_SpriteInstanceAtlasLayerLocation);
+    }
+
+    void QuadMesh::SetInstanceAttributeOffset(size_t firstInstance) const {
+        const size_t base = m_InstanceBaseOffset + firstInstance * sizeof(SpriteInstanceVertex);
+
+        glBindBuffer(GL_ARRAY_BUFFER, m_InstanceBuffer.GetHandle());
+        glVertexAttribPointer(k_SpriteInstancePositionLocation, 2, GL_FLOAT, GL_FALSE, InstanceStride,
+            reinterpret_cast<void*>(base + offsetof(SpriteInstanceVertex, x)));
+        glVertexAttribPointer(k_SpriteInstanceScaleLocation, 2, GL_FLOAT, GL_FALSE, InstanceStride,
+            reinterpret_cast<void*>(base + offsetof(SpriteInstanceVertex, scaleX)));
+        glVertexAttribPointer(k_SpriteInstanceRotationLocation, 1, GL_FLOAT, GL_FALSE, InstanceStride,
+            reinterpret_cast<void*>(base + offsetof(SpriteInstanceVertex, rotation)));
+        glVertexAttribPointer(k_SpriteColorLocation, 4, GL_FLOAT, GL_FALSE, InstanceStride,
+            reinterpret_cast<void*>(base + offsetof(SpriteInstanceVertex, r)));
+        glVertexAttribPointer(k_SpriteInstanceUVRectLocation, 4, GL_FLOAT, GL_FALSE, InstanceStride,
+            reinterpret_cast<void*>(base + offsetof(SpriteInstanceVertex, uvOffsetX)));
+        glVertexAttribPointer(k_SpriteInstanceAtlasLayerLocation, 1, GL_FLOAT, GL_FALSE, InstanceStride,
+            reinterpret_cast<void*>(base + offsetof(SpriteInstanceVertex, atlasLayer)));
+    }
+
     void QuadMesh::Shutdown() {
+        m_InstanceBuffer.Shutdown();
+        m_InstanceBaseOffset = 0;
         if (m_EBO) {
             glDeleteBuffers(1, &m_EBO);
             m_EBO = 0;
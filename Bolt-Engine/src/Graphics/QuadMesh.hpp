@@ -1,17 +1,36 @@
 #pragma once
+#include "Graphics/SpriteInstanceVertex.hpp"
+#include "Graphics/StreamingBuffer.hpp"
+
+#include <cstddef>
+#include <cstdint>
 
 namespace Bolt {
     class QuadMesh {
     public:
         void Initialize();
+        void InitializeInstancing(size_t initialCapacity = 1024);
         void Bind() const;
         void Unbind() const;
         void Draw() const;
         void Shutdown();
 
+        SpriteInstanceVertex* MapInstances(size_t count);
+        void UnmapInstances();
+        void DrawInstanced(size_t firstInstance, size_t instanceCount) const;
+        // Info: Draws instanceCount instances straight from a GpuParticleVertex buffer written on the GPU;
+        // UV rect and atlas layer are constant for the whole draw.
+        void DrawInstancedFromParticleBuffer(unsigned buffer, size_t instanceCount, const float uvRect[4], float atlasLayer) const;
+
+        bool HasInstancing() const { return m_InstanceBuffer.IsInitialized(); }
+
     private:
+        void SetInstanceAttributeOffset(size_t firstInstance) const;
+
         unsigned m_VAO{ 0 };
         unsigned m_VBO{ 0 };
         unsigned m_EBO{ 0 };
+        StreamingBuffer m_InstanceBuffer;
+        size_t m_InstanceBaseOffset{ 0 };
     };
-}
\ No newline at end of file
+}
@@ -9,9 +9,14 @@
 #include "Components/Graphics/Camera2DComponent.hpp"
 #include "Components/Tags.hpp"
 #include <Utils/Timer.hpp>
+#include <Utils/RadixSort.hpp>
+#include "Core/JobSystem.hpp"
+
+#include <algorithm>
 
 #include "Scene/Scene.hpp"
 #include "Graphics/TextureManager.hpp"
+#include "Graphics/GpuParticleSimulation.hpp"
 
 #include <glad/glad.h>
 
@@ -30,8 +35,11 @@ namespace Bolt {
 
 	void Renderer2D::Initialize() {
 		m_QuadMesh.Initialize();
+		m_QuadMesh.InitializeInstancing(512);
 		m_SpriteShader.Initialize();
+		GpuParticleSimulation::InitializeProgram();
 		m_Instances.reserve(512);
+		m_SortKeys.reserve(512);
 
 		if (!m_SpriteShader.IsValid()) {
 			BT_CORE_ERROR_TAG("Renderer2D", "Sprite shader is invalid — rendering disabled");
@@ -64,8 +72,10 @@ namespace Bolt {
 			glClear(GL_COLOR_BUFFER_BIT);
 			if (m_IsInitialized && m_IsEnabled)
 				RenderScenes();
-			else
+			else {
 				m_RenderedInstancesCount = 0;
+				m_DrawCallCount = 0;
+			}
 
 			glBindFramebuffer(GL_FRAMEBUFFER, 0);
 			glViewport(0, 0, savedW, savedH);
@@ -81,8 +91,10 @@ namespace Bolt {
 			glClear(GL_COLOR_BUFFER_BIT);
 			if (m_IsInitialized && m_IsEnabled)
 				RenderScenes();
-			else
+			else {
 				m_RenderedInstancesCount = 0;
+				m_DrawCallCount = 0;
+			}
 		}
 
 		m_RenderLoopDuration = timer.ElapsedMilliseconds();
@@ -127,35 +139,124 @@ namespace Bolt {
 		m_SpriteShader.Bind();
 		m_SpriteShader.SetMVP(vp);
 
+		const entt::registry& registry = scene.GetRegistry();
+
+		SpatialIndex2D& spatialIndex = scene.GetSpatialIndex();
+		spatialIndex.Flush(registry);
+		spatialIndex.Query(viewportAABB, m_VisibleSprites);
+
+		// Info: Particles and visible sprites form one item range [particles..., sprites...] that is culled in parallel chunks
+		m_ParticleSystems.clear();
+		m_ParticleOffsets.clear();
+		m_GpuEmitters.clear();
+		size_t particleCount = 0;
+		auto ptsView = registry.view<ParticleSystem2DComponent>(entt::exclude<DisabledTag>);
+		for (const auto& [ent, particleSystem] : ptsView.each()) {
+			if (particleSystem.UsesGpuSimulation() && particleSystem.m_GpuSimulation.IsInitialized()) {
+				m_GpuEmitters.push_back({
+					SpriteSortKey::MakeOrderPrefix(particleSystem.RenderingSettings.SortingLayer, particleSystem.RenderingSettings.SortingOrder),
+					&particleSystem.m_GpuSimulation,
+					particleSystem.m_TextureHandle
+				});
+			}
+
+			const size_t count = particleSystem.GetParticles().Size();
+			if (count == 0) continue;
+
+			m_ParticleSystems.push_back(&particleSystem);
+			m_ParticleOffsets.push_back(particleCount);
+			particleCount += count;
+		}
+
+		const size_t itemCount = particleCount + m_VisibleSprites.size();
+		const size_t chunkCount = JobSystem::GetChunkCount(itemCount, k_MinInstancesPerChunk);
+		if (m_ChunkInstances.size() < chunkCount) {
+			m_ChunkInstances.resize(chunkCount);
+		}
+
+		JobSystem::ParallelFor(itemCount, k_MinInstancesPerChunk, [&](size_t begin, size_t end, size_t chunkIndex) {
+			CollectInstanceRange(registry, viewportAABB, particleCount, begin, end, m_ChunkInstances[chunkIndex]);
+		});
+
 		m_Instances.clear();
+		for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+			const std::vector<Instance44>& chunkInstances = m_ChunkInstances[chunk];
+			m_Instances.insert(m_Instances.end(), chunkInstances.begin(), chunkInstances.end());
+		}
 
-		auto ptsView = scene.GetRegistry().view<ParticleSystem2DComponent>(entt::exclude<DisabledTag>);
-		auto srView = scene.GetRegistry().view<Transform2DComponent, SpriteRendererComponent>(entt::exclude<DisabledTag>);
+		if (m_Instances.size() > SpriteSortKey::k_MaxInstances) {
+			BT_CORE_WARN_TAG("Renderer2D", "{} visible instances exceed the sort key limit of {}, the rest is dropped",
+				m_Instances.size(), SpriteSortKey::k_MaxInstances);
+			m_Instances.resize(SpriteSortKey::k_MaxInstances);
+		}
 
-		m_Instances.reserve(ptsView.size_hint() + srView.size_hint());
+		m_SortKeys.resize(m_Instances.size());
+		JobSystem::ParallelFor(m_Instances.size(), k_MinInstancesPerChunk, [this](size_t begin, size_t end, size_t) {
+			TextureHandle keyHandle = TextureHandle::Invalid();
+			uint16_t textureKey = UINT16_MAX;
+			for (size_t i = begin; i < end; i++) {
+				const Instance44& instance = m_Instances[i];
+				if (i == begin || instance.TextureHandle != keyHandle) {
+					keyHandle = instance.TextureHandle;
+					textureKey = SpriteSortKey::TextureKey(keyHandle.index, TextureManager::GetAtlasRegion(keyHandle) != nullptr);
+				}
+
+				m_SortKeys[i] = SpriteSortKey::Make(instance.SortingLayer, instance.SortingOrder, textureKey, static_cast<uint32_t>(i));
+			}
+		});
 
-		for (const auto& [ent, particleSystem] : ptsView.each()) {
-			for (const auto& particle : particleSystem.GetParticles()) {
-				if (!AABB::Intersects(viewportAABB, AABB::FromTransform(particle.Transform)))
-					continue;
-
-				m_Instances.emplace_back(
-					particle.Transform.Position,
-					particle.Transform.Scale,
-					particle.Transform.Rotation,
-					particle.Color,
-					particleSystem.m_TextureHandle,
-					particleSystem.RenderingSettings.SortingOrder,
-					particleSystem.RenderingSettings.SortingLayer
-				);
+		RadixSort64(m_SortKeys, m_SortScratch, SpriteSortKey::k_FirstSortedByte, SpriteSortKey::k_LastSortedByte);
+		std::stable_sort(m_GpuEmitters.begin(), m_GpuEmitters.end(),
+			[](const GpuEmitterDraw& a, const GpuEmitterDraw& b) { return a.OrderPrefix < b.OrderPrefix; });
+
+		SubmitInstanceBatches();
+
+		m_SpriteShader.Unbind();
+		m_RenderedInstancesCount = m_Instances.size();
+	}
+
+	void Renderer2D::CollectInstanceRange(const entt::registry& registry, const AABB& viewportAABB, size_t particleCount,
+		size_t begin, size_t end, std::vector<Instance44>& outInstances) const {
+		outInstances.clear();
+
+		size_t item = begin;
+		if (item < particleCount) {
+			size_t system = static_cast<size_t>(std::upper_bound(m_ParticleOffsets.begin(), m_ParticleOffsets.end(), item) - m_ParticleOffsets.begin()) - 1;
+
+			const size_t particleEnd = std::min(end, particleCount);
+			while (item < particleEnd) {
+				const ParticleSystem2DComponent& particleSystem = *m_ParticleSystems[system];
+				const ParticleBuffer& particles = particleSystem.GetParticles();
+				const size_t systemBegin = m_ParticleOffsets[system];
+				const size_t systemEnd = std::min(particleEnd, systemBegin + particles.Size());
+
+				for (; item < systemEnd; item++) {
+					const size_t particle = item - systemBegin;
+					const Transform2DComponent transform(particles.GetPosition(particle), particles.GetScale(particle), particles.GetRotation(particle));
+					if (!AABB::Intersects(viewportAABB, AABB::FromTransform(transform)))
+						continue;
+
+					outInstances.emplace_back(
+						transform.Position,
+						transform.Scale,
+						transform.Rotation,
+						particles.GetColor(particle),
+						particleSystem.m_TextureHandle,
+						particleSystem.RenderingSettings.SortingOrder,
+						particleSystem.RenderingSettings.SortingLayer
+					);
+				}
+				system++;
 			}
 		}
 
-		for (const auto& [ent, tr, spriteRenderer] : srView.each()) {
-			if (!AABB::Intersects(viewportAABB, AABB::FromTransform(tr)))
+		for (; item < end; item++) {
+			EntityHandle ent = m_VisibleSprites[item - particleCount];
+			if (registry.all_of<DisabledTag>(ent))
 				continue;
 
-			m_Instances.emplace_back(
+			const auto& [tr, spriteRenderer] = registry.get<Transform2DComponent, SpriteRendererComponent>(ent);
+			outInstances.emplace_back(
 				tr.Position,
 				tr.Scale,
 				tr.Rotation,
@@ -165,49 +266,143 @@ namespace Bolt {
 				spriteRenderer.SortingLayer
 			);
 		}
+	}
 
-		std::sort(m_Instances.begin(), m_Instances.end(),
-			[](const Instance44& a, const Instance44& b) {
-				if (a.SortingLayer != b.SortingLayer)
-					return a.SortingLayer < b.SortingLayer;
-				if (a.SortingOrder != b.SortingOrder)
-					return a.SortingOrder < b.SortingOrder;
+	void Renderer2D::SubmitInstanceBatches() {
+		m_DrawCallCount = 0;
+		if (m_Instances.empty() && m_GpuEmitters.empty()) {
+			return;
+		}
 
-				return false;
-			});
+		SpriteInstanceVertex* vertices = nullptr;
+		if (!m_Instances.empty()) {
+			vertices = m_QuadMesh.MapInstances(m_Instances.size());
+			if (!vertices) {
+				return;
+			}
+		}
 
+		// Info: Keys are already sorted. Atlased sprites never need a rebind, so a batch
+		// only ends when a second non-atlased texture would have to be bound to unit 0,
+		// or when a GPU emitter has to be drawn between two layer/order ranges.
+		m_Batches.clear();
+		size_t gpuCursor = 0;
+
+		TextureHandle regionHandle = TextureHandle::Invalid();
+		const AtlasRegion* region = nullptr;
+		// Info: Gather the instance payload once, in sorted order, straight into the mapped buffer.
+		for (size_t i = 0; i < m_SortKeys.size(); i++) {
+			const Instance44& instance = m_Instances[SpriteSortKey::GetIndex(m_SortKeys[i])];
+			if (instance.TextureHandle != regionHandle) {
+				regionHandle = instance.TextureHandle;
+				region = TextureManager::GetAtlasRegion(regionHandle);
+			}
+
+			const uint32_t orderPrefix = SpriteSortKey::GetOrderPrefix(m_SortKeys[i]);
+			bool crossesGpuEmitter = false;
+			while (gpuCursor < m_GpuEmitters.size() && m_GpuEmitters[gpuCursor].OrderPrefix < orderPrefix) {
+				gpuCursor++;
+				crossesGpuEmitter = true;
+			}
+
+			const bool textureConflict = !region && !m_Batches.empty()
+				&& m_Batches.back().Texture.IsValid() && m_Batches.back().Texture != instance.TextureHandle;
+			if (m_Batches.empty() || crossesGpuEmitter || textureConflict)
+				m_Batches.push_back({ i, 0, TextureHandle::Invalid(), orderPrefix });
+
+			InstanceBatch& batch = m_Batches.back();
+			if (!region && !batch.Texture.IsValid())
+				batch.Texture = instance.TextureHandle;
+			batch.Count++;
+
+			SpriteInstanceVertex& vertex = vertices[i];
+			vertex.x = instance.Position.x;
+			vertex.y = instance.Position.y;
+			vertex.scaleX = instance.Scale.x;
+			vertex.scaleY = instance.Scale.y;
+			vertex.rotation = instance.Rotation;
+			vertex.r = instance.Color.r;
+			vertex.g = instance.Color.g;
+			vertex.b = instance.Color.b;
+			vertex.a = instance.Color.a;
+
+			if (region) {
+				vertex.uvOffsetX = region->UVOffset.x;
+				vertex.uvOffsetY = region->UVOffset.y;
+				vertex.uvScaleX = region->UVScale.x;
+				vertex.uvScaleY = region->UVScale.y;
+				vertex.atlasLayer = static_cast<float>(region->Layer);
+			}
+			else {
+				vertex.uvOffsetX = 0.0f;
+				vertex.uvOffsetY = 0.0f;
+				vertex.uvScaleX = 1.0f;
+				vertex.uvScaleY = 1.0f;
+				vertex.atlasLayer = -1.0f;
+			}
+		}
+
+		if (vertices) {
+			m_QuadMesh.UnmapInstances();
+		}
 		m_QuadMesh.Bind();
+		TextureManager::SubmitAtlas(1);
 		glActiveTexture(GL_TEXTURE0);
 
-		TextureHandle currentTexture{};
-		bool hasTextureBound = false;
-
-		for (const Instance44& instance : m_Instances) {
-			m_SpriteShader.SetSpritePosition(instance.Position);
-			m_SpriteShader.SetScale(instance.Scale);
-			m_SpriteShader.SetRotation(instance.Rotation);
-			m_SpriteShader.SetVertexColor(instance.Color);
+		size_t gpuDrawn = 0;
+		for (const InstanceBatch& batch : m_Batches) {
+			while (gpuDrawn < m_GpuEmitters.size() && m_GpuEmitters[gpuDrawn].OrderPrefix < batch.OrderPrefix) {
+				DrawGpuEmitter(m_GpuEmitters[gpuDrawn++]);
+			}
 
-			if (!hasTextureBound || !(instance.TextureHandle == currentTexture)) {
-				Texture2D* texture = TextureManager::GetTexture(instance.TextureHandle);
+			if (batch.Texture.IsValid()) {
+				Texture2D* texture = TextureManager::GetTexture(batch.Texture);
 				if (texture && texture->IsValid())
 					texture->Submit(0);
-				currentTexture = instance.TextureHandle;
-				hasTextureBound = true;
 			}
 
-			m_QuadMesh.Draw();
+			m_QuadMesh.DrawInstanced(batch.First, batch.Count);
+			++m_DrawCallCount;
+		}
+
+		while (gpuDrawn < m_GpuEmitters.size()) {
+			DrawGpuEmitter(m_GpuEmitters[gpuDrawn++]);
 		}
 
 		m_QuadMesh.Unbind();
-		m_SpriteShader.Unbind();
-		m_RenderedInstancesCount = m_Instances.size();
+	}
+
+	void Renderer2D::DrawGpuEmitter(const GpuEmitterDraw& emitter) {
+		float uvRect[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+		float atlasLayer = -1.0f;
+
+		if (const AtlasRegion* region = TextureManager::GetAtlasRegion(emitter.Texture)) {
+			uvRect[0] = region->UVOffset.x;
+			uvRect[1] = region->UVOffset.y;
+			uvRect[2] = region->UVScale.x;
+			uvRect[3] = region->UVScale.y;
+			atlasLayer = static_cast<float>(region->Layer);
+		}
+		else if (Texture2D* texture = TextureManager::GetTexture(emitter.Texture); texture && texture->IsValid()) {
+			texture->Submit(0);
+		}
+
+		// Info: The whole ring is drawn, dead slots carry a zero scale and collapse to nothing
+		m_QuadMesh.DrawInstancedFromParticleBuffer(emitter.Simulation->GetRenderBuffer(), emitter.Simulation->GetCapacity(), uvRect, atlasLayer);
+		++m_DrawCallCount;
 	}
 
 	void Renderer2D::Shutdown() {
+		GpuParticleSimulation::ShutdownProgram();
 		m_QuadMesh.Shutdown();
 		m_SpriteShader.Shutdown();
 		m_Instances.clear();
 		m_Instances.shrink_to_fit();
+		m_Batches.clear();
+		m_Batches.shrink_to_fit();
+		m_SortKeys.clear();
+		m_SortKeys.shrink_to_fit();
+		m_SortScratch.clear();
+		m_SortScratch.shrink_to_fit();
 	}
 }
@@ -3,7 +3,9 @@
 #include "SpriteShaderProgram.hpp"
 #include "TextureHandle.hpp"
 #include "Instance44.hpp"
+#include "SpriteSortKey.hpp"
 #include "Collections/AABB.hpp"
+#include "Scene/EntityHandle.hpp"
 
 #include <glm/glm.hpp>
 #include <vector>
@@ -11,6 +13,8 @@
 
 namespace Bolt {
 	class Scene;
+	class ParticleSystem2DComponent;
+	class GpuParticleSimulation;
 
 	class Renderer2D {
 	public:
@@ -34,6 +38,7 @@ namespace Bolt {
 		void SetSkipBeginFrameRender(bool skip) { m_SkipBeginFrameRender = skip; }
 
 		size_t GetRenderedInstancesCount() const { return m_RenderedInstancesCount; }
+		size_t GetDrawCallCount() const { return m_DrawCallCount; }
 		float GetRenderLoopDuration() const { return m_RenderLoopDuration; }
 
 		using SceneProvider = std::function<void(const std::function<void(const Scene&)>&)>;
@@ -42,14 +47,43 @@ namespace Bolt {
 	private:
 		void RenderScenes();
 		void CollectAndRenderInstances(const Scene& scene, const glm::mat4& vp, const AABB& viewportAABB);
+		void CollectInstanceRange(const entt::registry& registry, const AABB& viewportAABB, size_t particleCount,
+			size_t begin, size_t end, std::vector<Instance44>& outInstances) const;
+		void SubmitInstanceBatches();
+		void DrawGpuEmitter(const GpuEmitterDraw& emitter);
+
+		// Info: Below this many items per chunk the gather runs inline instead of on the JobSystem
+		static constexpr size_t k_MinInstancesPerChunk = 4096;
 
 		size_t m_RenderedInstancesCount = 0;
+		size_t m_DrawCallCount = 0;
 		float m_RenderLoopDuration = 0.0f;
 		bool m_IsInitialized = false;
 		bool m_IsEnabled = true;
 		bool m_SkipBeginFrameRender = false;
 
+		std::vector<EntityHandle> m_VisibleSprites;
+		std::vector<const ParticleSystem2DComponent*> m_ParticleSystems;
+		std::vector<size_t> m_ParticleOffsets;
+		std::vector<std::vector<Instance44>> m_ChunkInstances;
 		std::vector<Instance44> m_Instances;
+		std::vector<uint64_t> m_SortKeys;
+		std::vector<uint64_t> m_SortScratch;
+		struct InstanceBatch {
+			size_t First;
+			size_t Count;
+			TextureHandle Texture;
+			uint32_t OrderPrefix;
+		};
+		std::vector<InstanceBatch> m_Batches;
+
+		// Info: GPU simulated emitters are drawn from their own buffers, slotted between batches by layer/order
+		struct GpuEmitterDraw {
+			uint32_t OrderPrefix;
+			const GpuParticleSimulation* Simulation;
+			TextureHandle Texture;
+		};
+		std::vector<GpuEmitterDraw> m_GpuEmitters;
 
 		unsigned int m_OutputFboId = 0;
 		int m_OutputWidth = 0;
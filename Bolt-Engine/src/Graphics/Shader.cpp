@@ -110,6 +110,45 @@ namespace Bolt {
         m_IsValid = true;
     }
 
+    Shader Shader::TransformFeedback(const std::string& vsPath, const std::vector<std::string>& varyings) {
+        GLuint vs = LoadAndCompile(GL_VERTEX_SHADER, vsPath);
+        if (vs == 0) return Shader(static_cast<GLuint>(0));
+
+        GLuint program = glCreateProgram();
+        if (program == 0) {
+            BT_ERROR_TAG("Shader", "Failed to create transform feedback program for file: " + vsPath);
+            glDeleteShader(vs);
+            return Shader(static_cast<GLuint>(0));
+        }
+
+        std::vector<const GLchar*> names;
+        names.reserve(varyings.size());
+        for (const std::string& varying : varyings) {
+            names.push_back(varying.c_str());
+        }
+
+        glAttachShader(program, vs);
+        glTransformFeedbackVaryings(program, static_cast<GLsizei>(names.size()), names.data(), GL_INTERLEAVED_ATTRIBS);
+        glLinkProgram(program);
+        glDeleteShader(vs);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (linked != GL_TRUE) {
+            GLint logLen = 0;
+            glGetProgramiv(program, GL_INFO_LOG_LENGTH, &logLen);
+            std::vector<GLchar> log(std::max(1, logLen));
+            glGetProgramInfoLog(program, logLen, nullptr, log.data());
+
+            BT_ERROR_TAG("Shader", std::string("Transform feedback link failed : ") + vsPath + "\n" + log.data());
+
+            glDeleteProgram(program);
+            return Shader(static_cast<GLuint>(0));
+        }
+
+        return Shader(program);
+    }
+
     Shader::~Shader() {
         if (m_Program != 0) {
             glDeleteProgram(m_Program);
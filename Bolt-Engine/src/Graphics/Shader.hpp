@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <cstdint>
+#include <vector>
 #include <glad/glad.h>
 
 namespace Bolt {
@@ -16,6 +17,9 @@ namespace Bolt {
             const std::string& vsPath,
             const std::string& fsPath);
 
+        // Info: Vertex-only program whose outputs are captured interleaved, in the order of varyings
+        static Shader TransformFeedback(const std::string& vsPath, const std::vector<std::string>& varyings);
+
         void Submit() const;
 
         GLuint GetHandle() const { return m_Program; }
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Bolt {
+
+	// Info: Attribute locations shared by QuadMesh and sprite.vert.glsl.
+	constexpr unsigned k_SpriteColorLocation = 2;
+	constexpr unsigned k_SpriteInstancePositionLocation = 3;
+	constexpr unsigned k_SpriteInstanceScaleLocation = 4;
+	constexpr unsigned k_SpriteInstanceRotationLocation = 5;
+	constexpr unsigned k_SpriteInstanceUVRectLocation = 6;
+	constexpr unsigned k_SpriteInstanceAtlasLayerLocation = 7;
+
+	// Info: Per-instance attributes consumed by the instanced sprite path (divisor 1).
+	struct SpriteInstanceVertex {
+		float x, y;
+		float scaleX, scaleY;
+		float rotation;
+		float r, g, b, a;
+		float uvOffsetX, uvOffsetY;
+		float uvScaleX, uvScaleY;
+		float atlasLayer; // Info: -1 samples the texture bound to unit 0 instead of the atlas.
+	};
+
+} // namespace Bolt
@@ -1,5 +1,6 @@
 #include "pch.hpp"
 #include "SpriteShaderProgram.hpp"
+#include "Graphics/SpriteInstanceVertex.hpp"
 #include "Serialization/Path.hpp"
 
 #include <glm/gtc/type_ptr.hpp>
@@ -20,9 +21,6 @@ namespace Bolt {
 
 		GLuint handle = m_Shader.value().GetHandle();
 		m_uMVP = glGetUniformLocation(handle, "uMVP");
-		m_uSpritePos = glGetUniformLocation(handle, "uSpritePos");
-		m_uScale = glGetUniformLocation(handle, "uScale");
-		m_uRotation = glGetUniformLocation(handle, "uRotation");
 		m_uUVOffset = glGetUniformLocation(handle, "uUVOffset");
 		m_uUVScale = glGetUniformLocation(handle, "uUVScale");
 		m_uPremultipliedAlpha = glGetUniformLocation(handle, "uPremultipliedAlpha");
@@ -33,6 +31,11 @@ namespace Bolt {
 			glUniform1i(locTex, 0);
 		}
 
+		int locAtlas = glGetUniformLocation(handle, "uAtlas");
+		if (locAtlas >= 0) {
+			glUniform1i(locAtlas, 1);
+		}
+
 		ApplyDefaults();
 		Unbind();
 	}
@@ -53,7 +56,7 @@ namespace Bolt {
 
 	void SpriteShaderProgram::Shutdown() {
 		m_Shader.reset();
-		m_uMVP = m_uSpritePos = m_uScale = m_uRotation = -1;
+		m_uMVP = -1;
 		m_uUVOffset = m_uUVScale = m_uPremultipliedAlpha = m_uAlphaCutoff = -1;
 	}
 
@@ -63,22 +66,17 @@ namespace Bolt {
 		}
 	}
 
+	// Info: Instance data are vertex attributes; these setters only apply while the attribute arrays are disabled.
 	void SpriteShaderProgram::SetSpritePosition(const Vec2& position) const {
-		if (m_uSpritePos >= 0) {
-			glUniform2f(m_uSpritePos, position.x, position.y);
-		}
+		glVertexAttrib2f(k_SpriteInstancePositionLocation, position.x, position.y);
 	}
 
 	void SpriteShaderProgram::SetScale(const Vec2& scale) const {
-		if (m_uScale >= 0) {
-			glUniform2f(m_uScale, scale.x, scale.y);
-		}
+		glVertexAttrib2f(k_SpriteInstanceScaleLocation, scale.x, scale.y);
 	}
 
 	void SpriteShaderProgram::SetRotation(float rotationRadians) const {
-		if (m_uRotation >= 0) {
-			glUniform1f(m_uRotation, rotationRadians);
-		}
+		glVertexAttrib1f(k_SpriteInstanceRotationLocation, rotationRadians);
 	}
 
 	void SpriteShaderProgram::SetUV(const glm::vec2& offset, const glm::vec2& scale) const {
@@ -103,10 +101,25 @@ namespace Bolt {
 	}
 
 	void SpriteShaderProgram::SetVertexColor(const Color& color) const {
-		glVertexAttrib4f(2, color.r, color.g, color.b, color.a);
+		glVertexAttrib4f(k_SpriteColorLocation, color.r, color.g, color.b, color.a);
+	}
+
+	void SpriteShaderProgram::SetAtlasRegion(const AtlasRegion* region) const {
+		if (region && region->IsValid()) {
+			glVertexAttrib4f(k_SpriteInstanceUVRectLocation, region->UVOffset.x, region->UVOffset.y, region->UVScale.x, region->UVScale.y);
+			glVertexAttrib1f(k_SpriteInstanceAtlasLayerLocation, static_cast<float>(region->Layer));
+		}
+		else {
+			glVertexAttrib4f(k_SpriteInstanceUVRectLocation, 0.0f, 0.0f, 1.0f, 1.0f);
+			glVertexAttrib1f(k_SpriteInstanceAtlasLayerLocation, -1.0f);
+		}
 	}
 
 	void SpriteShaderProgram::ApplyDefaults() const {
+		SetSpritePosition(Vec2(0.0f));
+		SetScale(Vec2(1.0f));
+		SetRotation(0.0f);
+		SetAtlasRegion(nullptr);
 		SetUV(glm::vec2(0.0f), glm::vec2(1.0f));
 		SetPremultipliedAlpha(false);
 		SetAlphaCutoff(0.0f);
@@ -3,6 +3,7 @@
 #include "Shader.hpp"
 #include "Collections/Vec2.hpp"
 #include "Collections/Color.hpp"
+#include "Graphics/TextureAtlas.hpp"
 
 #include <glm/mat4x4.hpp>
 #include <glm/vec2.hpp>
@@ -26,15 +27,13 @@ namespace Bolt {
         void SetPremultipliedAlpha(bool enabled) const;
         void SetAlphaCutoff(float cutoff) const;
         void SetVertexColor(const Color& color) const;
+        void SetAtlasRegion(const AtlasRegion* region) const;
 
     private:
         void ApplyDefaults() const;
 
         std::optional<Shader> m_Shader;
         int m_uMVP{ -1 };
-        int m_uSpritePos{ -1 };
-        int m_uScale{ -1 };
-        int m_uRotation{ -1 };
         int m_uUVOffset{ -1 };
         int m_uUVScale{ -1 };
         int m_uPremultipliedAlpha{ -1 };
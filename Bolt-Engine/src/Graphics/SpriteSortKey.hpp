@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+
+namespace Bolt {
+	// Info: Packed 64-bit draw order for sprite instances.
+	// [63..56] SortingLayer | [55..40] SortingOrder (biased) | [39..24] texture | [23..0] instance index
+	// The index makes every key unique and keeps equal layer/order/texture runs in submission order.
+	namespace SpriteSortKey {
+		constexpr int k_IndexBits = 24;
+		constexpr uint32_t k_MaxInstances = 1u << k_IndexBits;
+		constexpr uint64_t k_IndexMask = k_MaxInstances - 1;
+
+		// Info: Byte range RadixSort64 has to sort; the index bytes are already in input order.
+		constexpr int k_FirstSortedByte = k_IndexBits / 8;
+		constexpr int k_LastSortedByte = 7;
+
+		// Info: Textures that live in the shared atlas all map to the same key so they share a batch.
+		constexpr uint16_t k_AtlasTextureKey = 0;
+
+		inline uint16_t TextureKey(uint16_t textureIndex, bool isAtlased) {
+			if (isAtlased) {
+				return k_AtlasTextureKey;
+			}
+			return textureIndex == UINT16_MAX ? UINT16_MAX : static_cast<uint16_t>(textureIndex + 1);
+		}
+
+		inline uint64_t Make(uint8_t sortingLayer, short sortingOrder, uint16_t textureKey, uint32_t index) {
+			const uint16_t biasedOrder = static_cast<uint16_t>(static_cast<uint16_t>(sortingOrder) ^ 0x8000u);
+			return (static_cast<uint64_t>(sortingLayer) << 56)
+				| (static_cast<uint64_t>(biasedOrder) << 40)
+				| (static_cast<uint64_t>(textureKey) << 24)
+				| (static_cast<uint64_t>(index) & k_IndexMask);
+		}
+
+		// Info: Layer and order bits only, for interleaving draws that are not part of the key stream
+		inline uint32_t MakeOrderPrefix(uint8_t sortingLayer, short sortingOrder) {
+			return static_cast<uint32_t>(Make(sortingLayer, sortingOrder, 0, 0) >> 40);
+		}
+
+		inline uint32_t GetOrderPrefix(uint64_t key) {
+			return static_cast<uint32_t>(key >> 40);
+		}
+
+		inline uint32_t GetIndex(uint64_t key) {
+			return static_cast<uint32_t>(key & k_IndexMask);
+		}
+	}
+}
@@ -0,0 +1,170 @@
+#include "pch.hpp"
+#include "StreamingBuffer.hpp"
+
+namespace Bolt {
+	namespace {
+		constexpr size_t AlignUp(size_t value, size_t alignment) {
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+
+		size_t NextPowerOfTwo(size_t value) {
+			size_t result = 1;
+			while (result < value) {
+				result <<= 1;
+			}
+			return result;
+		}
+
+		void WaitAndDelete(GLsync& fence) {
+			if (!fence) {
+				return;
+			}
+
+			GLenum result = glClientWaitSync(fence, 0, 0);
+			while (result == GL_TIMEOUT_EXPIRED) {
+				result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+			}
+
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+	}
+
+	void StreamingBuffer::Initialize(size_t regionSize) {
+		if (m_Buffer != 0) {
+			return;
+		}
+
+		m_IsPersistent = GLAD_GL_VERSION_4_4 && glBufferStorage != nullptr;
+		Allocate(AlignUp(regionSize > 0 ? regionSize : k_Alignment, k_Alignment));
+	}
+
+	void StreamingBuffer::Shutdown() {
+		if (m_Buffer == 0) {
+			return;
+		}
+
+		Unmap();
+		Release();
+		m_RegionSize = 0;
+	}
+
+	void* StreamingBuffer::Map(size_t bytes, size_t& outOffset) {
+		outOffset = 0;
+		if (m_Buffer == 0 || bytes == 0) {
+			return nullptr;
+		}
+
+		const size_t alignedBytes = AlignUp(bytes, k_Alignment);
+		if (alignedBytes > m_RegionSize) {
+			// Info: The old storage stays alive in the driver until pending draws are done with it.
+			Release();
+			Allocate(NextPowerOfTwo(alignedBytes));
+		}
+
+		if (m_IsPersistent) {
+			if (m_Cursor + alignedBytes > m_RegionSize) {
+				RetireRegion();
+			}
+
+			outOffset = static_cast<size_t>(m_Region) * m_RegionSize + m_Cursor;
+			m_Cursor += alignedBytes;
+			return m_Persistent + outOffset;
+		}
+
+		const size_t capacity = m_RegionSize * k_RegionCount;
+		glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+		if (m_Cursor + alignedBytes > capacity) {
+			glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(capacity), nullptr, GL_STREAM_DRAW);
+			m_Cursor = 0;
+		}
+
+		void* data = glMapBufferRange(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(m_Cursor), static_cast<GLsizeiptr>(bytes),
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+		if (!data) {
+			BT_CORE_ERROR_TAG("StreamingBuffer", "Failed to map {} bytes of streaming storage", bytes);
+			return nullptr;
+		}
+
+		outOffset = m_Cursor;
+		m_Cursor += alignedBytes;
+		m_IsMapped = true;
+		return data;
+	}
+
+	void StreamingBuffer::Unmap() {
+		if (!m_IsMapped) {
+			return;
+		}
+
+		glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+		glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		m_IsMapped = false;
+	}
+
+	void StreamingBuffer::Allocate(size_t regionSize) {
+		m_RegionSize = regionSize;
+		m_Cursor = 0;
+		m_Region = 0;
+
+		const GLsizeiptr capacity = static_cast<GLsizeiptr>(m_RegionSize * k_RegionCount);
+
+		glGenBuffers(1, &m_Buffer);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+
+		if (m_IsPersistent) {
+			const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBufferStorage(GL_COPY_WRITE_BUFFER, capacity, nullptr, flags);
+			m_Persistent = static_cast<uint8_t*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, capacity, flags));
+
+			if (!m_Persistent) {
+				BT_CORE_WARN_TAG("StreamingBuffer", "Persistent mapping failed, falling back to buffer orphaning");
+				glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+				glDeleteBuffers(1, &m_Buffer);
+				m_IsPersistent = false;
+
+				glGenBuffers(1, &m_Buffer);
+				glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+			}
+		}
+
+		if (!m_IsPersistent) {
+			glBufferData(GL_COPY_WRITE_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+		}
+
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	}
+
+	void StreamingBuffer::Release() {
+		for (GLsync& fence : m_Fences) {
+			if (fence) {
+				glDeleteSync(fence);
+				fence = nullptr;
+			}
+		}
+
+		if (m_Buffer) {
+			if (m_Persistent) {
+				glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+				glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+				glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+				m_Persistent = nullptr;
+			}
+
+			glDeleteBuffers(1, &m_Buffer);
+			m_Buffer = 0;
+		}
+	}
+
+	void StreamingBuffer::RetireRegion() {
+		m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_Region = (m_Region + 1) % k_RegionCount;
+		m_Cursor = 0;
+
+		// Info: Only blocks when the GPU is still reading the region from k_RegionCount retirements ago.
+		WaitAndDelete(m_Fences[m_Region]);
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <glad/glad.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Bolt {
+	// Info: Triple-buffered ring for per-frame dynamic geometry. Uses a persistently mapped,
+	// coherent buffer when GL 4.4 is available and falls back to unsynchronized mapping with orphaning.
+	// Draws reading an allocation have to be issued before the next Map() call.
+	class StreamingBuffer {
+	public:
+		static constexpr int k_RegionCount = 3;
+		static constexpr size_t k_Alignment = 16;
+
+		StreamingBuffer() = default;
+		~StreamingBuffer() { Shutdown(); }
+
+		StreamingBuffer(const StreamingBuffer&) = delete;
+		StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+		void Initialize(size_t regionSize);
+		void Shutdown();
+
+		void* Map(size_t bytes, size_t& outOffset);
+		void Unmap();
+
+		bool IsInitialized() const { return m_Buffer != 0; }
+		bool IsPersistent() const { return m_IsPersistent; }
+		GLuint GetHandle() const { return m_Buffer; }
+		size_t GetRegionSize() const { return m_RegionSize; }
+
+	private:
+		void Allocate(size_t regionSize);
+		void Release();
+		void RetireRegion();
+
+		GLuint m_Buffer = 0;
+		size_t m_RegionSize = 0;
+		size_t m_Cursor = 0;
+		int m_Region = 0;
+		uint8_t* m_Persistent = nullptr;
+		bool m_IsPersistent = false;
+		bool m_IsMapped = false;
+		std::array<GLsync, k_RegionCount> m_Fences{};
+	};
+}
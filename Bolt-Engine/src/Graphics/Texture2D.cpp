@@ -1,6 +1,7 @@
 #include "pch.hpp"
 #include "Texture2D.hpp"
 #include <glad/glad.h>
+#include <cstring>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -61,19 +62,51 @@ namespace Bolt {
 	bool Texture2D::Load(const char* path, bool generateMipmaps, bool srgb, bool flipVertical) {
 		Destroy();
 
-		stbi_set_flip_vertically_on_load(flipVertical);
+		DecodedImage image;
+		if (!Decode(path, image, flipVertical)) {
+			BT_CORE_WARN_TAG("Texture2D", "Failed to load texture: {}", path);
+			return false;
+		}
+
+		return Create(image, generateMipmaps, srgb);
+	}
 
+	bool Texture2D::Decode(const char* path, DecodedImage& outImage, bool flipVertical) {
 		int w = 0, h = 0, n = 0;
 		unsigned char* pixels = stbi_load(path, &w, &h, &n, 0);
-		stbi_set_flip_vertically_on_load(false);
 		if (!pixels) {
-			BT_CORE_WARN_TAG("Texture2D", "Failed to load texture: {}", path);
+			return false;
+		}
+
+		// Info: stbi's own flip is a process wide flag, flipping while copying out keeps concurrent decodes independent
+		const size_t rowBytes = static_cast<size_t>(w) * static_cast<size_t>(n);
+		outImage.Pixels.resize(rowBytes * static_cast<size_t>(h));
+		if (flipVertical) {
+			for (int y = 0; y < h; y++) {
+				std::memcpy(outImage.Pixels.data() + static_cast<size_t>(h - 1 - y) * rowBytes, pixels + static_cast<size_t>(y) * rowBytes, rowBytes);
+			}
+		}
+		else {
+			std::memcpy(outImage.Pixels.data(), pixels, outImage.Pixels.size());
+		}
+		stbi_image_free(pixels);
+
+		outImage.Width = w;
+		outImage.Height = h;
+		outImage.Channels = n;
+		return true;
+	}
+
+	bool Texture2D::Create(const DecodedImage& image, bool generateMipmaps, bool srgb) {
+		Destroy();
+
+		if (image.Width <= 0 || image.Height <= 0 || image.Pixels.empty()) {
 			return false;
 		}
 
 		GLint internalFmt = GL_RGBA8;
 		GLenum dataFmt = GL_RGBA;
-		ChooseInternalAndFormat(n, srgb, internalFmt, dataFmt);
+		ChooseInternalAndFormat(image.Channels, srgb, internalFmt, dataFmt);
 
 
 		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
@@ -81,7 +114,7 @@ namespace Bolt {
 		glGenTextures(1, &m_Tex);
 		glBindTexture(GL_TEXTURE_2D, m_Tex);
 
-		glTexImage2D(GL_TEXTURE_2D, 0, internalFmt, w, h, 0, dataFmt, GL_UNSIGNED_BYTE, pixels);
+		glTexImage2D(GL_TEXTURE_2D, 0, internalFmt, image.Width, image.Height, 0, dataFmt, GL_UNSIGNED_BYTE, image.Pixels.data());
 
 		if (generateMipmaps) {
 			glGenerateMipmap(GL_TEXTURE_2D);
@@ -91,9 +124,8 @@ namespace Bolt {
 		ApplySamplerParams();
 
 		glBindTexture(GL_TEXTURE_2D, 0);
-		stbi_image_free(pixels);
 
-		m_Width = w; m_Height = h; m_Channels = n;
+		m_Width = image.Width; m_Height = image.Height; m_Channels = image.Channels;
 		return true;
 	}
 
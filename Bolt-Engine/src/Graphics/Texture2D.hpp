@@ -7,8 +7,15 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace Bolt {
+	// Info: CPU side pixels of an image file, rows bottom-up when decoded with flipVertical
+	struct DecodedImage {
+		std::vector<unsigned char> Pixels;
+		int Width = 0, Height = 0, Channels = 0;
+	};
+
 	class BOLT_API Texture2D {
 	public:
 		Texture2D() = default;
@@ -34,6 +41,11 @@ namespace Bolt {
 			bool srgb = false,
 			bool flipVertical = true);
 
+		// Info: Reads and decodes an image without touching GL or global stb state, safe on any thread
+		static bool Decode(const char* path, DecodedImage& outImage, bool flipVertical = true);
+		// Info: Uploads decoded pixels with the current sampler settings, GL thread only
+		bool Create(const DecodedImage& image, bool generateMipmaps = true, bool srgb = false);
+
 		void Submit(uint8_t unit) const;
 
 		void SetFilter(Filter filter);
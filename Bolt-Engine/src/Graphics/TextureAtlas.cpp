@@ -0,0 +1,227 @@
+#include "pch.hpp"
+#include "TextureAtlas.hpp"
+#include "Texture2D.hpp"
+
+#include <glad/glad.h>
+
+namespace Bolt {
+	namespace {
+		struct FramebufferBindingGuard {
+			GLint ReadFbo = 0;
+			GLint DrawFbo = 0;
+			GLboolean Scissor = GL_FALSE;
+
+			FramebufferBindingGuard() {
+				glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &ReadFbo);
+				glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &DrawFbo);
+				Scissor = glIsEnabled(GL_SCISSOR_TEST);
+				glDisable(GL_SCISSOR_TEST);
+			}
+
+			~FramebufferBindingGuard() {
+				glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(ReadFbo));
+				glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(DrawFbo));
+				if (Scissor) glEnable(GL_SCISSOR_TEST);
+			}
+		};
+	}
+
+	void TextureAtlas::Initialize(int pageSize) {
+		if (IsInitialized()) {
+			return;
+		}
+
+		GLint maxSize = 0;
+		glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+		m_PageSize = maxSize > 0 ? std::min(pageSize, static_cast<int>(maxSize)) : pageSize;
+
+		glGenFramebuffers(1, &m_ReadFbo);
+		glGenFramebuffers(1, &m_DrawFbo);
+	}
+
+	void TextureAtlas::Shutdown() {
+		if (m_Tex) {
+			glDeleteTextures(1, &m_Tex);
+			m_Tex = 0;
+		}
+		if (m_ReadFbo) {
+			glDeleteFramebuffers(1, &m_ReadFbo);
+			m_ReadFbo = 0;
+		}
+		if (m_DrawFbo) {
+			glDeleteFramebuffers(1, &m_DrawFbo);
+			m_DrawFbo = 0;
+		}
+
+		m_PageCount = 0;
+		m_Shelves.clear();
+		m_PageCursorY.clear();
+	}
+
+	void TextureAtlas::Clear() {
+		if (m_Tex) {
+			glDeleteTextures(1, &m_Tex);
+			m_Tex = 0;
+		}
+
+		m_PageCount = 0;
+		m_Shelves.clear();
+		m_PageCursorY.clear();
+	}
+
+	bool TextureAtlas::CanPack(const Texture2D& texture) const {
+		if (!IsInitialized() || !texture.IsValid()) {
+			return false;
+		}
+
+		// Info: Pages have no mip chain and clamp at the region border, so only point-sampled, clamped sprites qualify.
+		if (texture.GetFilter() != Filter::Point || texture.GetWrapU() != Wrap::Clamp || texture.GetWrapV() != Wrap::Clamp) {
+			return false;
+		}
+
+		const int width = static_cast<int>(texture.GetWidth());
+		const int height = static_cast<int>(texture.GetHeight());
+		return width > 0 && height > 0 && width <= k_MaxPackedSize && height <= k_MaxPackedSize;
+	}
+
+	bool TextureAtlas::Pack(const Texture2D& texture, AtlasRegion& outRegion) {
+		if (!CanPack(texture)) {
+			return false;
+		}
+
+		const int width = static_cast<int>(texture.GetWidth());
+		const int height = static_cast<int>(texture.GetHeight());
+
+		int layer = -1, x = 0, y = 0;
+		if (!Allocate(width + k_Padding * 2, height + k_Padding * 2, layer, x, y)) {
+			return false;
+		}
+		x += k_Padding;
+		y += k_Padding;
+
+		{
+			FramebufferBindingGuard guard;
+
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, m_ReadFbo);
+			glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.GetHandle(), 0);
+
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_DrawFbo);
+			glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, m_Tex, 0, layer);
+
+			glBlitFramebuffer(0, 0, width, height, x, y, x + width, y + height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+			glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+			glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, 0, 0, 0);
+		}
+
+		const float invSize = 1.0f / static_cast<float>(m_PageSize);
+		outRegion.Layer = layer;
+		outRegion.UVOffset = Vec2(static_cast<float>(x) * invSize, static_cast<float>(y) * invSize);
+		outRegion.UVScale = Vec2(static_cast<float>(width) * invSize, static_cast<float>(height) * invSize);
+		return true;
+	}
+
+	void TextureAtlas::Submit(uint8_t unit) const {
+		if (!m_Tex) return;
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, m_Tex);
+	}
+
+	bool TextureAtlas::Allocate(int width, int height, int& outLayer, int& outX, int& outY) {
+		if (width > m_PageSize || height > m_PageSize) {
+			return false;
+		}
+
+		// Info: Best-fit shelf: the lowest existing shelf that is tall enough and still has room.
+		Shelf* best = nullptr;
+		for (Shelf& shelf : m_Shelves) {
+			if (shelf.Height >= height && m_PageSize - shelf.CursorX >= width) {
+				if (!best || shelf.Height < best->Height) {
+					best = &shelf;
+				}
+			}
+		}
+
+		if (!best) {
+			int layer = -1;
+			for (int i = 0; i < m_PageCount; i++) {
+				if (m_PageSize - m_PageCursorY[i] >= height) {
+					layer = i;
+					break;
+				}
+			}
+
+			if (layer < 0) {
+				if (!AddPage()) {
+					return false;
+				}
+				layer = m_PageCount - 1;
+			}
+
+			m_Shelves.push_back({ layer, m_PageCursorY[layer], height, 0 });
+			m_PageCursorY[layer] += height;
+			best = &m_Shelves.back();
+		}
+
+		outLayer = best->Layer;
+		outX = best->CursorX;
+		outY = best->Y;
+		best->CursorX += width;
+		return true;
+	}
+
+	bool TextureAtlas::AddPage() {
+		if (m_PageCount >= k_MaxPages) {
+			return false;
+		}
+
+		const int newCount = m_PageCount + 1;
+
+		GLint previousBinding = 0;
+		glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY, &previousBinding);
+
+		GLuint newTex = 0;
+		glGenTextures(1, &newTex);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, newTex);
+		glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, m_PageSize, m_PageSize, newCount, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, 0);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, static_cast<GLuint>(previousBinding));
+
+		{
+			FramebufferBindingGuard guard;
+			const GLfloat transparent[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, m_ReadFbo);
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_DrawFbo);
+
+			for (int layer = 0; layer < newCount; layer++) {
+				glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, newTex, 0, layer);
+
+				if (layer < m_PageCount) {
+					// Info: Texture arrays can't be resized in place, carry the existing pages over on the GPU.
+					glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, m_Tex, 0, layer);
+					glBlitFramebuffer(0, 0, m_PageSize, m_PageSize, 0, 0, m_PageSize, m_PageSize, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+				}
+				else {
+					glClearBufferfv(GL_COLOR, 0, transparent);
+				}
+			}
+
+			glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, 0, 0, 0);
+			glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, 0, 0, 0);
+		}
+
+		if (m_Tex) {
+			glDeleteTextures(1, &m_Tex);
+		}
+
+		m_Tex = newTex;
+		m_PageCount = newCount;
+		m_PageCursorY.push_back(0);
+		return true;
+	}
+}
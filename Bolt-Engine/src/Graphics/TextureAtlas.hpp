@@ -0,0 +1,61 @@
+#pragma once
+#include "Collections/Vec2.hpp"
+#include "Core/Export.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Bolt {
+	class Texture2D;
+
+	struct BOLT_API AtlasRegion {
+		int Layer = -1;
+		Vec2 UVOffset{ 0.0f, 0.0f };
+		Vec2 UVScale{ 1.0f, 1.0f };
+
+		bool IsValid() const { return Layer >= 0; }
+	};
+
+	// Info: Runtime sprite atlas backed by a GL_TEXTURE_2D_ARRAY. Every layer is one shelf-packed page,
+	// so sprites on different pages still share a single binding and never split a batch.
+	class BOLT_API TextureAtlas {
+	public:
+		static constexpr int k_DefaultPageSize = 2048;
+		static constexpr int k_MaxPages = 8;
+		static constexpr int k_MaxPackedSize = 512;
+		static constexpr int k_Padding = 1;
+
+		void Initialize(int pageSize = k_DefaultPageSize);
+		void Shutdown();
+		void Clear();
+
+		bool CanPack(const Texture2D& texture) const;
+		bool Pack(const Texture2D& texture, AtlasRegion& outRegion);
+
+		void Submit(uint8_t unit) const;
+
+		bool IsInitialized() const { return m_ReadFbo != 0; }
+		unsigned GetHandle() const { return m_Tex; }
+		int GetPageSize() const { return m_PageSize; }
+		int GetPageCount() const { return m_PageCount; }
+
+	private:
+		struct Shelf {
+			int Layer;
+			int Y;
+			int Height;
+			int CursorX;
+		};
+
+		bool Allocate(int width, int height, int& outLayer, int& outX, int& outY);
+		bool AddPage();
+
+		unsigned m_Tex = 0;
+		unsigned m_ReadFbo = 0;
+		unsigned m_DrawFbo = 0;
+		int m_PageSize = k_DefaultPageSize;
+		int m_PageCount = 0;
+		std::vector<Shelf> m_Shelves;
+		std::vector<int> m_PageCursorY;
+	};
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "Core/JobSystem.hpp"
+#include "Graphics/Texture2D.hpp"
+
+#include <memory>
+#include <string>
+
+namespace Bolt {
+
+	// Info: One image decode on a JobSystem background worker. The queued job holds its own reference,
+	// so dropping the pointer early only discards the result.
+	struct TextureDecodeJob {
+		std::string Path;
+		DecodedImage Image;
+		bool Succeeded = false;
+		JobSystem::Counter Counter;
+
+		static std::shared_ptr<TextureDecodeJob> Start(std::string path, bool flipVertical = true) {
+			auto job = std::make_shared<TextureDecodeJob>();
+			job->Path = std::move(path);
+			JobSystem::SubmitBackground(job->Counter, [job, flipVertical]() {
+				job->Succeeded = Texture2D::Decode(job->Path.c_str(), job->Image, flipVertical);
+			});
+			return job;
+		}
+
+		// Info: Image and Succeeded may only be read once this returned true
+		bool IsDone() { return JobSystem::IsDone(Counter); }
+		void Wait() { JobSystem::Wait(Counter); }
+	};
+
+} // namespace Bolt
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Graphics/Texture2D.hpp"
+#include "Graphics/TextureAtlas.hpp"
 
 #include <cstdint>
 #include <string>
@@ -17,7 +18,12 @@ namespace Bolt {
 		Texture2D Texture;
 		uint16_t Generation = 0;
 		std::string Name;
+		AtlasRegion AtlasRegion;
 		bool IsValid = false;
+		// Info: Texture is a placeholder until the pending async load is uploaded
+		bool IsLoading = false;
+		// Info: The async load failed and the placeholder stayed, the next load of this path decodes the file again
+		bool LoadFailed = false;
 	};
 
 } // namespace Bolt
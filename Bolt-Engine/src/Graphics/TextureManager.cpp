@@ -3,6 +3,8 @@
 #include "TextureManager.hpp"
 #include <Serialization/File.hpp>
 
+#include <chrono>
+
 namespace Bolt {
 	std::array<std::string, 9> TextureManager::s_DefaultTextures = {
 		   "Default/Square.png",
@@ -18,8 +20,11 @@ namespace Bolt {
 
 	std::vector<TextureEntry> TextureManager::s_Textures = {};
 	std::queue<uint16_t> TextureManager::s_FreeIndices = {};
+	std::vector<TextureManager::PendingLoad> TextureManager::s_Loads = {};
 
 	bool TextureManager::s_IsInitialized = false;
+	bool TextureManager::s_AtlasingEnabled = true;
+	TextureAtlas TextureManager::s_Atlas;
 	std::string TextureManager::s_RootPath = Path::Combine("BoltAssets", "Textures");
 
 	constexpr uint16_t k_InvalidIndex = std::numeric_limits<uint16_t>::max();
@@ -43,6 +48,7 @@ namespace Bolt {
 		}
 
 		s_IsInitialized = true;
+		s_Atlas.Initialize();
 		LoadDefaultTextures();
 	}
 
@@ -52,12 +58,15 @@ namespace Bolt {
 			return;
 		}
 
+		// Info: Callbacks of unfinished loads are dropped, whatever they captured may already be gone
+		s_Loads.clear();
 		UnloadAll(true);
 		s_Textures.clear();
 		while (!s_FreeIndices.empty()) {
 			s_FreeIndices.pop();
 		}
 
+		s_Atlas.Shutdown();
 		s_IsInitialized = false;
 	}
 
@@ -67,67 +76,83 @@ namespace Bolt {
 			return TextureHandle::Invalid();
 		}
 
-		// Accept path as-given first (absolute or already-correct relative)
-		std::string fullpath(path);
-		if (!File::Exists(fullpath)) {
-			// Fallback: try relative to engine assets root
-			std::string rootPath = Path::Combine(s_RootPath, path);
-			if (File::Exists(rootPath)) {
-				fullpath = rootPath;
-			} else {
-				// Fallback: try user project Assets/Textures
-				std::string userPath = Path::Combine(Path::ExecutableDir(), "Assets", "Textures", path);
-				if (File::Exists(userPath)) {
-					fullpath = userPath;
-				} else {
-					BT_CORE_ERROR("[{}] Texture '{}' not found", ErrorCodeToString(BoltErrorCode::FileNotFound), std::string(path));
-					return TextureHandle::Invalid();
-				}
-			}
+		std::string fullpath;
+		if (!ResolveTexturePath(path, fullpath)) {
+			return TextureHandle::Invalid();
 		}
 
 		auto existingHandle = FindTextureByPath(fullpath);
 		if (existingHandle.index != k_InvalidIndex) {
-			return existingHandle;
-		}
-
-		uint16_t index = k_InvalidIndex;
-		if (!s_FreeIndices.empty()) {
-			index = s_FreeIndices.front();
-			s_FreeIndices.pop();
+			// Info: Synchronous callers expect the real texture (e.g. its size), so a pending async load is finished here
+			FinishLoad(existingHandle.index);
 
-			auto& entry = s_Textures[index];
-			entry.Texture.Destroy();
-			entry.Texture = Texture2D(fullpath.c_str(), filter, u, v);
+			TextureEntry& existing = s_Textures[existingHandle.index];
+			if (!existing.LoadFailed) {
+				return existingHandle;
+			}
 
-			if (!entry.Texture.IsValid()) {
+			Texture2D texture(fullpath.c_str(), existing.Texture.GetFilter(), existing.Texture.GetWrapU(), existing.Texture.GetWrapV());
+			if (!texture.IsValid()) {
 				BT_CORE_ERROR("[{}] Failed to load texture with path '{}'", ErrorCodeToString(BoltErrorCode::LoadFailed), fullpath);
 				return TextureHandle::Invalid();
 			}
 
-			entry.Generation++;
-			entry.IsValid = true;
-			entry.Name = fullpath;
+			existing.Texture = std::move(texture);
+			existing.LoadFailed = false;
+			TryPackIntoAtlas(existing);
+			return existingHandle;
 		}
-		else {
-			index = static_cast<uint16_t>(s_Textures.size());
 
-			TextureEntry entry;
-			entry.Texture = Texture2D(fullpath.c_str(), filter, u, v);
+		Texture2D texture(fullpath.c_str(), filter, u, v);
+		if (!texture.IsValid()) {
+			BT_CORE_ERROR("[{}] Failed to load texture with path '{}'", ErrorCodeToString(BoltErrorCode::LoadFailed), fullpath);
+			return TextureHandle::Invalid();
+		}
 
-			if (!entry.Texture.IsValid()) {
-				BT_CORE_ERROR("[{}] Failed to load texture with path '{}'", ErrorCodeToString(BoltErrorCode::LoadFailed), fullpath);
-				return TextureHandle::Invalid();
-			}
+		return AddEntry(fullpath, std::move(texture), false);
+	}
 
-			entry.Generation = 0;
-			entry.IsValid = true;
-			entry.Name = fullpath;
+	TextureHandle TextureManager::LoadTextureAsync(const std::string_view& path, Filter filter, Wrap u, Wrap v, LoadCallback onLoaded) {
+		if (!s_IsInitialized) {
+			BT_CORE_ERROR("[{}] TextureManager isn't initialized", ErrorCodeToString(BoltErrorCode::NotInitialized));
+			return TextureHandle::Invalid();
+		}
 
-			s_Textures.push_back(std::move(entry));
+		std::string fullpath;
+		if (!ResolveTexturePath(path, fullpath)) {
+			if (onLoaded) onLoaded(TextureHandle::Invalid(), false);
+			return TextureHandle::Invalid();
 		}
 
-		return { index, s_Textures[index].Generation };
+		auto existingHandle = FindTextureByPath(fullpath);
+		if (existingHandle.index != k_InvalidIndex) {
+			TextureEntry& existing = s_Textures[existingHandle.index];
+			if (existing.LoadFailed) {
+				existing.LoadFailed = false;
+				existing.IsLoading = true;
+				QueueLoad(existingHandle, fullpath, std::move(onLoaded));
+				return existingHandle;
+			}
+
+			if (onLoaded) {
+				if (PendingLoad* load = FindPendingLoad(existingHandle.index)) {
+					load->Callbacks.push_back(std::move(onLoaded));
+				}
+				else {
+					onLoaded(existingHandle, true);
+				}
+			}
+			return existingHandle;
+		}
+
+		static const DecodedImage k_Placeholder{ { 0, 0, 0, 0 }, 1, 1, 4 };
+		Texture2D placeholder;
+		placeholder.SetSampler(filter, u, v);
+		placeholder.Create(k_Placeholder, false);
+
+		const TextureHandle handle = AddEntry(fullpath, std::move(placeholder), true);
+		QueueLoad(handle, fullpath, std::move(onLoaded));
+		return handle;
 	}
 
 	TextureHandle TextureManager::LoadTextureByUUID(uint64_t assetId, Filter filter, Wrap u, Wrap v) {
@@ -143,6 +168,53 @@ namespace Bolt {
 		return LoadTexture(path, filter, u, v);
 	}
 
+	TextureHandle TextureManager::LoadTextureByUUIDAsync(uint64_t assetId, Filter filter, Wrap u, Wrap v, LoadCallback onLoaded) {
+		const std::string path = assetId != 0 && AssetRegistry::IsTexture(assetId) ? AssetRegistry::ResolvePath(assetId) : std::string();
+		if (path.empty()) {
+			if (onLoaded) onLoaded(TextureHandle::Invalid(), false);
+			return TextureHandle::Invalid();
+		}
+
+		return LoadTextureAsync(path, filter, u, v, std::move(onLoaded));
+	}
+
+	bool TextureManager::IsLoading(TextureHandle handle) {
+		return IsValid(handle) && s_Textures[handle.index].IsLoading;
+	}
+
+	void TextureManager::ProcessPendingLoads(float budgetMilliseconds) {
+		if (s_Loads.empty()) {
+			return;
+		}
+
+		using Clock = std::chrono::steady_clock;
+		const Clock::time_point start = Clock::now();
+		size_t uploaded = 0;
+
+		for (size_t i = 0; i < s_Loads.size(); ) {
+			if (uploaded > 0 && std::chrono::duration<float, std::milli>(Clock::now() - start).count() >= budgetMilliseconds) {
+				break;
+			}
+
+			if (!s_Loads[i].Job->IsDone()) {
+				i++;
+				continue;
+			}
+
+			// Callbacks may start new loads, so the entry leaves the list before it completes
+			PendingLoad load = std::move(s_Loads[i]);
+			s_Loads.erase(s_Loads.begin() + static_cast<std::ptrdiff_t>(i));
+			CompleteLoad(load);
+			uploaded++;
+		}
+	}
+
+	void TextureManager::FinishPendingLoads() {
+		while (!s_Loads.empty()) {
+			FinishLoad(s_Loads.front().Index);
+		}
+	}
+
 	TextureHandle TextureManager::GetDefaultTexture(DefaultTexture type) {
 		if (!s_IsInitialized) {
 			BT_CORE_ERROR("[{}] TextureManager isn't initialized", ErrorCodeToString(BoltErrorCode::NotInitialized));
@@ -184,8 +256,13 @@ namespace Bolt {
 
 		entry.Texture.Destroy();
 		entry.IsValid = false;
+		entry.IsLoading = false;
+		entry.LoadFailed = false;
 		entry.Name.clear();
+		entry.AtlasRegion = {};
 		s_FreeIndices.push(handle.index);
+
+		CancelLoads(handle.index, handle.index + 1u);
 	}
 
 	TextureHandle TextureManager::GetTextureHandle(const std::string& name) {
@@ -277,6 +354,7 @@ namespace Bolt {
 			entry.Generation = 0;
 			entry.IsValid = true;
 			entry.Name = texPath;
+			TryPackIntoAtlas(entry);
 
 			s_Textures.push_back(std::move(entry));
 		}
@@ -289,11 +367,15 @@ namespace Bolt {
 		}
 
 		size_t startOffset = defaultTextures ? 0 : s_DefaultTextures.size();
+		const size_t endOffset = s_Textures.size();
 		for (size_t i = startOffset; i < s_Textures.size(); i++) {
 			if (s_Textures[i].IsValid) {
 				s_Textures[i].Texture.Destroy();
 				s_Textures[i].IsValid = false;
+				s_Textures[i].IsLoading = false;
+				s_Textures[i].LoadFailed = false;
 				s_Textures[i].Name.clear();
+				s_Textures[i].AtlasRegion = {};
 				if (i >= s_DefaultTextures.size()) {
 					s_FreeIndices.push(static_cast<uint16_t>(i));
 				}
@@ -305,6 +387,202 @@ namespace Bolt {
 			while (!s_FreeIndices.empty()) {
 				s_FreeIndices.pop();
 			}
+			s_Atlas.Clear();
+		}
+		else {
+			// Info: The shelf packer never frees space, so reclaim it by repacking what's still loaded.
+			RebuildAtlas();
+		}
+
+		CancelLoads(startOffset, endOffset);
+	}
+
+	void TextureManager::SetAtlasingEnabled(bool enabled) {
+		if (s_AtlasingEnabled == enabled) {
+			return;
+		}
+
+		s_AtlasingEnabled = enabled;
+		if (s_IsInitialized) {
+			RebuildAtlas();
+		}
+	}
+
+	const AtlasRegion* TextureManager::GetAtlasRegion(TextureHandle handle) {
+		if (!s_AtlasingEnabled || !IsValid(handle)) {
+			return nullptr;
+		}
+
+		const TextureEntry& entry = s_Textures[handle.index];
+		if (!entry.AtlasRegion.IsValid()) {
+			return nullptr;
+		}
+
+		// Info: The sampler may have been changed after packing, the atlas copy only matches the original settings.
+		if (!s_Atlas.CanPack(entry.Texture)) {
+			return nullptr;
+		}
+
+		return &entry.AtlasRegion;
+	}
+
+	void TextureManager::SubmitAtlas(uint8_t unit) {
+		s_Atlas.Submit(unit);
+	}
+
+	void TextureManager::TryPackIntoAtlas(TextureEntry& entry) {
+		entry.AtlasRegion = {};
+		if (!s_AtlasingEnabled || !s_Atlas.CanPack(entry.Texture)) {
+			return;
+		}
+
+		if (!s_Atlas.Pack(entry.Texture, entry.AtlasRegion)) {
+			BT_CORE_WARN_TAG("TextureManager", "Texture atlas is full, '{}' will be drawn unbatched", entry.Name);
+		}
+	}
+
+	void TextureManager::RebuildAtlas() {
+		s_Atlas.Clear();
+		for (TextureEntry& entry : s_Textures) {
+			entry.AtlasRegion = {};
+			if (entry.IsValid && !entry.IsLoading) {
+				TryPackIntoAtlas(entry);
+			}
+		}
+	}
+
+	bool TextureManager::ResolveTexturePath(const std::string_view& path, std::string& outFullPath) {
+		// Accept path as-given first (absolute or already-correct relative)
+		outFullPath = std::string(path);
+		if (File::Exists(outFullPath)) {
+			return true;
+		}
+
+		// Fallback: try relative to engine assets root
+		std::string rootPath = Path::Combine(s_RootPath, path);
+		if (File::Exists(rootPath)) {
+			outFullPath = std::move(rootPath);
+			return true;
+		}
+
+		// Fallback: try user project Assets/Textures
+		std::string userPath = Path::Combine(Path::ExecutableDir(), "Assets", "Textures", path);
+		if (File::Exists(userPath)) {
+			outFullPath = std::move(userPath);
+			return true;
+		}
+
+		BT_CORE_ERROR("[{}] Texture '{}' not found", ErrorCodeToString(BoltErrorCode::FileNotFound), std::string(path));
+		return false;
+	}
+
+	TextureHandle TextureManager::AddEntry(const std::string& name, Texture2D&& texture, bool isLoading) {
+		uint16_t index = k_InvalidIndex;
+		if (!s_FreeIndices.empty()) {
+			index = s_FreeIndices.front();
+			s_FreeIndices.pop();
+			s_Textures[index].Generation++;
+		}
+		else {
+			index = static_cast<uint16_t>(s_Textures.size());
+			s_Textures.emplace_back();
+		}
+
+		TextureEntry& entry = s_Textures[index];
+		entry.Texture = std::move(texture);
+		entry.IsValid = true;
+		entry.IsLoading = isLoading;
+		entry.LoadFailed = false;
+		entry.Name = name;
+		entry.AtlasRegion = {};
+		if (!isLoading) {
+			TryPackIntoAtlas(entry);
+		}
+
+		return { index, entry.Generation };
+	}
+
+	TextureManager::PendingLoad* TextureManager::FindPendingLoad(uint16_t index) {
+		for (PendingLoad& load : s_Loads) {
+			if (load.Index == index) {
+				return &load;
+			}
+		}
+		return nullptr;
+	}
+
+	void TextureManager::QueueLoad(TextureHandle handle, const std::string& fullpath, LoadCallback onLoaded) {
+		PendingLoad load;
+		load.Index = handle.index;
+		load.Generation = handle.generation;
+		load.Job = TextureDecodeJob::Start(fullpath);
+		if (onLoaded) {
+			load.Callbacks.push_back(std::move(onLoaded));
+		}
+		s_Loads.push_back(std::move(load));
+	}
+
+	void TextureManager::CompleteLoad(PendingLoad& load) {
+		const TextureHandle handle(load.Index, load.Generation);
+		bool loaded = false;
+
+		if (IsValid(handle) && s_Textures[handle.index].IsLoading) {
+			TextureEntry& entry = s_Textures[handle.index];
+			entry.IsLoading = false;
+
+			// Info: Sampler changes made on the placeholder (e.g. by the scene loader) carry over
+			Texture2D texture;
+			texture.SetSampler(entry.Texture.GetFilter(), entry.Texture.GetWrapU(), entry.Texture.GetWrapV());
+			if (load.Job->Succeeded && texture.Create(load.Job->Image)) {
+				entry.Texture = std::move(texture);
+				TryPackIntoAtlas(entry);
+				loaded = true;
+			}
+			else {
+				// The placeholder stays, so handles already handed out keep resolving
+				entry.LoadFailed = true;
+				BT_CORE_ERROR("[{}] Failed to load texture with path '{}'", ErrorCodeToString(BoltErrorCode::LoadFailed), entry.Name);
+			}
+		}
+
+		// Info: Release the decoded pixels before user code runs
+		load.Job.reset();
+		for (LoadCallback& callback : load.Callbacks) {
+			callback(handle, loaded);
+		}
+	}
+
+	void TextureManager::FinishLoad(uint16_t index) {
+		for (size_t i = 0; i < s_Loads.size(); i++) {
+			if (s_Loads[i].Index != index) {
+				continue;
+			}
+
+			PendingLoad load = std::move(s_Loads[i]);
+			s_Loads.erase(s_Loads.begin() + static_cast<std::ptrdiff_t>(i));
+			load.Job->Wait();
+			CompleteLoad(load);
+			return;
+		}
+	}
+
+	void TextureManager::CancelLoads(size_t firstIndex, size_t lastIndex) {
+		std::vector<PendingLoad> cancelled;
+		for (size_t i = 0; i < s_Loads.size(); ) {
+			if (s_Loads[i].Index >= firstIndex && s_Loads[i].Index < lastIndex) {
+				cancelled.push_back(std::move(s_Loads[i]));
+				s_Loads.erase(s_Loads.begin() + static_cast<std::ptrdiff_t>(i));
+			}
+			else {
+				i++;
+			}
+		}
+
+		// The decode jobs finish on their own, their results are simply dropped
+		for (PendingLoad& load : cancelled) {
+			for (LoadCallback& callback : load.Callbacks) {
+				callback(TextureHandle(load.Index, load.Generation), false);
+			}
 		}
 	}
 
@@ -2,12 +2,15 @@
 #include "Core/Export.hpp"
 #include "Graphics/DefaultTexture.hpp"
 #include "Graphics/Texture2D.hpp"
+#include "Graphics/TextureAtlas.hpp"
+#include "Graphics/TextureDecodeJob.hpp"
 #include "Graphics/TextureEntry.hpp"
 #include "TextureHandle.hpp"
 #include "Serialization/Path.hpp"
 
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <queue>
 #include <string>
@@ -20,12 +23,30 @@ namespace Bolt {
 namespace Bolt {
         class BOLT_API TextureManager {
         public:
+            // Info: Runs exactly once per async request on the main thread, loaded is false if decoding failed or the texture was unloaded first
+            using LoadCallback = std::function<void(TextureHandle handle, bool loaded)>;
+
             static void Initialize();
             static void Shutdown();
 
             static TextureHandle LoadTexture(const std::string_view& path, Filter filter = Filter::Point, Wrap u = Wrap::Clamp, Wrap v = Wrap::Clamp);
             static TextureHandle LoadTextureByUUID(uint64_t assetId, Filter filter = Filter::Point, Wrap u = Wrap::Clamp, Wrap v = Wrap::Clamp);
             static TextureHandle GetDefaultTexture(DefaultTexture type);
+
+            /// Returns a handle right away that draws a transparent placeholder. The file is decoded on a JobSystem
+            /// worker and uploaded by ProcessPendingLoads(); a synchronous load of the same path finishes it on the spot.
+            /// A failed load keeps the placeholder for handles already handed out, loading the path again retries the file.
+            static TextureHandle LoadTextureAsync(const std::string_view& path, Filter filter = Filter::Point, Wrap u = Wrap::Clamp, Wrap v = Wrap::Clamp, LoadCallback onLoaded = {});
+            static TextureHandle LoadTextureByUUIDAsync(uint64_t assetId, Filter filter = Filter::Point, Wrap u = Wrap::Clamp, Wrap v = Wrap::Clamp, LoadCallback onLoaded = {});
+            static bool IsLoading(TextureHandle handle);
+            static size_t GetPendingLoadCount() { return s_Loads.size(); }
+
+            /// Uploads finished decodes in request order until budgetMilliseconds is spent, at least one per call.
+            /// Called once per frame by the Application.
+            static void ProcessPendingLoads(float budgetMilliseconds);
+            /// Blocks until every pending load is decoded and uploaded.
+            static void FinishPendingLoads();
+
             static void UnloadTexture(TextureHandle handle);
             static TextureHandle GetTextureHandle(const std::string& name);
             static Texture2D* GetTexture(TextureHandle handle);
@@ -33,6 +54,14 @@ namespace Bolt {
             static void UnloadAll(bool defaultTextures = false);
             static uint64_t GetTextureAssetUUID(TextureHandle handle);
 
+            /// Packs eligible textures (point-filtered, clamped, small) into a shared atlas array
+            /// so sprites using different textures can be drawn in a single batch.
+            static void SetAtlasingEnabled(bool enabled);
+            static bool IsAtlasingEnabled() { return s_AtlasingEnabled; }
+            static const AtlasRegion* GetAtlasRegion(TextureHandle handle);
+            static void SubmitAtlas(uint8_t unit);
+            static const TextureAtlas& GetAtlas() { return s_Atlas; }
+
             /// Returns the texture path relative to a texture root directory.
             /// This is the same format accepted by LoadTexture().
             static std::string GetTextureName(TextureHandle handle) {
@@ -71,13 +100,33 @@ namespace Bolt {
             }
 
         private:
+            struct PendingLoad {
+                uint16_t Index = 0;
+                uint16_t Generation = 0;
+                std::shared_ptr<TextureDecodeJob> Job;
+                std::vector<LoadCallback> Callbacks;
+            };
+
+            static bool ResolveTexturePath(const std::string_view& path, std::string& outFullPath);
+            static TextureHandle AddEntry(const std::string& name, Texture2D&& texture, bool isLoading);
+            static PendingLoad* FindPendingLoad(uint16_t index);
+            static void QueueLoad(TextureHandle handle, const std::string& fullpath, LoadCallback onLoaded);
+            static void CompleteLoad(PendingLoad& load);
+            static void FinishLoad(uint16_t index);
+            static void CancelLoads(size_t firstIndex, size_t lastIndex);
+
             static TextureHandle FindTextureByPath(const std::string& path);
             static void LoadDefaultTextures();
+            static void TryPackIntoAtlas(TextureEntry& entry);
+            static void RebuildAtlas();
 
             static std::array<std::string, 9> s_DefaultTextures;
             static std::vector<TextureEntry> s_Textures;
             static std::queue<uint16_t> s_FreeIndices;
+            static std::vector<PendingLoad> s_Loads;
             static bool s_IsInitialized;
+            static bool s_AtlasingEnabled;
+            static TextureAtlas s_Atlas;
 
             static std::string s_RootPath;
 
@@ -12,6 +12,8 @@
 
 #include "Graphics/Shader.hpp"
 #include "Graphics/Instance44.hpp"
+#include "Graphics/SpriteSortKey.hpp"
+#include "Utils/RadixSort.hpp"
 
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -77,20 +79,24 @@ namespace Bolt {
 			);
 		}
 
-		std::sort(instances.begin(), instances.end(),
-			[](const Instance44& a, const Instance44& b) {
-				if (a.SortingLayer != b.SortingLayer)
-					return a.SortingLayer < b.SortingLayer;
-				return a.SortingOrder < b.SortingOrder;
-			});
+		m_SortKeys.clear();
+		m_SortKeys.reserve(instances.size());
+		for (size_t i = 0; i < instances.size(); i++) {
+			const Instance44& instance = instances[i];
+			m_SortKeys.push_back(SpriteSortKey::Make(instance.SortingLayer, instance.SortingOrder,
+				SpriteSortKey::TextureKey(instance.TextureHandle.index, false), static_cast<uint32_t>(i)));
+		}
+		RadixSort64(m_SortKeys, m_SortScratch, SpriteSortKey::k_FirstSortedByte, SpriteSortKey::k_LastSortedByte);
 
 		glDisable(GL_SCISSOR_TEST);
 		glDisable(GL_DEPTH_TEST);
 		glEnable(GL_BLEND);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		TextureManager::SubmitAtlas(1);
 
 		// (Ben-Scr) Final Rendering
-		for (const Instance44& instance : instances) {
+		for (uint64_t key : m_SortKeys) {
+			const Instance44& instance = instances[SpriteSortKey::GetIndex(key)];
 			m_SpriteShader.SetSpritePosition(instance.Position);
 			m_SpriteShader.SetScale(instance.Scale);
 			m_SpriteShader.SetRotation(instance.Rotation);
@@ -101,9 +107,14 @@ namespace Bolt {
 			if (!handle.IsValid()) {
 				handle = TextureManager::GetDefaultTexture(DefaultTexture::Square);
 			}
-			Texture2D* texture = TextureManager::GetTexture(handle);
-			if (texture && texture->IsValid())
-				texture->Submit(0);
+
+			const AtlasRegion* region = TextureManager::GetAtlasRegion(handle);
+			m_SpriteShader.SetAtlasRegion(region);
+			if (!region) {
+				Texture2D* texture = TextureManager::GetTexture(handle);
+				if (texture && texture->IsValid())
+					texture->Submit(0);
+			}
 
 
 			m_QuadMesh.Bind();
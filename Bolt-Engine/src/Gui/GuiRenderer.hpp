@@ -2,6 +2,9 @@
 #include "Graphics/SpriteShaderProgram.hpp"
 #include "Graphics/QuadMesh.hpp"
 
+#include <cstdint>
+#include <vector>
+
 namespace Bolt {
 	class Scene;
 	class SceneManager;
@@ -20,6 +23,8 @@ namespace Bolt {
 	private:
 		SpriteShaderProgram m_SpriteShader;
 		QuadMesh m_QuadMesh;
+		std::vector<uint64_t> m_SortKeys;
+		std::vector<uint64_t> m_SortScratch;
 		bool m_IsInitialized = false;
 	};
 }
\ No newline at end of file
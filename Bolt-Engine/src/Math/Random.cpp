@@ -4,84 +4,110 @@
 #include <limits>
 
 namespace Bolt {
+	namespace {
+		struct ThreadStream {
+			RandomStream Stream;
+			uint64_t Generation = 0;
+		};
+		thread_local ThreadStream t_ThreadStream;
+	}
+
+	RandomStream& Random::GetThreadStream() {
+		const uint64_t generation = s_Generation.load(std::memory_order_acquire);
+		if (t_ThreadStream.Generation != generation) {
+			t_ThreadStream.Stream.Seed(GetSeed(), k_ThreadSequenceBit | s_NextThreadSequence.fetch_add(1, std::memory_order_relaxed));
+			t_ThreadStream.Generation = generation;
+		}
+		return t_ThreadStream.Stream;
+	}
+
+	void Random::SetSeed(uint64_t seed) {
+		s_Seed.store(seed, std::memory_order_relaxed);
+		s_NextSequence.store(1, std::memory_order_relaxed);
+		s_NextThreadSequence.store(1, std::memory_order_relaxed);
+		const uint64_t generation = s_Generation.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+		t_ThreadStream.Stream.Seed(seed, k_ThreadSequenceBit);
+		t_ThreadStream.Generation = generation;
+	}
+
+	RandomStream Random::CreateStream() {
+		return RandomStream(GetSeed(), s_NextSequence.fetch_add(1, std::memory_order_relaxed));
+	}
+
 	Color Random::NextColor() {
-		return Color(NextFloat(0.f, 1.f), NextFloat(0.f, 1.f), NextFloat(0.f, 1.f));
+		RandomStream& stream = GetThreadStream();
+		const float r = stream.NextFloat();
+		const float g = stream.NextFloat();
+		const float b = stream.NextFloat();
+		return Color(r, g, b);
 	}
 	bool Random::NextBool() {
-		static thread_local std::bernoulli_distribution dist(0.5);
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen);
+		return (GetThreadStream().NextUInt() >> 31) != 0;
+	}
+	std::uint8_t Random::NextByte() {
+		return static_cast<std::uint8_t>(GetThreadStream().NextUInt() >> 24);
 	}
 	std::uint8_t Random::NextByte(std::uint8_t max) {
-		static thread_local std::uniform_int_distribution<int> dist;
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen, typename decltype(dist)::param_type(0, max));
+		return static_cast<std::uint8_t>(GetThreadStream().NextInt(0, max));
 	}
 	std::uint8_t Random::NextByte(std::uint8_t min, std::uint8_t max) {
 		if (min > max) { BT_CORE_WARN_TAG("Random", "min > max, swapping"); std::swap(min, max); }
 
-		static thread_local std::uniform_int_distribution<int> dist;
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen, typename decltype(dist)::param_type(min, max));
+		return static_cast<std::uint8_t>(GetThreadStream().NextInt(min, max));
 	}
 
 	double Random::NextDouble() {
-		static thread_local std::uniform_real_distribution<double> dist(0.0, 1.f);
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen);
+		return GetThreadStream().NextDouble();
 	}
 	double Random::NextDouble(double max) {
 		if (max < 0.0) { BT_CORE_WARN_TAG("Random", "Negative max clamped to 0"); max = 0.0; }
 
-		static thread_local std::uniform_real_distribution<double> dist;
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen, typename decltype(dist)::param_type(0, max));
+		return GetThreadStream().NextDouble(0.0, max);
 	}
 	double Random::NextDouble(double min, double max) {
 		if (min > max) { BT_CORE_WARN_TAG("Random", "min > max, swapping"); std::swap(min, max); }
 
-		static thread_local std::uniform_real_distribution<double> dist;
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen, typename decltype(dist)::param_type(min, max));
+		return GetThreadStream().NextDouble(min, max);
 	}
 
 	float Random::NextFloat() {
-		static thread_local std::uniform_real_distribution<float> dist(0.f, 1.f);
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen);
+		return GetThreadStream().NextFloat();
 	}
 	float Random::NextFloat(float max) {
 		if (max < 0.0f) { BT_CORE_WARN_TAG("Random", "Negative max clamped to 0"); max = 0.0f; }
 
-		static thread_local std::uniform_real_distribution<float> dist;
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen, typename decltype(dist)::param_type(0.f, max));
+		return GetThreadStream().NextFloat(0.f, max);
 	}
 	float Random::NextFloat(float min, float max) {
 		if (min > max) { BT_CORE_WARN_TAG("Random", "min > max, swapping"); std::swap(min, max); }
 
-		static thread_local std::uniform_real_distribution<float> dist;
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen, typename decltype(dist)::param_type(min, max));
+		return GetThreadStream().NextFloat(min, max);
 	}
 
 	int Random::NextInt() {
-		static thread_local std::uniform_int_distribution<int> dist(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen);
+		return static_cast<int>(GetThreadStream().NextUInt());
 	}
 	int Random::NextInt(int max) {
 		if (max < 0) { BT_CORE_WARN_TAG("Random", "Negative max clamped to 0"); max = 0; }
 
-		static thread_local std::uniform_int_distribution<int> dist;
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen, typename decltype(dist)::param_type(0, max));
+		return GetThreadStream().NextInt(0, max);
 	}
 	int Random::NextInt(int min, int max) {
 		if (min > max) { BT_CORE_WARN_TAG("Random", "min > max, swapping"); std::swap(min, max); }
 
-		static thread_local std::uniform_int_distribution<int> dist;
-		std::scoped_lock lock(s_Mutex);
-		return dist(s_Gen, typename decltype(dist)::param_type(min, max));
+		return GetThreadStream().NextInt(min, max);
+	}
+
+	void Random::FillFloats(std::span<float> out, float min, float max) {
+		if (min > max) { BT_CORE_WARN_TAG("Random", "min > max, swapping"); std::swap(min, max); }
+
+		GetThreadStream().FillFloats(out, min, max);
+	}
+	void Random::FillInCircle(std::span<Vec2> out, float radius) {
+		GetThreadStream().FillInCircle(out, radius);
+	}
+	void Random::FillOnCircle(std::span<Vec2> out, float radius) {
+		GetThreadStream().FillOnCircle(out, radius);
 	}
-}
\ No newline at end of file
+}
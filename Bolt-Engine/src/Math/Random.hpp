@@ -1,12 +1,17 @@
 #pragma once
 #include "Core/Export.hpp"
-#include <random>
+#include "Math/RandomStream.hpp"
+#include <atomic>
 #include <cstdint>
-#include <mutex>
+#include <random>
+#include <span>
 
 namespace Bolt {
     struct Color;
 
+    // Info: Static helpers over a lock-free, thread-local RandomStream per thread.
+    // After SetSeed the calling thread and every CreateStream() result are reproducible;
+    // other threads pick their streams in first-use order.
     class BOLT_API Random {
     public:
         Random() = delete;
@@ -30,11 +35,28 @@ namespace Bolt {
         static  int NextInt(int max);
         static int NextInt(int min, int max);
 
-        static void SetSeed(uint32_t seed) { std::scoped_lock lock(s_Mutex); s_Gen.seed(seed); }
+        static void FillFloats(std::span<float> out, float min, float max);
+        static void FillInCircle(std::span<Vec2> out, float radius);
+        static void FillOnCircle(std::span<Vec2> out, float radius);
+
+        // Info: Reseeds every stream; meant to be called while no jobs are running
+        static void SetSeed(uint64_t seed);
+        static uint64_t GetSeed() { return s_Seed.load(std::memory_order_relaxed); }
+
+        // Info: Hands out the next stream of the seeded sequence, for objects that need their own reproducible generator
+        static RandomStream CreateStream();
+
+        static RandomStream& GetThreadStream();
 
     private:
-        inline static std::mt19937 s_Gen{ std::random_device{}() };
-        inline static std::mutex s_Mutex;
+        inline static std::atomic<uint64_t> s_Seed{ (static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}() };
+        // Info: Thread streams count in their own range so they never replay a stream handed out by CreateStream.
+        // Bit 62 is the highest one RandomStream keeps, the sequence is shifted left once into the increment.
+        static constexpr uint64_t k_ThreadSequenceBit = uint64_t{ 1 } << 62;
+
+        inline static std::atomic<uint64_t> s_NextSequence{ 1 };
+        inline static std::atomic<uint64_t> s_NextThreadSequence{ 1 };
+        inline static std::atomic<uint64_t> s_Generation{ 1 };
     };
 
-}
\ No newline at end of file
+}
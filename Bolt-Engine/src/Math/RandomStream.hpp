@@ -0,0 +1,98 @@
+#pragma once
+#include "Collections/Vec2.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <span>
+
+namespace Bolt {
+    // Info: Small PCG32 generator. A (seed, sequence) pair selects one of 2^63 independent streams,
+    // so each worker or emitter can own a stream and draw numbers without any locking.
+    class RandomStream {
+    public:
+        RandomStream() = default;
+        explicit RandomStream(uint64_t seed, uint64_t sequence = 0) { Seed(seed, sequence); }
+
+        void Seed(uint64_t seed, uint64_t sequence = 0) {
+            m_State = 0;
+            m_Increment = (sequence << 1u) | 1u;
+            NextUInt();
+            m_State += seed;
+            NextUInt();
+        }
+
+        uint32_t NextUInt() {
+            const uint64_t oldState = m_State;
+            m_State = oldState * 6364136223846793005ULL + m_Increment;
+            const uint32_t xorShifted = static_cast<uint32_t>(((oldState >> 18u) ^ oldState) >> 27u);
+            const uint32_t rotation = static_cast<uint32_t>(oldState >> 59u);
+            return (xorShifted >> rotation) | (xorShifted << ((~rotation + 1u) & 31u));
+        }
+
+        // Info: Unbiased value in [0, bound), bound 0 yields 0
+        uint32_t NextUInt(uint32_t bound) {
+            if (bound == 0) return 0;
+
+            uint64_t product = static_cast<uint64_t>(NextUInt()) * bound;
+            uint32_t low = static_cast<uint32_t>(product);
+            if (low < bound) {
+                const uint32_t threshold = (~bound + 1u) % bound;
+                while (low < threshold) {
+                    product = static_cast<uint64_t>(NextUInt()) * bound;
+                    low = static_cast<uint32_t>(product);
+                }
+            }
+            return static_cast<uint32_t>(product >> 32);
+        }
+
+        // Info: Uniform in [0, 1)
+        float NextFloat() { return static_cast<float>(NextUInt() >> 8) * (1.0f / 16777216.0f); }
+        float NextFloat(float min, float max) { return min + (max - min) * NextFloat(); }
+
+        // Info: Uniform in [0, 1) with 53 bits of precision
+        double NextDouble() {
+            const uint64_t high = NextUInt();
+            const uint64_t low = NextUInt();
+            const uint64_t bits = (high << 21) ^ (low >> 11);
+            return static_cast<double>(bits) * (1.0 / 9007199254740992.0);
+        }
+        double NextDouble(double min, double max) { return min + (max - min) * NextDouble(); }
+
+        // Info: Inclusive range
+        int NextInt(int min, int max) {
+            const uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+            const uint32_t offset = span > UINT32_MAX ? NextUInt() : NextUInt(static_cast<uint32_t>(span));
+            return static_cast<int>(static_cast<int64_t>(min) + offset);
+        }
+
+        Vec2 NextInCircle(float radius) {
+            const float theta = NextFloat(0.0f, k_TwoPi);
+            const float r = radius * std::sqrt(NextFloat());
+            return Vec2(std::cos(theta) * r, std::sin(theta) * r);
+        }
+
+        Vec2 NextOnCircle(float radius) {
+            const float theta = NextFloat(0.0f, k_TwoPi);
+            return Vec2(std::cos(theta) * radius, std::sin(theta) * radius);
+        }
+
+        void FillFloats(std::span<float> out, float min, float max) {
+            const float range = max - min;
+            for (float& value : out) value = min + range * NextFloat();
+        }
+
+        void FillInCircle(std::span<Vec2> out, float radius) {
+            for (Vec2& value : out) value = NextInCircle(radius);
+        }
+
+        void FillOnCircle(std::span<Vec2> out, float radius) {
+            for (Vec2& value : out) value = NextOnCircle(radius);
+        }
+
+    private:
+        static constexpr float k_TwoPi = 6.28318530717958647692f;
+
+        uint64_t m_State = 0x853c49e6748fea9bULL;
+        uint64_t m_Increment = 0xda3e39cb94b95bdbULL;
+    };
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Bolt {
+	struct BoltPhysicsHandle {
+		static constexpr uint32_t k_InvalidIndex = UINT32_MAX;
+
+		uint32_t Index = k_InvalidIndex;
+		uint32_t Generation = 0;
+
+		bool IsValid() const { return Index != k_InvalidIndex; }
+		bool operator==(const BoltPhysicsHandle&) const = default;
+	};
+
+	/// Slot pool addressed by generational handles. Slots live in fixed size pages that never move,
+	/// so references registered with the Bolt-Physics world stay valid while freed slots are reused.
+	/// A stale handle (slot freed or reused since) resolves to nullptr.
+	template<typename T, size_t PageSize = 256>
+	class BoltPhysicsPool {
+	public:
+		BoltPhysicsPool() = default;
+		~BoltPhysicsPool() { Clear(); }
+
+		BoltPhysicsPool(const BoltPhysicsPool&) = delete;
+		BoltPhysicsPool& operator=(const BoltPhysicsPool&) = delete;
+		BoltPhysicsPool(BoltPhysicsPool&& other) noexcept
+			: m_Pages(std::move(other.m_Pages))
+			, m_FreeList(std::move(other.m_FreeList))
+			, m_Capacity(std::exchange(other.m_Capacity, 0))
+			, m_Size(std::exchange(other.m_Size, 0)) {
+		}
+		BoltPhysicsPool& operator=(BoltPhysicsPool&& other) noexcept {
+			if (this != &other) {
+				Clear();
+				m_Pages = std::move(other.m_Pages);
+				m_FreeList = std::move(other.m_FreeList);
+				m_Capacity = std::exchange(other.m_Capacity, 0);
+				m_Size = std::exchange(other.m_Size, 0);
+			}
+			return *this;
+		}
+
+		template<typename... Args>
+		BoltPhysicsHandle Emplace(Args&&... args) {
+			uint32_t index;
+			if (!m_FreeList.empty()) {
+				index = m_FreeList.back();
+				m_FreeList.pop_back();
+			}
+			else {
+				if (m_Capacity % PageSize == 0) {
+					m_Pages.push_back(std::make_unique<Slot[]>(PageSize));
+				}
+				index = m_Capacity++;
+				SlotAt(index).Index = index;
+			}
+
+			Slot& slot = SlotAt(index);
+			::new (static_cast<void*>(slot.Storage)) T(std::forward<Args>(args)...);
+			slot.Alive = true;
+			m_Size++;
+			return { index, slot.Generation };
+		}
+
+		void Remove(BoltPhysicsHandle handle) {
+			Slot* slot = Resolve(handle);
+			if (!slot) return;
+
+			Release(*slot);
+			m_FreeList.push_back(handle.Index);
+		}
+
+		T* Get(BoltPhysicsHandle handle) {
+			Slot* slot = Resolve(handle);
+			return slot ? slot->Value() : nullptr;
+		}
+
+		const T* Get(BoltPhysicsHandle handle) const {
+			return const_cast<BoltPhysicsPool*>(this)->Get(handle);
+		}
+
+		// Info: Handle of a value that lives in a pool of this type, without any lookup
+		static BoltPhysicsHandle HandleOf(const T& value) {
+			const Slot* slot = reinterpret_cast<const Slot*>(reinterpret_cast<const std::byte*>(&value) - offsetof(Slot, Storage));
+			return { slot->Index, slot->Generation };
+		}
+
+		template<typename F>
+		void ForEach(F&& func) {
+			for (uint32_t i = 0; i < m_Capacity; i++) {
+				Slot& slot = SlotAt(i);
+				if (slot.Alive) {
+					func(BoltPhysicsHandle{ i, slot.Generation }, *slot.Value());
+				}
+			}
+		}
+
+		void Clear() {
+			for (uint32_t i = 0; i < m_Capacity; i++) {
+				Slot& slot = SlotAt(i);
+				if (slot.Alive) {
+					Release(slot);
+				}
+			}
+			m_Pages.clear();
+			m_FreeList.clear();
+			m_Capacity = 0;
+			m_Size = 0;
+		}
+
+		size_t Size() const { return m_Size; }
+		// Info: One past the highest slot index ever handed out, sizes arrays indexed by handle.Index
+		uint32_t GetCapacity() const { return m_Capacity; }
+
+	private:
+		struct Slot {
+			alignas(T) std::byte Storage[sizeof(T)];
+			uint32_t Index = 0;
+			uint32_t Generation = 0;
+			bool Alive = false;
+
+			T* Value() { return std::launder(reinterpret_cast<T*>(Storage)); }
+		};
+		static_assert(std::is_standard_layout_v<Slot>, "HandleOf relies on Slot being standard layout");
+
+		Slot& SlotAt(uint32_t index) { return m_Pages[index / PageSize][index % PageSize]; }
+
+		Slot* Resolve(BoltPhysicsHandle handle) {
+			if (handle.Index >= m_Capacity) return nullptr;
+			Slot& slot = SlotAt(handle.Index);
+			return slot.Alive && slot.Generation == handle.Generation ? &slot : nullptr;
+		}
+
+		void Release(Slot& slot) {
+			slot.Value()->~T();
+			slot.Alive = false;
+			slot.Generation++;
+			m_Size--;
+		}
+
+		std::vector<std::unique_ptr<Slot[]>> m_Pages;
+		std::vector<uint32_t> m_FreeList;
+		uint32_t m_Capacity = 0;
+		size_t m_Size = 0;
+	};
+}
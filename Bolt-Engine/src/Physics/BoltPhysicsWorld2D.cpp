@@ -4,6 +4,8 @@
 #include <BoxCollider.hpp>
 #include <CircleCollider.hpp>
 
+#include <algorithm>
+
 namespace Bolt {
 
 	BoltPhysicsWorld2D::BoltPhysicsWorld2D() : m_World() {}
@@ -12,154 +14,228 @@ namespace Bolt {
 		: m_World(settings) {
 	}
 
+	BoltPhysicsWorld2D::~BoltPhysicsWorld2D() {
+		Destroy();
+	}
+
 	void BoltPhysicsWorld2D::Step(float dt) {
 		m_World.Step(dt);
+		CaptureContacts();
 		DispatchContacts();
 	}
 
 	void BoltPhysicsWorld2D::Destroy() {
-		m_ContactCallbacks.clear();
-		m_BodyToEntity.clear();
-
-		// Detach colliders and unregister everything before clearing ownership
-		for (auto& [key, body] : m_Bodies) {
-			m_World.DetachCollider(*body);
-			m_World.UnregisterBody(*body);
-		}
-		for (auto& [key, collider] : m_Colliders) {
-			m_World.UnregisterCollider(*collider);
-		}
-
-		m_Bodies.clear();
-		m_Colliders.clear();
+		// Detach colliders and unregister everything before the pools release their slots
+		m_Bodies.ForEach([this](BoltPhysicsHandle, BoltPhys::Body& body) {
+			m_World.DetachCollider(body);
+			m_World.UnregisterBody(body);
+		});
+		m_Colliders.ForEach([this](BoltPhysicsHandle, ColliderStorage& collider) {
+			m_World.UnregisterCollider(AsCollider(collider));
+		});
+
+		m_Bodies.Clear();
+		m_Colliders.Clear();
+		m_BodyData.clear();
+		m_Owners.clear();
+		m_ContactEvents.clear();
+		m_ContactBodies.clear();
 	}
 
-	BoltPhys::Body* BoltPhysicsWorld2D::CreateBody(EntityHandle entity, BoltPhys::BodyType type) {
-		uint32_t key = static_cast<uint32_t>(entity);
-		if (m_Bodies.count(key)) {
+	BoltPhys::Body* BoltPhysicsWorld2D::CreateBody(const entt::registry& owner, EntityHandle entity, BoltPhys::BodyType type) {
+		EntityRecord& record = GetOrCreateRecord(owner, entity);
+		if (BoltPhys::Body* existing = m_Bodies.Get(record.Body)) {
 			BT_CORE_WARN_TAG("BoltPhysics", "Entity already has a Bolt-Physics body");
-			return m_Bodies[key].get();
+			return existing;
 		}
 
-		auto body = std::make_unique<BoltPhys::Body>(type);
-		BoltPhys::Body* ptr = body.get();
-		m_World.RegisterBody(*ptr);
-		m_BodyToEntity[ptr] = entity;
-		m_Bodies[key] = std::move(body);
-		return ptr;
-	}
+		record.Body = m_Bodies.Emplace(type);
+		if (m_BodyData.size() < m_Bodies.GetCapacity()) {
+			m_BodyData.resize(m_Bodies.GetCapacity());
+		}
+		m_BodyData[record.Body.Index] = BodyData{ entity, {} };
 
-	void BoltPhysicsWorld2D::DestroyBody(EntityHandle entity) {
-		uint32_t key = static_cast<uint32_t>(entity);
+		BoltPhys::Body* body = m_Bodies.Get(record.Body);
+		m_World.RegisterBody(*body);
+		return body;
+	}
 
+	void BoltPhysicsWorld2D::DestroyBody(const entt::registry& owner, EntityHandle entity) {
 		// Destroy collider first if exists
-		DestroyCollider(entity);
+		DestroyCollider(owner, entity);
+
+		EntityRecord* record = FindRecord(owner, entity);
+		if (!record) return;
 
-		auto it = m_Bodies.find(key);
-		if (it == m_Bodies.end()) return;
+		if (BoltPhys::Body* body = m_Bodies.Get(record->Body)) {
+			m_World.UnregisterBody(*body);
+			m_BodyData[record->Body.Index] = BodyData{};
+			m_Bodies.Remove(record->Body);
+		}
+		record->Body = {};
+		ReleaseRecordIfEmpty(*record);
+	}
 
-		BoltPhys::Body* ptr = it->second.get();
-		m_World.UnregisterBody(*ptr);
-		m_BodyToEntity.erase(ptr);
-		m_Bodies.erase(it);
-		m_ContactCallbacks.erase(key);
+	BoltPhys::Body* BoltPhysicsWorld2D::GetBody(const entt::registry& owner, EntityHandle entity) {
+		const EntityRecord* record = FindRecord(owner, entity);
+		return record ? m_Bodies.Get(record->Body) : nullptr;
 	}
 
-	BoltPhys::Body* BoltPhysicsWorld2D::GetBody(EntityHandle entity) {
-		uint32_t key = static_cast<uint32_t>(entity);
-		auto it = m_Bodies.find(key);
-		return it != m_Bodies.end() ? it->second.get() : nullptr;
+	BoltPhysicsHandle BoltPhysicsWorld2D::GetBodyHandle(const entt::registry& owner, EntityHandle entity) const {
+		const EntityRecord* record = FindRecord(owner, entity);
+		return record && m_Bodies.Get(record->Body) ? record->Body : BoltPhysicsHandle{};
 	}
 
-	BoltPhys::BoxCollider* BoltPhysicsWorld2D::CreateBoxCollider(EntityHandle entity, const Vec2& halfExtents) {
-		uint32_t key = static_cast<uint32_t>(entity);
+	template<typename TCollider, typename... Args>
+	TCollider* BoltPhysicsWorld2D::EmplaceCollider(const entt::registry& owner, EntityHandle entity, Args&&... args) {
+		DestroyCollider(owner, entity); // Replace existing
 
-		DestroyCollider(entity); // Replace existing
+		EntityRecord& record = GetOrCreateRecord(owner, entity);
+		record.Collider = m_Colliders.Emplace(std::in_place_type<TCollider>, std::forward<Args>(args)...);
 
-		auto collider = std::make_unique<BoltPhys::BoxCollider>(BoltPhys::Vec2(halfExtents.x, halfExtents.y));
-		BoltPhys::BoxCollider* ptr = collider.get();
-		m_World.RegisterCollider(*ptr);
+		TCollider* collider = &std::get<TCollider>(*m_Colliders.Get(record.Collider));
+		m_World.RegisterCollider(*collider);
 
 		// Attach to body if one exists
-		auto bodyIt = m_Bodies.find(key);
-		if (bodyIt != m_Bodies.end()) {
-			m_World.AttachCollider(*bodyIt->second, *ptr);
+		if (BoltPhys::Body* body = m_Bodies.Get(record.Body)) {
+			m_World.AttachCollider(*body, *collider);
 		}
-
-		m_Colliders[key] = std::move(collider);
-		return ptr;
+		return collider;
 	}
 
-	BoltPhys::CircleCollider* BoltPhysicsWorld2D::CreateCircleCollider(EntityHandle entity, float radius) {
-		uint32_t key = static_cast<uint32_t>(entity);
-
-		DestroyCollider(entity);
-
-		auto collider = std::make_unique<BoltPhys::CircleCollider>(radius);
-		BoltPhys::CircleCollider* ptr = collider.get();
-		m_World.RegisterCollider(*ptr);
-
-		auto bodyIt = m_Bodies.find(key);
-		if (bodyIt != m_Bodies.end()) {
-			m_World.AttachCollider(*bodyIt->second, *ptr);
-		}
+	BoltPhys::BoxCollider* BoltPhysicsWorld2D::CreateBoxCollider(const entt::registry& owner, EntityHandle entity, const Vec2& halfExtents) {
+		return EmplaceCollider<BoltPhys::BoxCollider>(owner, entity, BoltPhys::Vec2(halfExtents.x, halfExtents.y));
+	}
 
-		m_Colliders[key] = std::move(collider);
-		return ptr;
+	BoltPhys::CircleCollider* BoltPhysicsWorld2D::CreateCircleCollider(const entt::registry& owner, EntityHandle entity, float radius) {
+		return EmplaceCollider<BoltPhys::CircleCollider>(owner, entity, radius);
 	}
 
-	void BoltPhysicsWorld2D::DestroyCollider(EntityHandle entity) {
-		uint32_t key = static_cast<uint32_t>(entity);
-		auto it = m_Colliders.find(key);
-		if (it == m_Colliders.end()) return;
+	void BoltPhysicsWorld2D::DestroyCollider(const entt::registry& owner, EntityHandle entity) {
+		EntityRecord* record = FindRecord(owner, entity);
+		if (!record) return;
 
-		BoltPhys::Collider* ptr = it->second.get();
+		ColliderStorage* collider = m_Colliders.Get(record->Collider);
+		if (!collider) return;
 
 		// Detach from body if attached
-		auto bodyIt = m_Bodies.find(key);
-		if (bodyIt != m_Bodies.end()) {
-			m_World.DetachCollider(*bodyIt->second);
+		if (BoltPhys::Body* body = m_Bodies.Get(record->Body)) {
+			m_World.DetachCollider(*body);
 		}
 
-		m_World.UnregisterCollider(*ptr);
-		m_Colliders.erase(it);
+		m_World.UnregisterCollider(AsCollider(*collider));
+		m_Colliders.Remove(record->Collider);
+		record->Collider = {};
+		ReleaseRecordIfEmpty(*record);
 	}
 
-	void BoltPhysicsWorld2D::RegisterContactCallback(EntityHandle entity, BoltContactCallback callback) {
-		m_ContactCallbacks[static_cast<uint32_t>(entity)] = std::move(callback);
+	void BoltPhysicsWorld2D::RegisterContactCallback(const entt::registry& owner, EntityHandle entity, BoltContactCallback callback) {
+		const EntityRecord* record = FindRecord(owner, entity);
+		if (!record || !m_Bodies.Get(record->Body)) {
+			BT_CORE_WARN_TAG("BoltPhysics", "Contact callback ignored, entity has no Bolt-Physics body");
+			return;
+		}
+		m_BodyData[record->Body.Index].OnContact = callback;
 	}
 
-	void BoltPhysicsWorld2D::UnregisterContactCallback(EntityHandle entity) {
-		m_ContactCallbacks.erase(static_cast<uint32_t>(entity));
+	void BoltPhysicsWorld2D::UnregisterContactCallback(const entt::registry& owner, EntityHandle entity) {
+		const EntityRecord* record = FindRecord(owner, entity);
+		if (record && m_Bodies.Get(record->Body)) {
+			m_BodyData[record->Body.Index].OnContact.reset();
+		}
 	}
 
-	void BoltPhysicsWorld2D::DispatchContacts() {
+	void BoltPhysicsWorld2D::CaptureContacts() {
+		// Info: Every registered body lives in m_Bodies, so its slot index (and the entity stored there)
+		// is read straight from the body address
+		m_ContactEvents.clear();
+		m_ContactBodies.clear();
+
 		const auto& contacts = m_World.GetContacts();
-		for (const auto& contact : contacts) {
-			EntityHandle entityA = entt::null;
-			EntityHandle entityB = entt::null;
+		m_ContactEvents.reserve(contacts.size());
+		m_ContactBodies.reserve(contacts.size());
 
-			auto itA = m_BodyToEntity.find(contact.bodyA);
-			auto itB = m_BodyToEntity.find(contact.bodyB);
-			if (itA != m_BodyToEntity.end()) entityA = itA->second;
-			if (itB != m_BodyToEntity.end()) entityB = itB->second;
+		for (const auto& contact : contacts) {
+			const BoltPhysicsHandle bodyA = contact.bodyA ? BoltPhysicsPool<BoltPhys::Body>::HandleOf(*contact.bodyA) : BoltPhysicsHandle{};
+			const BoltPhysicsHandle bodyB = contact.bodyB ? BoltPhysicsPool<BoltPhys::Body>::HandleOf(*contact.bodyB) : BoltPhysicsHandle{};
 
-			BoltContact2D boltContact{
-				entityA, entityB,
+			m_ContactEvents.push_back({
+				bodyA.IsValid() ? m_BodyData[bodyA.Index].Entity : entt::null,
+				bodyB.IsValid() ? m_BodyData[bodyB.Index].Entity : entt::null,
 				{ contact.normal.x, contact.normal.y },
 				contact.penetration
-			};
+			});
+			m_ContactBodies.emplace_back(bodyA, bodyB);
+		}
+	}
+
+	void BoltPhysicsWorld2D::DispatchContacts() {
+		// Info: Runs after the whole step is captured, a callback that destroys a body only stales its handle
+		for (size_t i = 0; i < m_ContactEvents.size(); i++) {
+			const auto& [bodyA, bodyB] = m_ContactBodies[i];
 
 			// Dispatch to both entities
-			if (entityA != entt::null) {
-				auto cbIt = m_ContactCallbacks.find(static_cast<uint32_t>(entityA));
-				if (cbIt != m_ContactCallbacks.end()) cbIt->second(boltContact);
+			if (m_Bodies.Get(bodyA)) {
+				if (const BoltContactCallback callback = m_BodyData[bodyA.Index].OnContact) callback(m_ContactEvents[i]);
 			}
-			if (entityB != entt::null) {
-				auto cbIt = m_ContactCallbacks.find(static_cast<uint32_t>(entityB));
-				if (cbIt != m_ContactCallbacks.end()) cbIt->second(boltContact);
+			if (m_Bodies.Get(bodyB)) {
+				if (const BoltContactCallback callback = m_BodyData[bodyB.Index].OnContact) callback(m_ContactEvents[i]);
+			}
+		}
+	}
+
+	BoltPhysicsWorld2D::EntityRecord* BoltPhysicsWorld2D::FindRecord(const entt::registry& owner, EntityHandle entity) {
+		const size_t index = static_cast<size_t>(entt::to_entity(entity));
+		for (OwnerRecords& records : m_Owners) {
+			if (records.Owner != &owner) continue;
+
+			if (index >= records.Entities.size() || records.Entities[index].Entity != entity) return nullptr;
+			return &records.Entities[index];
+		}
+		return nullptr;
+	}
+
+	const BoltPhysicsWorld2D::EntityRecord* BoltPhysicsWorld2D::FindRecord(const entt::registry& owner, EntityHandle entity) const {
+		return const_cast<BoltPhysicsWorld2D*>(this)->FindRecord(owner, entity);
+	}
+
+	BoltPhysicsWorld2D::EntityRecord& BoltPhysicsWorld2D::GetOrCreateRecord(const entt::registry& owner, EntityHandle entity) {
+		auto ownerIt = std::find_if(m_Owners.begin(), m_Owners.end(), [&owner](const OwnerRecords& records) { return records.Owner == &owner; });
+		if (ownerIt == m_Owners.end()) {
+			ownerIt = m_Owners.insert(m_Owners.end(), OwnerRecords{ &owner, {} });
+		}
+
+		std::vector<EntityRecord>& entities = ownerIt->Entities;
+		const size_t index = static_cast<size_t>(entt::to_entity(entity));
+		if (index >= entities.size()) {
+			entities.resize(index + 1);
+		}
+
+		if (entities[index].Entity != entity) {
+			const EntityHandle previous = entities[index].Entity;
+			if (m_Bodies.Get(entities[index].Body) || m_Colliders.Get(entities[index].Collider)) {
+				if (!owner.valid(previous)) {
+					// Info: The previous version was destroyed without its hooks running, free its body and collider before reuse
+					BT_CORE_WARN_TAG("BoltPhysics", "Entity index {} was still owned by a destroyed entity version, releasing its body", index);
+					DestroyBody(owner, previous);
+				}
+				else {
+					BT_CORE_WARN_TAG("BoltPhysics", "Entity index {} is still owned by a live entity version, its body stays alive until Destroy()", index);
+				}
 			}
+			entities[index] = EntityRecord{ entity, {}, {} };
+		}
+		return entities[index];
+	}
+
+	void BoltPhysicsWorld2D::ReleaseRecordIfEmpty(EntityRecord& record) {
+		if (!m_Bodies.Get(record.Body) && !m_Colliders.Get(record.Collider)) {
+			record = EntityRecord{};
 		}
 	}
 
+	BoltPhys::Collider& BoltPhysicsWorld2D::AsCollider(ColliderStorage& storage) {
+		return std::visit([](auto& collider) -> BoltPhys::Collider& { return collider; }, storage);
+	}
+
 }
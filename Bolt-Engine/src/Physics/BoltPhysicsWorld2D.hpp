@@ -2,6 +2,7 @@
 #include "Collections/Vec2.hpp"
 #include "Core/Export.hpp"
 #include "Physics/BoltContact2D.hpp"
+#include "Physics/BoltPhysicsPool.hpp"
 #include "Scene/EntityHandle.hpp"
 
 #include <PhysicsWorld.hpp>
@@ -10,19 +11,26 @@
 #include <BoxCollider.hpp>
 #include <CircleCollider.hpp>
 
-#include <unordered_map>
-#include <functional>
+#include <span>
+#include <utility>
+#include <variant>
 #include <vector>
 
 namespace Bolt {
-	using BoltContactCallback = std::function<void(const BoltContact2D&)>;
+	// Info: Function pointer plus instance, bind with connect<&Type::Member>(instance) or connect<&FreeFunction>()
+	using BoltContactCallback = entt::delegate<void(const BoltContact2D&)>;
 
 	/// Engine-level wrapper around the Bolt-Physics PhysicsWorld.
-	/// Manages Body/Collider ownership and provides per-entity contact callbacks.
+	/// Owns bodies and colliders in paged pools and provides per-entity contact callbacks.
+	/// Bodies registered on GetWorld() directly must not be mixed in, contacts assume every body lives in the pool.
 	class BOLT_API BoltPhysicsWorld2D {
 	public:
 		BoltPhysicsWorld2D();
 		explicit BoltPhysicsWorld2D(const BoltPhys::WorldSettings& settings);
+		~BoltPhysicsWorld2D();
+
+		BoltPhysicsWorld2D(const BoltPhysicsWorld2D&) = delete;
+		BoltPhysicsWorld2D& operator=(const BoltPhysicsWorld2D&) = delete;
 
 		void Step(float dt);
 		void Destroy();
@@ -33,36 +41,73 @@ namespace Bolt {
 		void SetSettings(const BoltPhys::WorldSettings& settings) { m_World.SetSettings(settings); }
 		const BoltPhys::WorldSettings& GetSettings() const { return m_World.GetSettings(); }
 
-		// Body registration tied to an entity
-		BoltPhys::Body* CreateBody(EntityHandle entity, BoltPhys::BodyType type);
-		void DestroyBody(EntityHandle entity);
-		BoltPhys::Body* GetBody(EntityHandle entity);
+		// Body registration tied to an entity, owner is the registry of the entity's scene
+		// Info: One world serves every loaded scene, entity handles are only unique within their owner
+		BoltPhys::Body* CreateBody(const entt::registry& owner, EntityHandle entity, BoltPhys::BodyType type);
+		void DestroyBody(const entt::registry& owner, EntityHandle entity);
+		BoltPhys::Body* GetBody(const entt::registry& owner, EntityHandle entity);
+		BoltPhysicsHandle GetBodyHandle(const entt::registry& owner, EntityHandle entity) const;
+		BoltPhys::Body* GetBody(BoltPhysicsHandle handle) { return m_Bodies.Get(handle); }
 
 		// Collider attachment
-		BoltPhys::BoxCollider* CreateBoxCollider(EntityHandle entity, const Vec2& halfExtents);
-		BoltPhys::CircleCollider* CreateCircleCollider(EntityHandle entity, float radius);
-		void DestroyCollider(EntityHandle entity);
+		BoltPhys::BoxCollider* CreateBoxCollider(const entt::registry& owner, EntityHandle entity, const Vec2& halfExtents);
+		BoltPhys::CircleCollider* CreateCircleCollider(const entt::registry& owner, EntityHandle entity, float radius);
+		void DestroyCollider(const entt::registry& owner, EntityHandle entity);
 
-		// Contact callbacks per entity
-		void RegisterContactCallback(EntityHandle entity, BoltContactCallback callback);
-		void UnregisterContactCallback(EntityHandle entity);
+		// Contact callbacks per entity, the entity needs a body
+		void RegisterContactCallback(const entt::registry& owner, EntityHandle entity, BoltContactCallback callback);
+		void UnregisterContactCallback(const entt::registry& owner, EntityHandle entity);
 
 		size_t GetBodyCount() const { return m_World.GetBodyCount(); }
 
+		// Info: Contacts of the last Step(), valid until the next one
+		std::span<const BoltContact2D> GetContactEvents() const { return m_ContactEvents; }
+
 	private:
+		using ColliderStorage = std::variant<BoltPhys::BoxCollider, BoltPhys::CircleCollider>;
+
+		// Info: Per body slot, indexed by the body handle index
+		struct BodyData {
+			EntityHandle Entity = entt::null;
+			BoltContactCallback OnContact;
+		};
+
+		// Info: Indexed by entt::to_entity, replaces the entity keyed hash maps
+		struct EntityRecord {
+			EntityHandle Entity = entt::null;
+			BoltPhysicsHandle Body;
+			BoltPhysicsHandle Collider;
+		};
+
+		// Info: One record table per scene registry, only a handful of scenes are loaded at once
+		struct OwnerRecords {
+			const entt::registry* Owner = nullptr;
+			std::vector<EntityRecord> Entities;
+		};
+
+		void CaptureContacts();
 		void DispatchContacts();
 
-		BoltPhys::PhysicsWorld m_World;
+		EntityRecord* FindRecord(const entt::registry& owner, EntityHandle entity);
+		const EntityRecord* FindRecord(const entt::registry& owner, EntityHandle entity) const;
+		EntityRecord& GetOrCreateRecord(const entt::registry& owner, EntityHandle entity);
+		void ReleaseRecordIfEmpty(EntityRecord& record);
 
-		// Ownership: bodies and colliders keyed by entity
-		std::unordered_map<uint32_t, std::unique_ptr<BoltPhys::Body>> m_Bodies;
-		std::unordered_map<uint32_t, std::unique_ptr<BoltPhys::Collider>> m_Colliders;
+		template<typename TCollider, typename... Args>
+		TCollider* EmplaceCollider(const entt::registry& owner, EntityHandle entity, Args&&... args);
+
+		static BoltPhys::Collider& AsCollider(ColliderStorage& storage);
+
+		BoltPhys::PhysicsWorld m_World;
 
-		// Entity lookup from Body pointer (reverse map)
-		std::unordered_map<BoltPhys::Body*, EntityHandle> m_BodyToEntity;
+		BoltPhysicsPool<BoltPhys::Body> m_Bodies;
+		BoltPhysicsPool<ColliderStorage> m_Colliders;
+		std::vector<BodyData> m_BodyData;
+		std::vector<OwnerRecords> m_Owners;
 
-		// Contact callbacks per entity
-		std::unordered_map<uint32_t, BoltContactCallback> m_ContactCallbacks;
+		std::vector<BoltContact2D> m_ContactEvents;
+		// Info: Body handles of m_ContactEvents[i], resolved again at dispatch so destroyed bodies are skipped
+		std::vector<std::pair<BoltPhysicsHandle, BoltPhysicsHandle>> m_ContactBodies;
 	};
 
 }
@@ -1,23 +1,78 @@
 #include "pch.hpp"
 #include "Box2DWorld.hpp"
 #include "Scene/Scene.hpp"
+#include "Core/JobSystem.hpp"
+#include "Physics/CollisionLayers2D.hpp"
 #include <Components/General/Transform2DComponent.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace Bolt {
+	namespace {
+		// Info: Box2D keeps per-worker scratch state for at most this many workers
+		constexpr uint32_t k_MaxBox2DWorkers = 64;
+	}
+
+	// Info: Box2D enqueues a handful of tasks per step, their counters are recycled every Step()
+	struct Box2DWorld::TaskScheduler {
+		std::vector<std::unique_ptr<JobSystem::Counter>> Tasks;
+		size_t UsedTasks = 0;
+	};
+
 	Box2DWorld::Box2DWorld() {
 		b2WorldDef def = b2DefaultWorldDef();
 		def.enableSleep = true;
-		def.workerCount = 4;
+
+		// Info: Box2D passes the executing thread as workerIndex, JobSystem thread indices are 0 (stepping thread) to WorkerCount
+		const uint32_t threadCount = JobSystem::GetWorkerCount() + 1;
+		if (threadCount > 1 && threadCount <= k_MaxBox2DWorkers) {
+			m_Scheduler = std::make_unique<TaskScheduler>();
+			def.workerCount = static_cast<int>(threadCount);
+			def.enqueueTask = &Box2DWorld::EnqueueTask;
+			def.finishTask = &Box2DWorld::FinishTask;
+			def.userTaskContext = m_Scheduler.get();
+		}
+		else {
+			if (threadCount > k_MaxBox2DWorkers) {
+				BT_CORE_WARN_TAG("PhysicsSystem", "JobSystem has {} threads but Box2D supports {}, stepping single threaded", threadCount, k_MaxBox2DWorkers);
+			}
+			def.workerCount = 1;
+		}
 
 		def.gravity = b2Vec2{ 0, -9.8f };
 		m_WorldId = b2CreateWorld(&def);
 	}
 	Box2DWorld::~Box2DWorld() {}
 
+	Box2DWorld::Box2DWorld(Box2DWorld&&) noexcept = default;
+	Box2DWorld& Box2DWorld::operator=(Box2DWorld&&) noexcept = default;
+
 	void Box2DWorld::Step(float dt) {
+		if (m_Scheduler) m_Scheduler->UsedTasks = 0;
 		b2World_Step(m_WorldId, dt, 5);
 	}
 
+	void* Box2DWorld::EnqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext) {
+		TaskScheduler& scheduler = *static_cast<TaskScheduler*>(userContext);
+		if (scheduler.UsedTasks == scheduler.Tasks.size()) {
+			scheduler.Tasks.push_back(std::make_unique<JobSystem::Counter>());
+		}
+		JobSystem::Counter& counter = *scheduler.Tasks[scheduler.UsedTasks++];
+
+		// Info: Never run inline, the solver enqueues one long-running task per worker that spin-waits on the others
+		JobSystem::Dispatch(counter, static_cast<size_t>(itemCount), static_cast<size_t>(std::max(minRange, 1)),
+			[task, taskContext](size_t begin, size_t end, size_t) {
+				task(static_cast<int>(begin), static_cast<int>(end), JobSystem::GetThreadIndex(), taskContext);
+			});
+		return &counter;
+	}
+
+	void Box2DWorld::FinishTask(void* userTask, void* userContext) {
+		(void)userContext;
+		JobSystem::Wait(*static_cast<JobSystem::Counter*>(userTask));
+	}
+
 	void Box2DWorld::Destroy() {
 		if (b2World_IsValid(m_WorldId)) {
 			b2DestroyWorld(m_WorldId);
@@ -66,6 +121,7 @@ namespace Bolt {
 		shapeDef.material.restitution = 0.f;
 		shapeDef.isSensor = isSensor;
 		shapeDef.enableSensorEvents = isSensor;
+		shapeDef.filter = CollisionLayers2D::MakeShapeFilter(0);
 
 		if (shapeType == ShapeType::Square) {
 
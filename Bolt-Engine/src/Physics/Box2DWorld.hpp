@@ -4,6 +4,8 @@
 #include "Physics/PhysicsTypes.hpp"
 #include <box2d/box2d.h>
 
+#include <memory>
+
 namespace Bolt {
     class Scene;
 }
@@ -20,8 +22,8 @@ namespace Bolt {
         Box2DWorld(const Box2DWorld&) = delete;
         Box2DWorld& operator=(const Box2DWorld&) = delete;
 
-        Box2DWorld(Box2DWorld&&) noexcept = default;
-        Box2DWorld& operator=(Box2DWorld&&) noexcept = default;
+        Box2DWorld(Box2DWorld&&) noexcept;
+        Box2DWorld& operator=(Box2DWorld&&) noexcept;
 
         void Step(float dt);
 
@@ -33,7 +35,14 @@ namespace Bolt {
         b2WorldId GetWorldID() { return m_WorldId; }
         void Destroy();
     private:
+        struct TaskScheduler;
+
+        static void* EnqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext);
+        static void FinishTask(void* userTask, void* userContext);
+
         b2WorldId m_WorldId;
         CollisionDispatcher m_Dispatcher{};
+        // Info: Heap allocated so the pointer handed to Box2D as userTaskContext survives moves
+        std::unique_ptr<TaskScheduler> m_Scheduler;
     };
 }
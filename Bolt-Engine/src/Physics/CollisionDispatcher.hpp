@@ -1,10 +1,12 @@
 #pragma once
 #include <box2d/box2d.h>
 #include "Physics/Collision2D.hpp"
+#include "Physics/ContactEvent2D.hpp"
 #include "Physics/PhysicsUtility.hpp"
 
 #include <unordered_map>
 #include <functional>
+#include <span>
 #include <vector>
 #include <cstdint>
 
@@ -26,18 +28,25 @@ namespace Bolt {
 	};
 
 
+	// Info: Contacts are copied out of Box2D into a per-step buffer by Capture() and delivered by Flush()
+	// after the step, in Box2D's deterministic event order. Systems can read the buffers in bulk instead
+	// of registering callbacks; the frame buffer collects every step until ClearFrameEvents().
 	class CollisionDispatcher {
 	public:
 		void RegisterBegin(b2ShapeId id, ContactBeginCallback cb) {
-			m_begin[id].push_back(std::move(cb));
+			Register(ContactEventType2D::Begin, id, std::move(cb));
 		}
 		void RegisterEnd(b2ShapeId id, ContactEndCallback cb) {
-			m_end[id].push_back(std::move(cb));
+			Register(ContactEventType2D::End, id, std::move(cb));
 		}
 		void RegisterHit(b2ShapeId id, ContactHitCallback cb) {
-			m_hit[id].push_back(std::move(cb));
+			Register(ContactEventType2D::Hit, id, std::move(cb));
 		}
 		void UnregisterShape(b2ShapeId id) {
+			if (m_IsFlushing) {
+				m_PendingChanges.push_back({ PendingChange::Kind::Unregister, ContactEventType2D::Begin, id, {} });
+				return;
+			}
 			m_begin.erase(id);
 			m_end.erase(id);
 			m_hit.erase(id);
@@ -46,46 +55,147 @@ namespace Bolt {
 			m_begin.clear();
 			m_end.clear();
 			m_hit.clear();
+			m_StepEvents.clear();
+			m_FrameEvents.clear();
+			m_PendingChanges.clear();
 		}
 
-		void Process(b2WorldId world) {
+		void Capture(b2WorldId world) {
+			m_StepEvents.clear();
+
 			b2ContactEvents ev = b2World_GetContactEvents(world);
+			m_StepEvents.reserve(static_cast<size_t>(ev.beginCount + ev.endCount + ev.hitCount));
 
 			for (int i = 0; i < ev.beginCount; ++i) {
-				auto& e = ev.beginEvents[i];
-				auto collision2D = Collision2D{ .entityA = PhysicsUtility::GetEntityHandleFromShapeID(e.shapeIdA),.entityB = PhysicsUtility::GetEntityHandleFromShapeID(e.shapeIdB) };
-				Dispatch(e.shapeIdA, collision2D, m_begin);
-				Dispatch(e.shapeIdB, collision2D, m_begin);
+				const auto& e = ev.beginEvents[i];
+				ContactEvent2D& event = PushEvent(ContactEventType2D::Begin, e.shapeIdA, e.shapeIdB);
+				event.Normal = { e.manifold.normal.x, e.manifold.normal.y };
+				if (e.manifold.pointCount > 0) {
+					event.Point = { e.manifold.points[0].point.x, e.manifold.points[0].point.y };
+				}
 			}
 
 			for (int i = 0; i < ev.endCount; ++i) {
-				auto& e = ev.endEvents[i];
-				auto collision2D = Collision2D{ .entityA = PhysicsUtility::GetEntityHandleFromShapeID(e.shapeIdA),.entityB = PhysicsUtility::GetEntityHandleFromShapeID(e.shapeIdB) };
-				Dispatch(e.shapeIdA, collision2D, m_end);
-				Dispatch(e.shapeIdB, collision2D, m_end);
+				const auto& e = ev.endEvents[i];
+				PushEvent(ContactEventType2D::End, e.shapeIdA, e.shapeIdB);
 			}
 
 			for (int i = 0; i < ev.hitCount; ++i) {
-				auto& e = ev.hitEvents[i];
-				auto collision2D = Collision2D{ .entityA = PhysicsUtility::GetEntityHandleFromShapeID(e.shapeIdA),.entityB = PhysicsUtility::GetEntityHandleFromShapeID(e.shapeIdB) };
-				Dispatch(e.shapeIdA, collision2D, m_hit);
-				Dispatch(e.shapeIdB, collision2D, m_hit);
+				const auto& e = ev.hitEvents[i];
+				ContactEvent2D& event = PushEvent(ContactEventType2D::Hit, e.shapeIdA, e.shapeIdB);
+				event.Point = { e.point.x, e.point.y };
+				event.Normal = { e.normal.x, e.normal.y };
+				event.ApproachSpeed = e.approachSpeed;
+			}
+
+			m_FrameEvents.insert(m_FrameEvents.end(), m_StepEvents.begin(), m_StepEvents.end());
+		}
+
+		// Info: Runs the registered callbacks for the last captured step. Callbacks may register, unregister
+		// or destroy shapes, map changes are applied after the flush and events on destroyed shapes are skipped.
+		void Flush() {
+			m_IsFlushing = true;
+			for (const ContactEvent2D& event : m_StepEvents) {
+				auto& map = GetMap(event.Type);
+				if (map.empty()) continue;
+
+				const Collision2D collision2D{ .entityA = event.EntityA, .entityB = event.EntityB };
+				Dispatch(event.ShapeA, collision2D, map);
+				Dispatch(event.ShapeB, collision2D, map);
 			}
+			m_IsFlushing = false;
+
+			ApplyPendingChanges();
+		}
+
+		void Process(b2WorldId world) {
+			Capture(world);
+			Flush();
 		}
 
+		std::span<const ContactEvent2D> GetStepEvents() const { return m_StepEvents; }
+		std::span<const ContactEvent2D> GetFrameEvents() const { return m_FrameEvents; }
+		void ClearFrameEvents() { m_FrameEvents.clear(); }
+
 	private:
-		template<typename Evt, typename Map>
-		void Dispatch(b2ShapeId id, const Evt& e, Map& map) {
+		using CallbackMap = std::unordered_map<b2ShapeId, std::vector<ContactBeginCallback>, ShapeIdHash, ShapeIdEqual>;
+
+		struct PendingChange {
+			enum class Kind : uint8_t { Register, Unregister };
+			Kind Action;
+			ContactEventType2D Type;
+			b2ShapeId Shape;
+			std::function<void(const Collision2D&)> Callback;
+		};
+
+		ContactEvent2D& PushEvent(ContactEventType2D type, b2ShapeId shapeA, b2ShapeId shapeB) {
+			ContactEvent2D& event = m_StepEvents.emplace_back();
+			event.Type = type;
+			event.ShapeA = shapeA;
+			event.ShapeB = shapeB;
+			// Info: End events may reference shapes destroyed during the step, those carry no entity
+			if (b2Shape_IsValid(shapeA)) event.EntityA = PhysicsUtility::GetEntityHandleFromShapeID(shapeA);
+			if (b2Shape_IsValid(shapeB)) event.EntityB = PhysicsUtility::GetEntityHandleFromShapeID(shapeB);
+			return event;
+		}
+
+		void Register(ContactEventType2D type, b2ShapeId id, std::function<void(const Collision2D&)> cb) {
+			if (m_IsFlushing) {
+				m_PendingChanges.push_back({ PendingChange::Kind::Register, type, id, std::move(cb) });
+				return;
+			}
+			GetMap(type)[id].push_back(std::move(cb));
+		}
+
+		void ApplyPendingChanges() {
+			// Info: Swap out first, a pending change never triggers another flush but keeps the loop simple
+			std::vector<PendingChange> changes;
+			changes.swap(m_PendingChanges);
+			for (PendingChange& change : changes) {
+				if (change.Action == PendingChange::Kind::Register) {
+					Register(change.Type, change.Shape, std::move(change.Callback));
+				}
+				else {
+					UnregisterShape(change.Shape);
+				}
+			}
+		}
+
+		bool IsPendingUnregister(b2ShapeId id) const {
+			for (const PendingChange& change : m_PendingChanges) {
+				if (change.Action == PendingChange::Kind::Unregister && ShapeIdEqual{}(change.Shape, id)) return true;
+			}
+			return false;
+		}
+
+		CallbackMap& GetMap(ContactEventType2D type) {
+			switch (type) {
+			case ContactEventType2D::End: return m_end;
+			case ContactEventType2D::Hit: return m_hit;
+			default: return m_begin;
+			}
+		}
+
+		template<typename Evt>
+		void Dispatch(b2ShapeId id, const Evt& e, CallbackMap& map) {
 			auto it = map.find(id);
 			if (it == map.end()) return;
-			for (auto& cb : it->second) cb(e);
+			if (!m_PendingChanges.empty() && IsPendingUnregister(id)) return;
+
+			// Info: The map is not modified while flushing, so the callback list stays put
+			for (auto& cb : it->second) {
+				cb(e);
+				if (!m_PendingChanges.empty() && IsPendingUnregister(id)) return;
+			}
 		}
 
-		std::unordered_map<b2ShapeId,
-			std::vector<ContactBeginCallback>,
-			ShapeIdHash,
-			ShapeIdEqual> m_begin;
-		std::unordered_map<b2ShapeId, std::vector<ContactEndCallback>, ShapeIdHash, ShapeIdEqual> m_end;
-		std::unordered_map<b2ShapeId, std::vector<ContactHitCallback>, ShapeIdHash, ShapeIdEqual> m_hit;
+		CallbackMap m_begin;
+		CallbackMap m_end;
+		CallbackMap m_hit;
+
+		std::vector<ContactEvent2D> m_StepEvents;
+		std::vector<ContactEvent2D> m_FrameEvents;
+		std::vector<PendingChange> m_PendingChanges;
+		bool m_IsFlushing = false;
 	};
 }
@@ -0,0 +1,63 @@
+#include "pch.hpp"
+#include "Physics/CollisionLayers2D.hpp"
+#include "Components/Physics/BoxCollider2DComponent.hpp"
+#include "Project/ProjectManager.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneManager.hpp"
+
+#include <box2d/box2d.h>
+
+namespace Bolt {
+	b2Filter CollisionLayers2D::MakeShapeFilter(int layer) {
+		if (layer < 0 || layer >= BoltProject::k_MaxCollisionLayers) {
+			layer = 0;
+		}
+
+		const BoltProject* project = ProjectManager::GetCurrentProject();
+		const uint32_t collidesWith = project ? project->GetCollisionMask(layer) : UINT32_MAX;
+
+		b2Filter filter = b2DefaultFilter();
+		filter.categoryBits = uint64_t{ 1 } << layer;
+		filter.maskBits = static_cast<uint64_t>(collidesWith) | k_QueryCategoryBit;
+		return filter;
+	}
+
+	b2QueryFilter CollisionLayers2D::MakeQueryFilter(uint64_t layerMask) {
+		b2QueryFilter filter = b2DefaultQueryFilter();
+		filter.categoryBits = k_QueryCategoryBit;
+		filter.maskBits = layerMask;
+		return filter;
+	}
+
+	void CollisionLayers2D::RefreshShapeFilters() {
+		for (const std::weak_ptr<Scene>& weakScene : SceneManager::Get().GetLoadedScenes()) {
+			std::shared_ptr<Scene> scene = weakScene.lock();
+			if (!scene) continue;
+
+			for (auto [entity, collider] : scene->GetRegistry().view<BoxCollider2DComponent>().each()) {
+				if (collider.IsValid()) {
+					collider.SetLayer(collider.GetLayer());
+				}
+			}
+		}
+	}
+
+	int CollisionLayers2D::GetLayerCount() {
+		const BoltProject* project = ProjectManager::GetCurrentProject();
+		return project ? static_cast<int>(project->CollisionLayers.size()) : 1;
+	}
+
+	std::string CollisionLayers2D::GetLayerName(int layer) {
+		const BoltProject* project = ProjectManager::GetCurrentProject();
+		if (project && layer >= 0 && layer < static_cast<int>(project->CollisionLayers.size())) {
+			return project->CollisionLayers[static_cast<size_t>(layer)];
+		}
+		return layer == 0 ? "Default" : "Layer " + std::to_string(layer);
+	}
+
+	int CollisionLayers2D::GetLayerIndex(const std::string& name) {
+		const BoltProject* project = ProjectManager::GetCurrentProject();
+		if (!project) return name == "Default" ? 0 : -1;
+		return project->GetCollisionLayerIndex(name);
+	}
+}
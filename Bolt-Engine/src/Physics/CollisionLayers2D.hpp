@@ -0,0 +1,25 @@
+#pragma once
+#include <box2d/types.h>
+
+#include <cstdint>
+#include <string>
+
+namespace Bolt {
+	// Info: Maps the current project's collision layer matrix onto Box2D filters.
+	// A shape on layer i gets category bit i and matrix row i as its mask, so the broadphase drops pairs that never collide.
+	class CollisionLayers2D {
+	public:
+		// Info: Category bit no shape uses, every shape mask carries it so queries are filtered by their own layer mask only
+		static constexpr uint64_t k_QueryCategoryBit = uint64_t{ 1 } << 63;
+
+		static b2Filter MakeShapeFilter(int layer);
+		static b2QueryFilter MakeQueryFilter(uint64_t layerMask);
+		// Info: Reapplies the layer matrix to every live collider, call after the project matrix changed
+		static void RefreshShapeFilters();
+
+		static int GetLayerCount();
+		static std::string GetLayerName(int layer);
+		// Info: -1 when the current project has no layer with this name
+		static int GetLayerIndex(const std::string& name);
+	};
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <box2d/box2d.h>
+
+#include "Collections/Vec2.hpp"
+#include "Scene/EntityHandle.hpp"
+
+#include <cstdint>
+
+namespace Bolt {
+
+	enum class ContactEventType2D : uint8_t {
+		Begin = 0,
+		End = 1,
+		Hit = 2
+	};
+
+	// Info: One buffered Box2D contact event. Point and normal are only filled for Begin and Hit,
+	// ApproachSpeed only for Hit. Entities are captured when the step ends and may be destroyed by the time they are read.
+	struct ContactEvent2D {
+		ContactEventType2D Type = ContactEventType2D::Begin;
+		EntityHandle EntityA = entt::null;
+		EntityHandle EntityB = entt::null;
+		b2ShapeId ShapeA = b2_nullShapeId;
+		b2ShapeId ShapeB = b2_nullShapeId;
+		Vec2 Point{};
+		Vec2 Normal{};
+		float ApproachSpeed = 0.0f;
+	};
+
+} // namespace Bolt
@@ -3,220 +3,194 @@
 #include "Physics/Physics2D.hpp"
 #include "Physics/PhysicsSystem2D.hpp"
 #include "Physics/Box2DWorld.hpp"
+#include "Physics/CollisionLayers2D.hpp"
+#include "Core/JobSystem.hpp"
 
-#include <Collections/Mat2.hpp>
 #include <Math/Common.hpp>
 
 #include <box2d/box2d.h>
 #include <box2d/types.h>
 #include <box2d/collision.h>
 
-namespace Bolt {
-	std::optional<EntityHandle> Physics2D::OverlapCircle(const Vec2& center, float radius, OverlapMode mode) {
-		auto& phys = PhysicsSystem2D::GetMainPhysicsWorld();
-		b2WorldId world = phys.m_WorldId;
-
-		b2ShapeProxy proxy{};
-		proxy.count = 1;
-		proxy.points[0] = { center.x, center.y };
-		proxy.radius = radius;
+#include <atomic>
 
-		b2QueryFilter filter = b2DefaultQueryFilter();
+namespace Bolt {
+	namespace {
+		// Info: A single query is a few microseconds, smaller batches are not worth a worker wake-up
+		constexpr size_t k_MinQueriesPerChunk = 64;
 
-		struct Qb {
-			Vec2 ctr;
-			OverlapMode mode;
-			std::optional<entt::entity> first;
-			std::optional<entt::entity> nearest;
-			float  bestDist2 = std::numeric_limits<float>::max();
+		EntityHandle GetShapeEntity(b2ShapeId shapeId) {
+			void* userData = b2Body_GetUserData(b2Shape_GetBody(shapeId));
+			return static_cast<EntityHandle>(reinterpret_cast<uintptr_t>(userData));
+		}
 
-			static bool Report(b2ShapeId sId, void* ctx) {
-				auto* self = static_cast<Qb*>(ctx);
+		b2ShapeProxy MakeCircleProxy(const Vec2& center, float radius) {
+			b2ShapeProxy proxy{};
+			proxy.count = 1;
+			proxy.points[0] = { center.x, center.y };
+			proxy.radius = radius;
+			return proxy;
+		}
 
-				b2BodyId bId = b2Shape_GetBody(sId);
-				void* ud = b2Body_GetUserData(bId);
-				entt::entity h = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(ud));
+		b2ShapeProxy MakeBoxProxy(const Vec2& center, const Vec2& halfExtents, float degrees) {
+			// Info: Same winding as the previous Mat2 based corners, degrees rotate clockwise
+			const b2Rot rotation = b2MakeRot(-Radians<float>(degrees));
+			const b2Vec2 corners[4] = {
+				{ halfExtents.x,  halfExtents.y },
+				{ -halfExtents.x,  halfExtents.y },
+				{ -halfExtents.x, -halfExtents.y },
+				{ halfExtents.x, -halfExtents.y }
+			};
+
+			b2ShapeProxy proxy{};
+			proxy.count = 4;
+			proxy.radius = 0.0f;
+			for (int i = 0; i < 4; ++i) {
+				const b2Vec2 rotated = b2RotateVector(rotation, corners[i]);
+				proxy.points[i] = { rotated.x + center.x, rotated.y + center.y };
+			}
+			return proxy;
+		}
 
-				if (self->mode == OverlapMode::First) {
-					self->first = h;
-					return false;
+		std::optional<EntityHandle> OverlapSingle(b2WorldId world, const b2ShapeProxy& proxy, const Vec2& center, OverlapMode mode, const b2QueryFilter& filter) {
+			struct Qb {
+				Vec2 ctr;
+				OverlapMode mode;
+				std::optional<EntityHandle> first;
+				std::optional<EntityHandle> nearest;
+				float bestDist2 = std::numeric_limits<float>::max();
+
+				static bool Report(b2ShapeId sId, void* ctx) {
+					auto* self = static_cast<Qb*>(ctx);
+					const EntityHandle h = GetShapeEntity(sId);
+
+					if (self->mode == OverlapMode::First) {
+						self->first = h;
+						return false;
+					}
+
+					b2Transform xf = b2Body_GetTransform(b2Shape_GetBody(sId));
+					float dx = xf.p.x - self->ctr.x;
+					float dy = xf.p.y - self->ctr.y;
+					float d2 = dx * dx + dy * dy;
+					if (d2 < self->bestDist2) {
+						self->bestDist2 = d2;
+						self->nearest = h;
+					}
+					return true;
 				}
+			} qb{ center, mode, std::nullopt, std::nullopt };
 
-				b2Transform xf = b2Body_GetTransform(bId);
-				float dx = xf.p.x - self->ctr.x;
-				float dy = xf.p.y - self->ctr.y;
-				float d2 = dx * dx + dy * dy;
-				if (d2 < self->bestDist2) {
-					self->bestDist2 = d2;
-					self->nearest = h;
-				}
-				return true;
-			}
-		} qb{ center, mode, std::nullopt, std::nullopt };
+			b2World_OverlapShape(world, &proxy, filter, Qb::Report, &qb);
 
-		b2World_OverlapShape(world, &proxy, filter, Qb::Report, &qb);
-
-		return (mode == OverlapMode::First ? qb.first : qb.nearest);
-	}
-	std::optional<EntityHandle> Physics2D::OverlapBox(const Vec2& center, const Vec2& halfExtents, float degrees, OverlapMode mode) {
-		auto& phys = PhysicsSystem2D::GetMainPhysicsWorld();
-		b2WorldId world = phys.m_WorldId;
-		float radians = Radians<float>(degrees);
-
-		Vec2 corners[4] = {
-			{ halfExtents.x,  halfExtents.y},
-			{-halfExtents.x,  halfExtents.y},
-			{-halfExtents.x, -halfExtents.y},
-			{ halfExtents.x, -halfExtents.y}
-		};
-		Mat2 rot = {
-			{ Cos(radians), -Sin(radians) },
-			{ Sin(radians),  Cos(radians) }
-		};
-
-		b2ShapeProxy proxy{};
-		proxy.count = 4;
-		proxy.radius = 0.0f;
-		for (int i = 0; i < 4; ++i) {
-			Vec2 w = rot * corners[i] + Vec2{ center.x, center.y };
-			proxy.points[i] = { w.x, w.y };
+			return (mode == OverlapMode::First ? qb.first : qb.nearest);
 		}
 
-		b2QueryFilter filter = b2DefaultQueryFilter();
+		std::vector<EntityHandle> OverlapAll(b2WorldId world, const b2ShapeProxy& proxy, const b2QueryFilter& filter) {
+			std::vector<EntityHandle> results;
+			struct Cb {
+				std::vector<EntityHandle>* out;
+				static bool Report(b2ShapeId sId, void* ctx) {
+					static_cast<Cb*>(ctx)->out->push_back(GetShapeEntity(sId));
+					return true;
+				}
+			} cb{ &results };
 
-		struct Qb {
-			Vec2 ctr;
-			OverlapMode mode;
-			std::optional<entt::entity> first;
-			std::optional<entt::entity> nearest;
-			float               bestDist2 = std::numeric_limits<float>::max();
+			b2World_OverlapShape(world, &proxy, filter, Cb::Report, &cb);
+			return results;
+		}
 
-			static bool Report(b2ShapeId sId, void* ctx) {
-				auto* self = static_cast<Qb*>(ctx);
+		std::optional<RaycastHit2D> RaycastSingle(b2WorldId world, const Vec2& origin, const Vec2& direction, float maxDistance, const b2QueryFilter& filter) {
+			b2Vec2 o{ origin.x, origin.y };
+			Vec2 nd = Normalized(direction);
+			b2Vec2 t{ nd.x * maxDistance, nd.y * maxDistance };
 
+			b2RayResult r = b2World_CastRayClosest(world, o, t, filter);
 
-				b2BodyId bId = b2Shape_GetBody(sId);
-				void* ud = b2Body_GetUserData(bId);
-				entt::entity h = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(ud));
+			if (!b2Shape_IsValid(r.shapeId))
+				return std::nullopt;
 
-				if (self->mode == OverlapMode::First) {
-					self->first = h;
-					return false;
-				}
+			RaycastHit2D hit;
+			hit.entity = GetShapeEntity(r.shapeId);
+			hit.point = { r.point.x, r.point.y };
+			hit.normal = { r.normal.x, r.normal.y };
+			hit.distance = r.fraction * maxDistance;
+			return hit;
+		}
 
-				b2Transform xf = b2Body_GetTransform(bId);
-				float dx = xf.p.x - self->ctr.x;
-				float dy = xf.p.y - self->ctr.y;
-				float d2 = dx * dx + dy * dy;
-				if (d2 < self->bestDist2) {
-					self->bestDist2 = d2;
-					self->nearest = h;
-				}
-				return true;
+		// Info: Box2D queries only read the world, so chunks of one batch can run concurrently between steps
+		template<typename TCommand, typename TResult, typename TQuery>
+		size_t RunBatch(std::span<const TCommand> commands, std::span<TResult> results, TQuery&& query) {
+			const size_t count = std::min(commands.size(), results.size());
+			if (count < commands.size()) {
+				BT_CORE_WARN_TAG("Physics2D", "Batch query has {} commands but only {} result slots", commands.size(), results.size());
 			}
-		} qb{ center, mode, std::nullopt, std::nullopt };
-
-		b2World_OverlapShape(world, &proxy, filter, Qb::Report, &qb);
 
-		return (mode == OverlapMode::First ? qb.first : qb.nearest);
+			std::atomic<size_t> hitCount{ 0 };
+			JobSystem::ParallelFor(count, k_MinQueriesPerChunk, [&](size_t begin, size_t end, size_t) {
+				size_t chunkHits = 0;
+				for (size_t i = begin; i < end; i++) {
+					if (query(commands[i], results[i])) chunkHits++;
+				}
+				hitCount.fetch_add(chunkHits, std::memory_order_relaxed);
+			});
+			return hitCount.load(std::memory_order_relaxed);
+		}
 	}
-	std::optional<RaycastHit2D> Physics2D::Raycast(const Vec2& origin,const Vec2& direction, float maxDistance) {
-		auto& phys = PhysicsSystem2D::GetMainPhysicsWorld();
-		b2WorldId world = phys.m_WorldId;
-
-		b2Vec2 o{ origin.x, origin.y };
-		Vec2 nd = Normalized(direction);
-		b2Vec2 t{ nd.x * maxDistance, nd.y * maxDistance };
-
-		b2QueryFilter filter = b2DefaultQueryFilter();
 
-		b2RayResult r = b2World_CastRayClosest(world, o, t, filter);
-
-		if (!b2Shape_IsValid(r.shapeId))
-			return std::nullopt;
-
-		b2BodyId   bId = b2Shape_GetBody(r.shapeId);
-		void* ud = b2Body_GetUserData(bId);
-		uintptr_t i = reinterpret_cast<uintptr_t>(ud);
-		EntityHandle e = static_cast<EntityHandle>(i);
-
-		RaycastHit2D hit;
-		hit.entity = e;
-		hit.point = { r.point.x, r.point.y };
-		hit.normal = { r.normal.x, r.normal.y };
-		hit.distance = r.fraction * maxDistance;
-		return hit;
+	std::optional<EntityHandle> Physics2D::OverlapCircle(const Vec2& center, float radius, OverlapMode mode, uint64_t layerMask) {
+		auto& phys = PhysicsSystem2D::GetMainPhysicsWorld();
+		return OverlapSingle(phys.m_WorldId, MakeCircleProxy(center, radius), center, mode, CollisionLayers2D::MakeQueryFilter(layerMask));
 	}
 
-	std::vector<EntityHandle> Physics2D::OverlapCircleAll(const Vec2& center, float radius) {
+	std::optional<EntityHandle> Physics2D::OverlapBox(const Vec2& center, const Vec2& halfExtents, float degrees, OverlapMode mode, uint64_t layerMask) {
 		auto& phys = PhysicsSystem2D::GetMainPhysicsWorld();
-		b2WorldId world = phys.m_WorldId;
-
-		b2ShapeProxy proxy{};
-		proxy.count = 1;
-		proxy.points[0] = { center.x, center.y };
-		proxy.radius = radius;
-
-		b2QueryFilter filter = b2DefaultQueryFilter();
-
-		std::vector<entt::entity> results;
-		struct Cb {
-			std::vector<entt::entity>* out;
-			static bool Report(b2ShapeId sId, void* ctx) {
-				auto* self = static_cast<Cb*>(ctx);
-				b2BodyId bId = b2Shape_GetBody(sId);
-				void* ud = b2Body_GetUserData(bId);
-				entt::entity h = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(ud));
-				self->out->push_back(h);
-				return true;
-			}
-		} cb{ &results };
+		return OverlapSingle(phys.m_WorldId, MakeBoxProxy(center, halfExtents, degrees), center, mode, CollisionLayers2D::MakeQueryFilter(layerMask));
+	}
 
-		b2World_OverlapShape(world, &proxy, filter, Cb::Report, &cb);
+	std::optional<RaycastHit2D> Physics2D::Raycast(const Vec2& origin, const Vec2& direction, float maxDistance, uint64_t layerMask) {
+		auto& phys = PhysicsSystem2D::GetMainPhysicsWorld();
+		return RaycastSingle(phys.m_WorldId, origin, direction, maxDistance, CollisionLayers2D::MakeQueryFilter(layerMask));
+	}
 
-		return results;
+	std::vector<EntityHandle> Physics2D::OverlapCircleAll(const Vec2& center, float radius, uint64_t layerMask) {
+		auto& phys = PhysicsSystem2D::GetMainPhysicsWorld();
+		return OverlapAll(phys.m_WorldId, MakeCircleProxy(center, radius), CollisionLayers2D::MakeQueryFilter(layerMask));
 	}
-	std::vector<EntityHandle> Physics2D::overlapBoxAll(const Vec2& center, const Vec2& halfExtents, float degrees) {
+
+	std::vector<EntityHandle> Physics2D::overlapBoxAll(const Vec2& center, const Vec2& halfExtents, float degrees, uint64_t layerMask) {
 		auto& phys = PhysicsSystem2D::GetMainPhysicsWorld();
-		b2WorldId world = phys.m_WorldId;
-		float radians = Radians<float>(degrees);
-
-		Vec2 corners[4] = {
-			{ halfExtents.x,  halfExtents.y},
-			{-halfExtents.x,  halfExtents.y},
-			{-halfExtents.x, -halfExtents.y},
-			{ halfExtents.x, -halfExtents.y}
-		};
-		Mat2 rot = {
-			{ Cos(radians), -Sin(radians) },
-			{ Sin(radians),  Cos(radians) }
-		};
-
-		b2ShapeProxy proxy{};
-		proxy.count = 4;
-		proxy.radius = 0.0f;
-		for (int i = 0; i < 4; ++i) {
-			Vec2 w = rot * corners[i] + Vec2{ center.x, center.y };
-			proxy.points[i] = { w.x, w.y };
-		}
+		return OverlapAll(phys.m_WorldId, MakeBoxProxy(center, halfExtents, degrees), CollisionLayers2D::MakeQueryFilter(layerMask));
+	}
 
-		b2QueryFilter filter = b2DefaultQueryFilter();
-
-		std::vector<entt::entity> results;
-		struct Cb {
-			std::vector<entt::entity>* out;
-			static bool Report(b2ShapeId sId, void* ctx) {
-				auto* self = static_cast<Cb*>(ctx);
-				b2BodyId bId = b2Shape_GetBody(sId);
-				void* ud = b2Body_GetUserData(bId);
-				entt::entity h = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(ud));
-				self->out->push_back(h);
+	size_t Physics2D::RaycastBatch(std::span<const RaycastCommand2D> commands, std::span<RaycastHit2D> results, uint64_t layerMask) {
+		const b2WorldId world = PhysicsSystem2D::GetMainPhysicsWorld().m_WorldId;
+		const b2QueryFilter filter = CollisionLayers2D::MakeQueryFilter(layerMask);
+		return RunBatch(commands, results, [world, filter](const RaycastCommand2D& command, RaycastHit2D& result) {
+			if (auto hit = RaycastSingle(world, command.Origin, command.Direction, command.MaxDistance, filter)) {
+				result = *hit;
 				return true;
 			}
-		} cb{ &results };
+			result = RaycastHit2D{ entt::null, { 0.0f, 0.0f }, { 0.0f, 0.0f }, 0.0f };
+			return false;
+		});
+	}
 
-		b2World_OverlapShape(world, &proxy, filter, Cb::Report, &cb);
+	size_t Physics2D::OverlapCircleBatch(std::span<const OverlapCircleCommand2D> commands, OverlapMode mode, std::span<EntityHandle> results, uint64_t layerMask) {
+		const b2WorldId world = PhysicsSystem2D::GetMainPhysicsWorld().m_WorldId;
+		const b2QueryFilter filter = CollisionLayers2D::MakeQueryFilter(layerMask);
+		return RunBatch(commands, results, [world, mode, filter](const OverlapCircleCommand2D& command, EntityHandle& result) {
+			result = OverlapSingle(world, MakeCircleProxy(command.Center, command.Radius), command.Center, mode, filter).value_or(entt::null);
+			return result != entt::null;
+		});
+	}
 
-		return results;
+	size_t Physics2D::OverlapBoxBatch(std::span<const OverlapBoxCommand2D> commands, OverlapMode mode, std::span<EntityHandle> results, uint64_t layerMask) {
+		const b2WorldId world = PhysicsSystem2D::GetMainPhysicsWorld().m_WorldId;
+		const b2QueryFilter filter = CollisionLayers2D::MakeQueryFilter(layerMask);
+		return RunBatch(commands, results, [world, mode, filter](const OverlapBoxCommand2D& command, EntityHandle& result) {
+			result = OverlapSingle(world, MakeBoxProxy(command.Center, command.HalfExtents, command.Degrees), command.Center, mode, filter).value_or(entt::null);
+			return result != entt::null;
+		});
 	}
-}
\ No newline at end of file
+}
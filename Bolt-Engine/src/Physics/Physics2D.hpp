@@ -1,9 +1,11 @@
 #pragma once
 #include "Collections/Vec2.hpp"
 #include "Physics/OverlapMode.hpp"
+#include "Physics/PhysicsTypes.hpp"
 #include "Physics/RaycastHit2D.hpp"
 
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace Bolt {
@@ -12,12 +14,36 @@ namespace Bolt {
 }
 
 namespace Bolt {
+	struct RaycastCommand2D {
+		Vec2 Origin;
+		Vec2 Direction;
+		float MaxDistance;
+	};
+
+	struct OverlapCircleCommand2D {
+		Vec2 Center;
+		float Radius;
+	};
+
+	struct OverlapBoxCommand2D {
+		Vec2 Center;
+		Vec2 HalfExtents;
+		float Degrees;
+	};
+
 	class Physics2D {
 	public:
-		static std::optional<EntityHandle> OverlapCircle(const Vec2& center, float radius, OverlapMode mode);
-		static std::optional<EntityHandle> OverlapBox(const Vec2& center, const Vec2& halfExtents, float degrees, OverlapMode mode);
-		static std::optional<RaycastHit2D> Raycast(const Vec2& origin, const Vec2& direction, float maxDistance);
-		static std::vector<EntityHandle> OverlapCircleAll(const Vec2& center, float radius);
-		static std::vector<EntityHandle> overlapBoxAll(const Vec2& center, const Vec2& halfExtents, float degrees);
+		// Info: layerMask selects collision layers (bit i = layer i), the broadphase skips shapes on other layers
+		static std::optional<EntityHandle> OverlapCircle(const Vec2& center, float radius, OverlapMode mode, uint64_t layerMask = k_AllCollisionLayers);
+		static std::optional<EntityHandle> OverlapBox(const Vec2& center, const Vec2& halfExtents, float degrees, OverlapMode mode, uint64_t layerMask = k_AllCollisionLayers);
+		static std::optional<RaycastHit2D> Raycast(const Vec2& origin, const Vec2& direction, float maxDistance, uint64_t layerMask = k_AllCollisionLayers);
+		static std::vector<EntityHandle> OverlapCircleAll(const Vec2& center, float radius, uint64_t layerMask = k_AllCollisionLayers);
+		static std::vector<EntityHandle> overlapBoxAll(const Vec2& center, const Vec2& halfExtents, float degrees, uint64_t layerMask = k_AllCollisionLayers);
+
+		// Info: Batched queries run across the JobSystem and write results[i] for commands[i].
+		// Misses are reported as entt::null, results must be at least as long as commands. Returns the hit count.
+		static size_t RaycastBatch(std::span<const RaycastCommand2D> commands, std::span<RaycastHit2D> results, uint64_t layerMask = k_AllCollisionLayers);
+		static size_t OverlapCircleBatch(std::span<const OverlapCircleCommand2D> commands, OverlapMode mode, std::span<EntityHandle> results, uint64_t layerMask = k_AllCollisionLayers);
+		static size_t OverlapBoxBatch(std::span<const OverlapBoxCommand2D> commands, OverlapMode mode, std::span<EntityHandle> results, uint64_t layerMask = k_AllCollisionLayers);
 	};
 }
@@ -10,6 +10,10 @@
 
 #include "Scene/SceneManager.hpp"
 #include "Scene/Scene.hpp"
+#include "Math/Trigonometry.hpp"
+#include "Math/VectorMath.hpp"
+
+#include <algorithm>
 
 
 namespace Bolt {
@@ -28,18 +32,13 @@ namespace Bolt {
 
 		// Box2D simulation
 		s_MainWorld->Step(dt);
-		s_MainWorld->GetDispatcher().Process(s_MainWorld->GetWorldID());
+		s_MainWorld->GetDispatcher().Capture(s_MainWorld->GetWorldID());
 
 		// Box2D transform sync
-		for (auto& weakScene : SceneManager::Get().GetLoadedScenes())
-		{
-			if (auto scene = weakScene.lock()) {
-				for (auto [ent, rb, tf] : scene->GetRegistry().view<Rigidbody2DComponent, Transform2DComponent>(entt::exclude<DisabledTag>).each()) {
-					tf.Position = rb.GetPosition();
-					tf.Rotation = rb.GetRotation();
-				}
-			}
-		}
+		SyncMovedBodies();
+
+		// Info: Callbacks run once the step and transform sync are done, scripts read the frame buffer later
+		s_MainWorld->GetDispatcher().Flush();
 
 		// Bolt-Physics simulation
 		s_BoltWorld->Step(dt);
@@ -48,14 +47,148 @@ namespace Bolt {
 		for (auto& weakScene : SceneManager::Get().GetLoadedScenes())
 		{
 			if (auto scene = weakScene.lock()) {
+				m_BoltMoved.clear();
 				for (auto [ent, body, tf] : scene->GetRegistry().view<BoltBody2DComponent, Transform2DComponent>(entt::exclude<DisabledTag>).each()) {
 					if (body.m_Body) {
 						auto pos = body.m_Body->GetPosition();
+						if (tf.Position.x == pos.x && tf.Position.y == pos.y) continue;
+
 						tf.Position = { pos.x, pos.y };
+						m_BoltMoved.push_back(ent);
+					}
+				}
+				scene->NotifyTransformsChanged(m_BoltMoved);
+			}
+		}
+	}
+
+	void PhysicsSystem2D::Interpolate(float alpha) {
+		if (!s_IsEnabled) return;
+
+		for (SceneBodies& bodies : m_SceneBodies) {
+			if (bodies.Interpolated.empty()) continue;
+
+			auto scene = bodies.Owner.lock();
+			if (!scene) continue;
+
+			entt::registry& registry = scene->GetRegistry();
+			for (EntityHandle entity : bodies.Interpolated) {
+				if (!registry.valid(entity)) continue;
+
+				const auto* rb = registry.try_get<Rigidbody2DComponent>(entity);
+				auto* tf = registry.try_get<Transform2DComponent>(entity);
+				if (!rb || !tf || rb->m_Interpolation != InterpolationMode::Interpolate) continue;
+
+				tf->Position = Lerp(rb->m_PreviousPosition, rb->m_CurrentPosition, alpha);
+				tf->Rotation = rb->m_PreviousRotation + NormalizeAngleSigned(rb->m_CurrentRotation - rb->m_PreviousRotation) * alpha;
+			}
+
+			scene->NotifyTransformsChanged(bodies.Interpolated);
+		}
+	}
+
+	PhysicsSystem2D::SceneBodies& PhysicsSystem2D::GetSceneBodies(const std::shared_ptr<Scene>& scene) {
+		for (SceneBodies& bodies : m_SceneBodies) {
+			if (bodies.Owner.lock() == scene) return bodies;
+		}
+
+		SceneBodies& bodies = m_SceneBodies.emplace_back();
+		bodies.Owner = scene;
+		return bodies;
+	}
+
+	void PhysicsSystem2D::SyncMovedBodies() {
+		m_StepIndex++;
+
+		// Info: Box2D reports only bodies that moved this step, sleeping and static bodies cost nothing
+		const b2BodyEvents events = b2World_GetBodyEvents(s_MainWorld->GetWorldID());
+		const bool hasInterpolated = std::any_of(m_SceneBodies.begin(), m_SceneBodies.end(),
+			[](const SceneBodies& bodies) { return !bodies.Interpolated.empty(); });
+		if (events.moveCount == 0 && !hasInterpolated) return;
+
+		std::erase_if(m_SceneBodies, [](const SceneBodies& bodies) { return bodies.Owner.expired(); });
+
+		const auto loadedScenes = SceneManager::Get().GetLoadedScenes();
+		std::vector<std::shared_ptr<Scene>> scenes;
+		scenes.reserve(loadedScenes.size());
+		for (const auto& weakScene : loadedScenes) {
+			if (auto scene = weakScene.lock()) {
+				GetSceneBodies(scene);
+				scenes.push_back(std::move(scene));
+			}
+		}
+
+		// Info: Pointers are taken after every bucket exists, emplace_back may move them
+		std::vector<SceneBodies*> sceneBodies(scenes.size());
+		for (size_t i = 0; i < scenes.size(); i++) {
+			SceneBodies& bodies = GetSceneBodies(scenes[i]);
+			bodies.Moved.clear();
+			std::swap(bodies.Interpolated, bodies.PreviousInterpolated);
+			bodies.Interpolated.clear();
+			sceneBodies[i] = &bodies;
+		}
+
+		for (int i = 0; i < events.moveCount; i++) {
+			const b2BodyMoveEvent& moveEvent = events.moveEvents[i];
+			const EntityHandle entity = static_cast<EntityHandle>(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(moveEvent.userData)));
+
+			// Info: All scenes share one world, the body id tells which scene owns this entity handle
+			for (size_t sceneIndex = 0; sceneIndex < scenes.size(); sceneIndex++) {
+				entt::registry& registry = scenes[sceneIndex]->GetRegistry();
+				if (!registry.valid(entity) || registry.all_of<DisabledTag>(entity)) continue;
+
+				auto* rb = registry.try_get<Rigidbody2DComponent>(entity);
+				if (!rb || !B2_ID_EQUALS(rb->m_BodyId, moveEvent.bodyId)) continue;
+
+				if (auto* tf = registry.try_get<Transform2DComponent>(entity)) {
+					const Vec2 position{ moveEvent.transform.p.x, moveEvent.transform.p.y };
+					const float rotation = -b2Rot_GetAngle(moveEvent.transform.q);	// Info: Same convention as Rigidbody2DComponent::GetRotation
+
+					if (rb->m_Interpolation == InterpolationMode::Interpolate) {
+						// Info: A body that also moved last step blends from its last simulated pose, a resting one from its transform
+						const bool movedLastStep = rb->m_InterpolationStep + 1 == m_StepIndex;
+						rb->m_PreviousPosition = movedLastStep ? rb->m_CurrentPosition : tf->Position;
+						rb->m_PreviousRotation = movedLastStep ? rb->m_CurrentRotation : tf->Rotation;
+						rb->m_CurrentPosition = position;
+						rb->m_CurrentRotation = rotation;
+						rb->m_InterpolationStep = m_StepIndex;
+						sceneBodies[sceneIndex]->Interpolated.push_back(entity);
 					}
+
+					tf->Position = position;
+					tf->Rotation = rotation;
+					sceneBodies[sceneIndex]->Moved.push_back(entity);
 				}
+				break;
 			}
 		}
+
+		for (size_t i = 0; i < scenes.size(); i++) {
+			SceneBodies& bodies = *sceneBodies[i];
+			entt::registry& registry = scenes[i]->GetRegistry();
+
+			// Info: Bodies that blended last frame but did not move this step come to rest on their simulated pose
+			for (EntityHandle entity : bodies.PreviousInterpolated) {
+				if (!registry.valid(entity)) continue;
+
+				const auto* rb = registry.try_get<Rigidbody2DComponent>(entity);
+				auto* tf = registry.try_get<Transform2DComponent>(entity);
+				if (!rb || !tf || rb->m_InterpolationStep == m_StepIndex) continue;
+
+				tf->Position = rb->m_CurrentPosition;
+				tf->Rotation = rb->m_CurrentRotation;
+				bodies.Moved.push_back(entity);
+			}
+			bodies.PreviousInterpolated.clear();
+
+			scenes[i]->NotifyTransformsChanged(bodies.Moved);
+		}
+	}
+
+	void PhysicsSystem2D::EndFrame() {
+		if (s_MainWorld) {
+			s_MainWorld->GetDispatcher().ClearFrameEvents();
+		}
 	}
 
 	void PhysicsSystem2D::Shutdown() {
@@ -64,5 +197,6 @@ namespace Bolt {
 			s_BoltWorld.reset();
 		}
 		s_MainWorld.reset();
+		m_SceneBodies.clear();
 	}
 }
\ No newline at end of file
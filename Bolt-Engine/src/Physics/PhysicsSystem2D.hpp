@@ -1,22 +1,48 @@
 #pragma once
+#include <memory>
 #include <optional>
+#include <vector>
 #include "Physics/Box2DWorld.hpp"
 #include "Physics/BoltPhysicsWorld2D.hpp"
+#include "Scene/EntityHandle.hpp"
 
 namespace Bolt {
+	class Scene;
 
 	class PhysicsSystem2D {
 	public:
 		void FixedUpdate(float dt);
+		// Info: Blends interpolated bodies between their last two fixed steps, alpha = accumulator / fixedDt
+		void Interpolate(float alpha);
+		// Info: Drops the contact events collected over this frame's fixed steps, after scripts have read them
+		void EndFrame();
 
 		void Initialize();
 		void Shutdown();
 
 		static Box2DWorld& GetMainPhysicsWorld() { return s_MainWorld.value(); }
+		static bool HasMainPhysicsWorld() { return s_MainWorld.has_value(); }
 		static BoltPhysicsWorld2D& GetBoltPhysicsWorld() { return s_BoltWorld.value(); }
 		static bool IsEnabled() { return s_IsEnabled; };
 		static void SetEnabled(bool enabled) { s_IsEnabled = enabled; }
 	private:
+		struct SceneBodies {
+			std::weak_ptr<Scene> Owner;
+			std::vector<EntityHandle> Moved;
+			std::vector<EntityHandle> Interpolated;
+			std::vector<EntityHandle> PreviousInterpolated;
+		};
+
+		void SyncMovedBodies();
+		SceneBodies& GetSceneBodies(const std::shared_ptr<Scene>& scene);
+
+		// Info: One bucket per loaded scene, reused across fixed steps
+		std::vector<SceneBodies> m_SceneBodies;
+		// Info: Starts at 1 so the first step (2) never counts as directly after a body's "never simulated" step 0
+		uint32_t m_StepIndex = 1;
+		// Info: Bolt-Physics bodies whose transform was written this step, reused per scene
+		std::vector<EntityHandle> m_BoltMoved;
+
 		static std::optional<Box2DWorld> s_MainWorld;
 		static std::optional<BoltPhysicsWorld2D> s_BoltWorld;
 		static bool s_IsEnabled;
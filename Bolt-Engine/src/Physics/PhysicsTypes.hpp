@@ -4,4 +4,9 @@
 namespace Bolt {
     enum  class ShapeType : int { Square, Circle, Polygon };
     enum class BodyType : int { Static, Kinematic, Dynamic };
+    // Info: Interpolate blends the rendered transform between the last two fixed steps
+    enum class InterpolationMode : int { None, Interpolate };
+
+    // Info: Query layer mask that hits every collision layer
+    inline constexpr uint64_t k_AllCollisionLayers = UINT64_MAX;
 }
\ No newline at end of file
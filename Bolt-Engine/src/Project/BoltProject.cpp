@@ -7,6 +7,7 @@
 #include "Core/Log.hpp"
 #include "Core/Version.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <ctime>
@@ -170,6 +171,18 @@ namespace Bolt {
 			buildScenes.Append(sceneName);
 		}
 		root.AddMember("buildScenes", std::move(buildScenes));
+
+		Json::Value collisionLayers = Json::Value::MakeArray();
+		for (const std::string& layerName : project.CollisionLayers) {
+			collisionLayers.Append(layerName);
+		}
+		root.AddMember("collisionLayers", std::move(collisionLayers));
+
+		Json::Value collisionMatrix = Json::Value::MakeArray();
+		for (uint32_t row : project.CollisionMatrix) {
+			collisionMatrix.Append(Json::Value(static_cast<uint64_t>(row)));
+		}
+		root.AddMember("collisionMatrix", std::move(collisionMatrix));
 		return root;
 	}
 
@@ -205,6 +218,43 @@ namespace Bolt {
 		return fallbackCandidate.make_preferred().string();
 	}
 
+	uint32_t BoltProject::GetCollisionMask(int layer) const {
+		if (layer < 0 || layer >= static_cast<int>(CollisionMatrix.size())) {
+			return UINT32_MAX;
+		}
+		return CollisionMatrix[static_cast<size_t>(layer)];
+	}
+
+	void BoltProject::SetLayersCollide(int layerA, int layerB, bool collide) {
+		if (layerA < 0 || layerB < 0 || layerA >= k_MaxCollisionLayers || layerB >= k_MaxCollisionLayers) {
+			return;
+		}
+
+		const size_t rows = static_cast<size_t>(std::max(layerA, layerB)) + 1;
+		if (CollisionMatrix.size() < rows) {
+			CollisionMatrix.resize(rows, UINT32_MAX);
+		}
+
+		// Info: Kept symmetric, Box2D only lets a pair collide when both shapes accept each other
+		const uint32_t bitA = uint32_t{ 1 } << layerA;
+		const uint32_t bitB = uint32_t{ 1 } << layerB;
+		if (collide) {
+			CollisionMatrix[layerA] |= bitB;
+			CollisionMatrix[layerB] |= bitA;
+		}
+		else {
+			CollisionMatrix[layerA] &= ~bitB;
+			CollisionMatrix[layerB] &= ~bitA;
+		}
+	}
+
+	int BoltProject::GetCollisionLayerIndex(const std::string& name) const {
+		for (size_t i = 0; i < CollisionLayers.size(); i++) {
+			if (CollisionLayers[i] == name) return static_cast<int>(i);
+		}
+		return -1;
+	}
+
 	std::string BoltProject::GetSceneFilePath(const std::string& sceneName) const {
 		return Path::Combine(ScenesDirectory, sceneName + ".scene");
 	}
@@ -283,6 +333,23 @@ namespace Bolt {
 						}
 					}
 				}
+				if (const Json::Value* layersValue = root.FindMember("collisionLayers")) {
+					project.CollisionLayers.clear();
+					for (const Json::Value& layerValue : layersValue->GetArray()) {
+						if (project.CollisionLayers.size() >= static_cast<size_t>(k_MaxCollisionLayers)) break;
+						project.CollisionLayers.push_back(layerValue.AsStringOr());
+					}
+					if (project.CollisionLayers.empty()) {
+						project.CollisionLayers.push_back("Default");
+					}
+				}
+				if (const Json::Value* matrixValue = root.FindMember("collisionMatrix")) {
+					project.CollisionMatrix.clear();
+					for (const Json::Value& rowValue : matrixValue->GetArray()) {
+						if (project.CollisionMatrix.size() >= static_cast<size_t>(k_MaxCollisionLayers)) break;
+						project.CollisionMatrix.push_back(static_cast<uint32_t>(rowValue.AsUInt64Or(UINT32_MAX)));
+					}
+				}
 			}
 			else if (!jsonText.empty()) {
 				BT_CORE_WARN_TAG("BoltProject", "Failed to parse '{}': {}", configPath, parseError);
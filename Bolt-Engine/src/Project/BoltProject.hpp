@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Export.hpp"
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -32,6 +33,18 @@ namespace Bolt {
 		std::string AppIconPath;
 		std::vector<std::string> BuildSceneList;
 
+		// Physics
+		static constexpr int k_MaxCollisionLayers = 32;
+		// Info: Index is the layer, layer 0 is the default for every new collider
+		std::vector<std::string> CollisionLayers = { "Default" };
+		// Info: Bit j of row i is set when layer i collides with layer j, layers without a row collide with everything
+		std::vector<uint32_t> CollisionMatrix;
+
+		uint32_t GetCollisionMask(int layer) const;
+		void SetLayersCollide(int layerA, int layerB, bool collide);
+		// Info: -1 when no layer has this name
+		int GetCollisionLayerIndex(const std::string& name) const;
+
 		std::string GetUserAssemblyOutputPath() const;
 		std::string GetNativeDllPath() const;
 		std::string GetSceneFilePath(const std::string& sceneName) const;
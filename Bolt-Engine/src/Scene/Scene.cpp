@@ -20,6 +20,7 @@
 #include "Components/Graphics/Camera2DComponent.hpp"
 #include "Components/General/UUIDComponent.hpp"
 #include "Core/Application.hpp"
+#include "Math/Random.hpp"
 
 namespace Bolt {
 	Entity Scene::CreateEntity() {
@@ -64,6 +65,13 @@ namespace Bolt {
 
 	void Scene::MarkDirty() { if (!Application::GetIsPlaying()) m_Dirty = true; }
 
+	void Scene::NotifyTransformsChanged(std::span<const EntityHandle> entities) {
+		if (entities.empty()) return;
+
+		m_SpatialIndex.Refresh(entities);
+		m_TransformsChanged.publish(*this, entities);
+	}
+
 	Camera2DComponent* Scene::GetMainCamera() {
 		const auto isUsableCamera = [this](EntityHandle entity) {
 			return entity != entt::null
@@ -163,6 +171,7 @@ namespace Bolt {
 		m_Registry.on_construct<Camera2DComponent>().connect<&Scene::OnCamera2DComponentConstruct>(this);
 		m_Registry.on_construct<ParticleSystem2DComponent>().connect<&Scene::OnParticleSystem2DComponentConstruct>(this);
 		m_Registry.on_construct<DisabledTag>().connect<&Scene::OnDisabledTagConstruct>(this);
+		m_Registry.on_construct<UUIDComponent>().connect<&Scene::OnUUIDComponentConstruct>(this);
 
 		m_Registry.on_destroy<Rigidbody2DComponent>().connect<&Scene::OnRigidBody2DComponentDestroy>(this);
 		m_Registry.on_destroy<BoxCollider2DComponent>().connect<&Scene::OnBoxCollider2DComponentDestroy>(this);
@@ -170,6 +179,12 @@ namespace Bolt {
 		m_Registry.on_destroy<Camera2DComponent>().connect<&Scene::OnCamera2DComponentDestruct>(this);
 		m_Registry.on_destroy<ParticleSystem2DComponent>().connect<&Scene::OnParticleSystem2DComponentDestruct>(this);
 		m_Registry.on_destroy<DisabledTag>().connect<&Scene::OnDisabledTagDestroy>(this);
+		m_Registry.on_destroy<UUIDComponent>().connect<&Scene::OnUUIDComponentDestroy>(this);
+		m_Registry.on_construct<Transform2DComponent>().connect<&Scene::OnSpatialIndexedComponentConstruct>(this);
+		m_Registry.on_construct<SpriteRendererComponent>().connect<&Scene::OnSpatialIndexedComponentConstruct>(this);
+		m_Registry.on_update<Transform2DComponent>().connect<&Scene::OnSpatialIndexedComponentConstruct>(this);
+		m_Registry.on_destroy<Transform2DComponent>().connect<&Scene::OnSpatialIndexedComponentDestroy>(this);
+		m_Registry.on_destroy<SpriteRendererComponent>().connect<&Scene::OnSpatialIndexedComponentDestroy>(this);
 
 		// Bolt-Physics component hooks
 		m_Registry.on_construct<BoltBody2DComponent>().connect<&Scene::OnBoltBody2DConstruct>(this);
@@ -303,6 +318,7 @@ namespace Bolt {
 		auto& ps = registry.get<ParticleSystem2DComponent>(entity);
 		ps.m_EmitterScene = this;
 		ps.m_EmitterEntity = entity;
+		ps.m_Random = Random::CreateStream();
 	}
 
 	void Scene::OnParticleSystem2DComponentDestruct(entt::registry& registry, EntityHandle entity) {
@@ -311,13 +327,50 @@ namespace Bolt {
 		ps.m_EmitterEntity = entt::null;
 	}
 
+	void Scene::OnSpatialIndexedComponentConstruct(entt::registry& registry, EntityHandle entity) {
+		m_SpatialIndex.Track(entity);
+	}
+
+	void Scene::OnSpatialIndexedComponentDestroy(entt::registry& registry, EntityHandle entity) {
+		m_SpatialIndex.Remove(entity);
+	}
+
+	void Scene::OnUUIDComponentConstruct(entt::registry& registry, EntityHandle entity) {
+		const uint64_t uuid = static_cast<uint64_t>(registry.get<UUIDComponent>(entity).Id);
+		auto [it, inserted] = m_EntityByUUID.try_emplace(uuid, entity);
+		if (!inserted && it->second != entity) {
+			BT_CORE_WARN_TAG("Scene", "UUID {} is already used by entity {}, lookups keep resolving to that entity", uuid, static_cast<uint32_t>(it->second));
+		}
+	}
+
+	void Scene::OnUUIDComponentDestroy(entt::registry& registry, EntityHandle entity) {
+		const uint64_t uuid = static_cast<uint64_t>(registry.get<UUIDComponent>(entity).Id);
+		auto it = m_EntityByUUID.find(uuid);
+		if (it != m_EntityByUUID.end() && it->second == entity) {
+			m_EntityByUUID.erase(it);
+		}
+	}
+
+	void Scene::SetEntityUUID(EntityHandle entity, UUID uuid) {
+		auto* component = m_Registry.try_get<UUIDComponent>(entity);
+		if (!component) {
+			m_Registry.emplace<UUIDComponent>(entity, uuid);
+			return;
+		}
+
+		// Info: Runs the destroy/construct index updates around the change
+		OnUUIDComponentDestroy(m_Registry, entity);
+		component->Id = uuid;
+		OnUUIDComponentConstruct(m_Registry, entity);
+	}
+
 	// ── Bolt-Physics component hooks ────────────────────────────────
 
 	void Scene::OnBoltBody2DConstruct(entt::registry& registry, EntityHandle entity) {
 		auto& comp = registry.get<BoltBody2DComponent>(entity);
 		auto& boltWorld = PhysicsSystem2D::GetBoltPhysicsWorld();
 
-		comp.m_Body = boltWorld.CreateBody(entity, comp.Type);
+		comp.m_Body = boltWorld.CreateBody(registry, entity, comp.Type);
 		if (comp.m_Body) {
 			comp.m_Body->SetMass(comp.Mass);
 			comp.m_Body->SetGravityEnabled(comp.UseGravity);
@@ -332,27 +385,27 @@ namespace Bolt {
 	}
 
 	void Scene::OnBoltBody2DDestroy(entt::registry& registry, EntityHandle entity) {
-		PhysicsSystem2D::GetBoltPhysicsWorld().DestroyBody(entity);
+		PhysicsSystem2D::GetBoltPhysicsWorld().DestroyBody(registry, entity);
 	}
 
 	void Scene::OnBoltBoxCollider2DConstruct(entt::registry& registry, EntityHandle entity) {
 		auto& comp = registry.get<BoltBoxCollider2DComponent>(entity);
 		auto& boltWorld = PhysicsSystem2D::GetBoltPhysicsWorld();
-		comp.m_Collider = boltWorld.CreateBoxCollider(entity, comp.HalfExtents);
+		comp.m_Collider = boltWorld.CreateBoxCollider(registry, entity, comp.HalfExtents);
 	}
 
 	void Scene::OnBoltBoxCollider2DDestroy(entt::registry& registry, EntityHandle entity) {
-		PhysicsSystem2D::GetBoltPhysicsWorld().DestroyCollider(entity);
+		PhysicsSystem2D::GetBoltPhysicsWorld().DestroyCollider(registry, entity);
 	}
 
 	void Scene::OnBoltCircleCollider2DConstruct(entt::registry& registry, EntityHandle entity) {
 		auto& comp = registry.get<BoltCircleCollider2DComponent>(entity);
 		auto& boltWorld = PhysicsSystem2D::GetBoltPhysicsWorld();
-		comp.m_Collider = boltWorld.CreateCircleCollider(entity, comp.Radius);
+		comp.m_Collider = boltWorld.CreateCircleCollider(registry, entity, comp.Radius);
 	}
 
 	void Scene::OnBoltCircleCollider2DDestroy(entt::registry& registry, EntityHandle entity) {
-		PhysicsSystem2D::GetBoltPhysicsWorld().DestroyCollider(entity);
+		PhysicsSystem2D::GetBoltPhysicsWorld().DestroyCollider(registry, entity);
 	}
 
 	void Scene::ApplyEntityEnabledState(entt::registry& registry, EntityHandle entity, bool enabled)
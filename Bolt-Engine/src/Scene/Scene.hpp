@@ -1,8 +1,11 @@
 #pragma once
 #include "Scene/Entity.hpp"
 #include "Scene/ISystem.hpp"
+#include "Scene/SpatialIndex2D.hpp"
 #include "Core/Export.hpp"
 #include "Core/UUID.hpp"
+#include <span>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace Bolt {
@@ -33,6 +36,14 @@ namespace Bolt {
 		bool IsValid(EntityHandle nativeEntity) const {
 			return m_Registry.valid(nativeEntity);
 		}
+
+		// Info: Constant time UUID lookup, the index follows UUIDComponent construct/destroy signals. entt::null if not found
+		EntityHandle FindEntityByUUID(uint64_t uuid) const {
+			auto it = m_EntityByUUID.find(uuid);
+			return it != m_EntityByUUID.end() ? it->second : entt::null;
+		}
+		// Info: Reassigns an entity's UUID, never write UUIDComponent::Id directly or the index goes stale
+		void SetEntityUUID(EntityHandle entity, UUID uuid);
 		template<typename TComponent, typename... Args>
 			requires (!std::is_empty_v<TComponent>)
 		TComponent& AddComponent(EntityHandle entity, Args&&... args) {
@@ -182,6 +193,16 @@ namespace Bolt {
 		UUID GetSceneId() const { return m_SceneId; }
 		void SetSceneId(UUID id) { m_SceneId = id; }
 
+		// Info: Flushed lazily by its readers, so it is reachable from const render paths
+		SpatialIndex2D& GetSpatialIndex() const { return m_SpatialIndex; }
+
+		using TransformsChangedSignal = entt::sigh<void(Scene&, std::span<const EntityHandle>)>;
+		// Info: Published when Transform2D values were written (physics, scripts, editor)
+		entt::sink<TransformsChangedSignal> OnTransformsChanged() { return entt::sink{ m_TransformsChanged }; }
+		// Info: Every code path writing Transform2D fields directly must report it here, the spatial index never rescans
+		void NotifyTransformsChanged(std::span<const EntityHandle> entities);
+		void NotifyTransformChanged(EntityHandle entity) { NotifyTransformsChanged({ &entity, 1 }); }
+
 	private:
 		Scene(const std::string& name, const SceneDefinition* definition, bool IsPersistent);
 
@@ -199,6 +220,10 @@ namespace Bolt {
 
 		void OnParticleSystem2DComponentConstruct(entt::registry& registry, EntityHandle entity);
 		void OnParticleSystem2DComponentDestruct(entt::registry& registry, EntityHandle entity);
+		void OnSpatialIndexedComponentConstruct(entt::registry& registry, EntityHandle entity);
+		void OnSpatialIndexedComponentDestroy(entt::registry& registry, EntityHandle entity);
+		void OnUUIDComponentConstruct(entt::registry& registry, EntityHandle entity);
+		void OnUUIDComponentDestroy(entt::registry& registry, EntityHandle entity);
 
 		void OnBoltBody2DConstruct(entt::registry& registry, EntityHandle entity);
 		void OnBoltBody2DDestroy(entt::registry& registry, EntityHandle entity);
@@ -251,5 +276,8 @@ namespace Bolt {
 		bool m_Persistent = false;
 		bool m_Dirty = false;
 		std::unordered_set<uint32_t> m_EntitiesBeingDestroyed;
+		mutable SpatialIndex2D m_SpatialIndex;
+		TransformsChangedSignal m_TransformsChanged;
+		std::unordered_map<uint64_t, EntityHandle> m_EntityByUUID;
 	};
 }
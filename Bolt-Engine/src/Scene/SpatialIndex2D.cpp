@@ -0,0 +1,216 @@
+#include "pch.hpp"
+#include "Scene/SpatialIndex2D.hpp"
+#include "Components/General/Transform2DComponent.hpp"
+#include "Components/Graphics/SpriteRendererComponent.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Bolt {
+	void SpatialIndex2D::Track(EntityHandle entity) {
+		m_Queued.push_back(entity);
+	}
+
+	void SpatialIndex2D::Refresh(std::span<const EntityHandle> entities) {
+		m_Queued.insert(m_Queued.end(), entities.begin(), entities.end());
+	}
+
+	void SpatialIndex2D::Flush(const entt::registry& registry) {
+		for (EntityHandle entity : m_Queued) {
+			// Info: Queued before its second indexed component was added, or destroyed since
+			if (!registry.valid(entity) || !registry.all_of<Transform2DComponent, SpriteRendererComponent>(entity)) continue;
+
+			const uint32_t id = static_cast<uint32_t>(entt::to_entity(entity));
+			uint32_t entryIndex = id < m_EntryOfEntity.size() ? m_EntryOfEntity[id] : k_InvalidEntry;
+			if (entryIndex == k_InvalidEntry || m_Entries[entryIndex].Entity != entity) {
+				entryIndex = AcquireEntry(entity);
+			}
+
+			// Info: Entities queued twice are placed twice, the second Place sees unchanged cells and returns early
+			Place(entryIndex, registry.get<Transform2DComponent>(entity));
+		}
+		m_Queued.clear();
+	}
+
+	void SpatialIndex2D::Query(const AABB& bounds, std::vector<EntityHandle>& outEntities) {
+		outEntities.clear();
+
+		if (++m_QueryStamp == 0) {
+			for (Entry& entry : m_Entries) entry.QueryStamp = 0;
+			m_QueryStamp = 1;
+		}
+
+		const auto visit = [&](uint32_t entryIndex) {
+			Entry& entry = m_Entries[entryIndex];
+			if (entry.QueryStamp == m_QueryStamp) return;
+			entry.QueryStamp = m_QueryStamp;
+
+			if (AABB::Intersects(bounds, entry.Bounds)) {
+				outEntities.push_back(entry.Entity);
+			}
+		};
+
+		for (uint32_t entryIndex : m_Oversized) {
+			visit(entryIndex);
+		}
+
+		const int minX = ToCell(bounds.Min.x);
+		const int minY = ToCell(bounds.Min.y);
+		const int maxX = ToCell(bounds.Max.x);
+		const int maxY = ToCell(bounds.Max.y);
+		const int64_t queryCells = (static_cast<int64_t>(maxX) - minX + 1) * (static_cast<int64_t>(maxY) - minY + 1);
+
+		// Info: A zoomed out view can cover far more cells than are occupied, walk the occupied ones instead
+		if (queryCells > static_cast<int64_t>(m_Cells.size())) {
+			for (const auto& [key, cell] : m_Cells) {
+				for (uint32_t entryIndex : cell) visit(entryIndex);
+			}
+		}
+		else {
+			for (int y = minY; y <= maxY; y++) {
+				for (int x = minX; x <= maxX; x++) {
+					auto it = m_Cells.find(CellKey(x, y));
+					if (it == m_Cells.end()) continue;
+
+					for (uint32_t entryIndex : it->second) visit(entryIndex);
+				}
+			}
+		}
+
+		// Info: Keeps the draw order of equal sort keys stable regardless of cell iteration order
+		std::sort(outEntities.begin(), outEntities.end());
+	}
+
+	void SpatialIndex2D::Remove(EntityHandle entity) {
+		const uint32_t id = static_cast<uint32_t>(entt::to_entity(entity));
+		if (id >= m_EntryOfEntity.size()) return;
+
+		const uint32_t entryIndex = m_EntryOfEntity[id];
+		if (entryIndex == k_InvalidEntry || m_Entries[entryIndex].Entity != entity) return;
+
+		Unlink(entryIndex);
+		m_Entries[entryIndex].Entity = entt::null;
+		m_EntryOfEntity[id] = k_InvalidEntry;
+		m_FreeEntries.push_back(entryIndex);
+	}
+
+	void SpatialIndex2D::Clear() {
+		m_Entries.clear();
+		m_FreeEntries.clear();
+		m_EntryOfEntity.clear();
+		m_Cells.clear();
+		m_Oversized.clear();
+		m_Queued.clear();
+		m_QueryStamp = 0;
+	}
+
+	void SpatialIndex2D::SetCellSize(float cellSize) {
+		if (cellSize <= 0.0f) {
+			BT_CORE_WARN_TAG("SpatialIndex2D", "Cell size must be positive, got {}", cellSize);
+			return;
+		}
+
+		std::vector<EntityHandle> indexed;
+		indexed.reserve(GetEntryCount() + m_Queued.size());
+		for (const Entry& entry : m_Entries) {
+			if (entry.Entity != entt::null) indexed.push_back(entry.Entity);
+		}
+		indexed.insert(indexed.end(), m_Queued.begin(), m_Queued.end());
+
+		m_CellSize = cellSize;
+		m_InvCellSize = 1.0f / cellSize;
+
+		// Info: Every entity is re-bucketed by the next Flush
+		Clear();
+		m_Queued = std::move(indexed);
+	}
+
+	uint32_t SpatialIndex2D::AcquireEntry(EntityHandle entity) {
+		uint32_t entryIndex;
+		if (!m_FreeEntries.empty()) {
+			entryIndex = m_FreeEntries.back();
+			m_FreeEntries.pop_back();
+			m_Entries[entryIndex] = Entry{};
+		}
+		else {
+			entryIndex = static_cast<uint32_t>(m_Entries.size());
+			m_Entries.emplace_back();
+		}
+
+		m_Entries[entryIndex].Entity = entity;
+
+		const uint32_t id = static_cast<uint32_t>(entt::to_entity(entity));
+		if (id >= m_EntryOfEntity.size()) {
+			m_EntryOfEntity.resize(static_cast<size_t>(id) + 1, k_InvalidEntry);
+		}
+		m_EntryOfEntity[id] = entryIndex;
+		return entryIndex;
+	}
+
+	void SpatialIndex2D::Place(uint32_t entryIndex, const Transform2DComponent& transform) {
+		Entry& entry = m_Entries[entryIndex];
+		const AABB bounds = AABB::FromTransform(transform);
+		const int minX = ToCell(std::min(bounds.Min.x, bounds.Max.x));
+		const int minY = ToCell(std::min(bounds.Min.y, bounds.Max.y));
+		const int maxX = ToCell(std::max(bounds.Min.x, bounds.Max.x));
+		const int maxY = ToCell(std::max(bounds.Min.y, bounds.Max.y));
+		entry.Bounds = bounds;
+
+		const bool oversized = (static_cast<int64_t>(maxX) - minX + 1) * (static_cast<int64_t>(maxY) - minY + 1) > k_MaxCellsPerEntry;
+		if (entry.Oversized == oversized && (oversized || (entry.MinCellX == minX && entry.MinCellY == minY
+			&& entry.MaxCellX == maxX && entry.MaxCellY == maxY))) {
+			return;
+		}
+
+		Unlink(entryIndex);
+
+		entry.MinCellX = minX;
+		entry.MinCellY = minY;
+		entry.MaxCellX = maxX;
+		entry.MaxCellY = maxY;
+		entry.Oversized = oversized;
+
+		if (oversized) {
+			m_Oversized.push_back(entryIndex);
+			return;
+		}
+
+		for (int y = minY; y <= maxY; y++) {
+			for (int x = minX; x <= maxX; x++) {
+				m_Cells[CellKey(x, y)].push_back(entryIndex);
+			}
+		}
+	}
+
+	void SpatialIndex2D::Unlink(uint32_t entryIndex) {
+		Entry& entry = m_Entries[entryIndex];
+
+		const auto erase = [entryIndex](std::vector<uint32_t>& list) {
+			auto it = std::find(list.begin(), list.end(), entryIndex);
+			if (it == list.end()) return;
+			*it = list.back();
+			list.pop_back();
+		};
+
+		if (entry.Oversized) {
+			erase(m_Oversized);
+		}
+		else {
+			for (int y = entry.MinCellY; y <= entry.MaxCellY; y++) {
+				for (int x = entry.MinCellX; x <= entry.MaxCellX; x++) {
+					auto it = m_Cells.find(CellKey(x, y));
+					if (it == m_Cells.end()) continue;
+
+					erase(it->second);
+					if (it->second.empty()) m_Cells.erase(it);
+				}
+			}
+		}
+
+		entry.Oversized = false;
+		entry.MinCellX = 0;
+		entry.MinCellY = 0;
+		entry.MaxCellX = -1;
+		entry.MaxCellY = -1;
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "Scene/EntityHandle.hpp"
+#include "Collections/AABB.hpp"
+#include "Core/Export.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Bolt {
+
+	// Info: Uniform hash grid over every Transform2D + SpriteRenderer entity of a scene.
+	// The scene queues entities from component construct signals and from Scene::NotifyTransformsChanged,
+	// Flush() re-buckets only those, so an idle frame costs nothing; Query() then touches just the cells under the view.
+	class BOLT_API SpatialIndex2D {
+	public:
+		static constexpr float k_DefaultCellSize = 8.0f;
+		// Info: Entities spanning more cells than this are kept in a flat list that every query visits
+		static constexpr int k_MaxCellsPerEntry = 16;
+
+		// Info: Queues an entity whose indexed components were just added, placed by the next Flush once both exist
+		void Track(EntityHandle entity);
+		// Info: Queues entities whose Transform2D was written
+		void Refresh(std::span<const EntityHandle> entities);
+		// Info: Places every queued entity, call before Query
+		void Flush(const entt::registry& registry);
+		void Query(const AABB& bounds, std::vector<EntityHandle>& outEntities);
+
+		void Remove(EntityHandle entity);
+		void Clear();
+
+		void SetCellSize(float cellSize);
+		float GetCellSize() const { return m_CellSize; }
+		size_t GetEntryCount() const { return m_Entries.size() - m_FreeEntries.size(); }
+
+	private:
+		struct Entry {
+			EntityHandle Entity = entt::null;
+			AABB Bounds;
+			int MinCellX = 0, MinCellY = 0, MaxCellX = -1, MaxCellY = -1;
+			bool Oversized = false;
+			uint32_t QueryStamp = 0;
+		};
+
+		static constexpr uint32_t k_InvalidEntry = UINT32_MAX;
+
+		uint32_t AcquireEntry(EntityHandle entity);
+		void Place(uint32_t entryIndex, const Transform2DComponent& transform);
+		void Unlink(uint32_t entryIndex);
+
+		static uint64_t CellKey(int x, int y) {
+			return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+		}
+		int ToCell(float coordinate) const { return static_cast<int>(std::floor(coordinate * m_InvCellSize)); }
+
+		float m_CellSize = k_DefaultCellSize;
+		float m_InvCellSize = 1.0f / k_DefaultCellSize;
+		uint32_t m_QueryStamp = 0;
+
+		std::vector<Entry> m_Entries;
+		std::vector<uint32_t> m_FreeEntries;
+		std::vector<uint32_t> m_EntryOfEntity;	// Info: Indexed by entt::to_entity
+		std::unordered_map<uint64_t, std::vector<uint32_t>> m_Cells;
+		std::vector<uint32_t> m_Oversized;
+		std::vector<EntityHandle> m_Queued;
+	};
+}
@@ -46,6 +46,7 @@ namespace Bolt {
 		auto handle = static_cast<EntityHandle>(entityID);
 		if (!scene->HasComponent<Transform2DComponent>(handle)) return;
 		scene->GetComponent<Transform2DComponent>(handle).Position = { x, y };
+		scene->NotifyTransformChanged(handle);
 	}
 	static float API_GetRotation(uint32_t entityID) {
 		Scene* scene = ScriptEngine::GetScene();
@@ -60,6 +61,7 @@ namespace Bolt {
 		auto handle = static_cast<EntityHandle>(entityID);
 		if (!scene->HasComponent<Transform2DComponent>(handle)) return;
 		scene->GetComponent<Transform2DComponent>(handle).Rotation = rot;
+		scene->NotifyTransformChanged(handle);
 	}
 
 	static NativeEngineAPI s_EngineAPI = {
@@ -34,6 +34,8 @@
 #include "Graphics/Gizmo.hpp"
 #include "Physics/Physics2D.hpp"
 
+#include <array>
+
 namespace Bolt {
 	EntityHandle ToEntityHandle(uint64_t id)
 	{
@@ -56,15 +58,13 @@ namespace Bolt {
 
 	bool TryResolveEntityByUUID(const Scene& scene, uint64_t entityID, EntityHandle& outHandle)
 	{
-		auto view = scene.GetRegistry().view<UUIDComponent>();
-		for (EntityHandle handle : view) {
-			if (static_cast<uint64_t>(view.get<UUIDComponent>(handle).Id) == entityID) {
-				outHandle = handle;
-				return true;
-			}
+		const EntityHandle handle = scene.FindEntityByUUID(entityID);
+		if (handle == entt::null) {
+			return false;
 		}
 
-		return false;
+		outHandle = handle;
+		return true;
 	}
 
 	bool ResolveEntityReference(uint64_t entityID, Scene*& outScene, EntityHandle& outHandle)
@@ -223,14 +223,10 @@ namespace Bolt {
 	static const char* Bolt_Scene_GetEntityNameByUUID(uint64_t uuid) {
 		Scene* scene = GetScene();
 		if (!scene) { s_StringReturnBuffer.clear(); return s_StringReturnBuffer.c_str(); }
-		auto view = scene->GetRegistry().view<UUIDComponent, NameComponent>();
-		for (auto [ent, uuidComp, nameComp] : view.each()) {
-			if (static_cast<uint64_t>(uuidComp.Id) == uuid) {
-				s_StringReturnBuffer = nameComp.Name;
-				return s_StringReturnBuffer.c_str();
-			}
-		}
-		s_StringReturnBuffer.clear();
+		const EntityHandle entity = scene->FindEntityByUUID(uuid);
+		const NameComponent* nameComp = entity != entt::null ? scene->GetRegistry().try_get<NameComponent>(entity) : nullptr;
+		if (nameComp) s_StringReturnBuffer = nameComp->Name;
+		else s_StringReturnBuffer.clear();
 		return s_StringReturnBuffer.c_str();
 	}
 
@@ -362,6 +358,7 @@ namespace Bolt {
 		return s_StringReturnBuffer.c_str();
 	}
 
+	// Info: Scripts check the result, so this waits for a pending async load (e.g. from the scene loader) and retries a failed one
 	static int Bolt_Texture_LoadAsset(uint64_t assetId)
 	{
 		return TextureManager::LoadTextureByUUID(assetId).IsValid() ? 1 : 0;
@@ -503,6 +500,7 @@ namespace Bolt {
 	{
 		GET_COMPONENT(Transform2DComponent, entityID, );
 		comp.Position = { x, y };
+		scene->NotifyTransformChanged(handle);
 	}
 
 	static float Bolt_Transform2D_GetRotation(uint64_t entityID)
@@ -515,6 +513,7 @@ namespace Bolt {
 	{
 		GET_COMPONENT(Transform2DComponent, entityID, );
 		comp.Rotation = rotation;
+		scene->NotifyTransformChanged(handle);
 	}
 
 	static void Bolt_Transform2D_GetScale(uint64_t entityID, float* outX, float* outY)
@@ -527,6 +526,7 @@ namespace Bolt {
 	{
 		GET_COMPONENT(Transform2DComponent, entityID, );
 		comp.Scale = { x, y };
+		scene->NotifyTransformChanged(handle);
 	}
 
 	// ── SpriteRenderer ──────────────────────────────────────────────────
@@ -569,7 +569,7 @@ namespace Bolt {
 		}
 
 		comp.TextureAssetId = UUID(assetId);
-		comp.TextureHandle = TextureManager::LoadTextureByUUID(assetId);
+		comp.TextureHandle = TextureManager::LoadTextureByUUIDAsync(assetId);
 	}
 
 	static int Bolt_SpriteRenderer_GetSortingOrder(uint64_t entityID)
@@ -867,25 +867,31 @@ namespace Bolt {
 
 	// ── Physics2D ───────────────────────────────────────────────────────
 
+	static uint64_t ResolveHitEntityId(EntityHandle entity)
+	{
+		Scene* scene = GetScene();
+		if (scene && scene->IsValid(entity)) {
+			return GetEntityScriptId(*scene, entity);
+		}
+
+		uint64_t entityId = 0;
+		SceneManager::Get().ForeachLoadedScene([&](const Scene& loadedScene) {
+			if (entityId == 0 && loadedScene.IsValid(entity)) {
+				entityId = GetEntityScriptId(loadedScene, entity);
+			}
+		});
+		return entityId;
+	}
+
 	static int Bolt_Physics2D_Raycast(
-		float originX, float originY, float dirX, float dirY, float distance,
+		float originX, float originY, float dirX, float dirY, float distance, uint64_t layerMask,
 		uint64_t* hitEntityID, float* hitX, float* hitY, float* hitNormalX, float* hitNormalY)
 	{
 		*hitEntityID = 0; *hitX = 0; *hitY = 0; *hitNormalX = 0; *hitNormalY = 0;
 
-		auto result = Physics2D::Raycast({ originX, originY }, { dirX, dirY }, distance);
+		auto result = Physics2D::Raycast({ originX, originY }, { dirX, dirY }, distance, layerMask);
 		if (result.has_value()) {
-			Scene* scene = GetScene();
-			if (scene && scene->IsValid(result->entity)) {
-				*hitEntityID = GetEntityScriptId(*scene, result->entity);
-			}
-			else {
-				SceneManager::Get().ForeachLoadedScene([&](const Scene& loadedScene) {
-					if (*hitEntityID == 0 && loadedScene.IsValid(result->entity)) {
-						*hitEntityID = GetEntityScriptId(loadedScene, result->entity);
-					}
-				});
-			}
+			*hitEntityID = ResolveHitEntityId(result->entity);
 			*hitX = result->point.x; *hitY = result->point.y;
 			*hitNormalX = result->normal.x; *hitNormalY = result->normal.y;
 			return 1;
@@ -893,6 +899,140 @@ namespace Bolt {
 		return 0;
 	}
 
+	static int Bolt_Physics2D_RaycastBatch(const float* commands, int count, uint64_t layerMask, uint64_t* hitEntityIDs, float* hitData)
+	{
+		static_assert(sizeof(RaycastCommand2D) == 5 * sizeof(float), "RaycastCommand2D must match the managed 5 float layout");
+		if (!commands || count <= 0) return 0;
+
+		// Info: Reused across calls, scripts run on the main thread only
+		static std::vector<RaycastHit2D> s_Hits;
+		s_Hits.resize(static_cast<size_t>(count));
+
+		const auto* raycastCommands = reinterpret_cast<const RaycastCommand2D*>(commands);
+		const size_t hitCount = Physics2D::RaycastBatch({ raycastCommands, static_cast<size_t>(count) }, s_Hits, layerMask);
+
+		for (int i = 0; i < count; i++) {
+			const RaycastHit2D& hit = s_Hits[i];
+			float* data = hitData + static_cast<size_t>(i) * 5;
+			if (hit.entity == entt::null) {
+				hitEntityIDs[i] = 0;
+				data[0] = data[1] = data[2] = data[3] = data[4] = 0.0f;
+				continue;
+			}
+
+			hitEntityIDs[i] = ResolveHitEntityId(hit.entity);
+			data[0] = hit.point.x; data[1] = hit.point.y;
+			data[2] = hit.normal.x; data[3] = hit.normal.y;
+			data[4] = hit.distance;
+		}
+		return static_cast<int>(hitCount);
+	}
+
+	// ── Component Batches ───────────────────────────────────────────────
+
+	template<typename TComponent>
+	static TComponent* ResolveBatchComponent(uint64_t entityID)
+	{
+		Scene* scene = nullptr;
+		EntityHandle handle = entt::null;
+		if (!ResolveEntityReference(entityID, scene, handle) || !scene->HasComponent<TComponent>(handle)) return nullptr;
+		return &scene->GetComponent<TComponent>(handle);
+	}
+
+	template<typename TComponent, size_t Stride, typename TRead>
+	static int ReadComponentColumn(const uint64_t* entityIDs, int count, float* outValues, const std::array<float, Stride>& defaults, TRead&& read)
+	{
+		int found = 0;
+		for (int i = 0; i < count; i++) {
+			float* values = outValues + static_cast<size_t>(i) * Stride;
+			if (TComponent* comp = ResolveBatchComponent<TComponent>(entityIDs[i])) {
+				read(*comp, values);
+				found++;
+			}
+			else {
+				std::copy(defaults.begin(), defaults.end(), values);
+			}
+		}
+		return found;
+	}
+
+	template<typename TComponent, size_t Stride, typename TWrite>
+	static int WriteComponentColumn(const uint64_t* entityIDs, int count, const float* values, TWrite&& write)
+	{
+		int found = 0;
+		for (int i = 0; i < count; i++) {
+			Scene* scene = nullptr;
+			EntityHandle handle = entt::null;
+			if (!ResolveEntityReference(entityIDs[i], scene, handle) || !scene->HasComponent<TComponent>(handle)) continue;
+
+			write(scene->GetComponent<TComponent>(handle), values + static_cast<size_t>(i) * Stride);
+			if constexpr (std::is_same_v<TComponent, Transform2DComponent>) {
+				scene->NotifyTransformChanged(handle);
+			}
+			found++;
+		}
+		return found;
+	}
+
+	static int Bolt_Component_GetFieldBatch(int field, const uint64_t* entityIDs, int count, float* outValues)
+	{
+		if (!entityIDs || !outValues || count <= 0) return 0;
+
+		switch (static_cast<ScriptComponentField>(field)) {
+		case ScriptComponentField::Transform2DPosition:
+			return ReadComponentColumn<Transform2DComponent, 2>(entityIDs, count, outValues, { 0.0f, 0.0f },
+				[](const Transform2DComponent& c, float* v) { v[0] = c.Position.x; v[1] = c.Position.y; });
+		case ScriptComponentField::Transform2DRotation:
+			return ReadComponentColumn<Transform2DComponent, 1>(entityIDs, count, outValues, { 0.0f },
+				[](const Transform2DComponent& c, float* v) { v[0] = c.Rotation; });
+		case ScriptComponentField::Transform2DScale:
+			return ReadComponentColumn<Transform2DComponent, 2>(entityIDs, count, outValues, { 1.0f, 1.0f },
+				[](const Transform2DComponent& c, float* v) { v[0] = c.Scale.x; v[1] = c.Scale.y; });
+		case ScriptComponentField::SpriteRendererColor:
+			return ReadComponentColumn<SpriteRendererComponent, 4>(entityIDs, count, outValues, { 1.0f, 1.0f, 1.0f, 1.0f },
+				[](const SpriteRendererComponent& c, float* v) { v[0] = c.Color.r; v[1] = c.Color.g; v[2] = c.Color.b; v[3] = c.Color.a; });
+		case ScriptComponentField::Rigidbody2DLinearVelocity:
+			return ReadComponentColumn<Rigidbody2DComponent, 2>(entityIDs, count, outValues, { 0.0f, 0.0f },
+				[](Rigidbody2DComponent& c, float* v) { const Vec2 vel = c.GetVelocity(); v[0] = vel.x; v[1] = vel.y; });
+		case ScriptComponentField::Rigidbody2DAngularVelocity:
+			return ReadComponentColumn<Rigidbody2DComponent, 1>(entityIDs, count, outValues, { 0.0f },
+				[](Rigidbody2DComponent& c, float* v) { v[0] = c.GetAngularVelocity(); });
+		}
+
+		BT_CORE_ERROR_TAG("ScriptBindings", "Unknown component field {} in batch read", field);
+		return 0;
+	}
+
+	static int Bolt_Component_SetFieldBatch(int field, const uint64_t* entityIDs, int count, const float* values)
+	{
+		if (!entityIDs || !values || count <= 0) return 0;
+
+		// Info: Writes go through the same setters as the single entity bindings, so physics bodies stay in sync
+		switch (static_cast<ScriptComponentField>(field)) {
+		case ScriptComponentField::Transform2DPosition:
+			return WriteComponentColumn<Transform2DComponent, 2>(entityIDs, count, values,
+				[](Transform2DComponent& c, const float* v) { c.Position = { v[0], v[1] }; });
+		case ScriptComponentField::Transform2DRotation:
+			return WriteComponentColumn<Transform2DComponent, 1>(entityIDs, count, values,
+				[](Transform2DComponent& c, const float* v) { c.Rotation = v[0]; });
+		case ScriptComponentField::Transform2DScale:
+			return WriteComponentColumn<Transform2DComponent, 2>(entityIDs, count, values,
+				[](Transform2DComponent& c, const float* v) { c.Scale = { v[0], v[1] }; });
+		case ScriptComponentField::SpriteRendererColor:
+			return WriteComponentColumn<SpriteRendererComponent, 4>(entityIDs, count, values,
+				[](SpriteRendererComponent& c, const float* v) { c.Color = { v[0], v[1], v[2], v[3] }; });
+		case ScriptComponentField::Rigidbody2DLinearVelocity:
+			return WriteComponentColumn<Rigidbody2DComponent, 2>(entityIDs, count, values,
+				[](Rigidbody2DComponent& c, const float* v) { c.SetVelocity({ v[0], v[1] }); });
+		case ScriptComponentField::Rigidbody2DAngularVelocity:
+			return WriteComponentColumn<Rigidbody2DComponent, 1>(entityIDs, count, values,
+				[](Rigidbody2DComponent& c, const float* v) { c.SetAngularVelocity(v[0]); });
+		}
+
+		BT_CORE_ERROR_TAG("ScriptBindings", "Unknown component field {} in batch write", field);
+		return 0;
+	}
+
 	#undef GET_COMPONENT
 
 	// ── Registration ────────────────────────────────────────────────────
@@ -1028,6 +1168,10 @@ namespace Bolt {
 		b.Gizmo_SetLineWidth = &Bolt_Gizmo_SetLineWidth;
 
 		b.Physics2D_Raycast = &Bolt_Physics2D_Raycast;
+		b.Physics2D_RaycastBatch = &Bolt_Physics2D_RaycastBatch;
+
+		b.Component_GetFieldBatch = &Bolt_Component_GetFieldBatch;
+		b.Component_SetFieldBatch = &Bolt_Component_SetFieldBatch;
 	}
 
 } // namespace Bolt
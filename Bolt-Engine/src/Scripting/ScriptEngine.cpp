@@ -205,6 +205,14 @@ namespace Bolt {
 		s_Callbacks.InvokeUpdate(static_cast<int32_t>(handle));
 	}
 
+	void ScriptEngine::InvokeUpdateBatch(std::span<const uint32_t> startHandles, std::span<const uint32_t> updateHandles)
+	{
+		if ((startHandles.empty() && updateHandles.empty()) || !s_Callbacks.InvokeUpdateBatch) return;
+		s_Callbacks.InvokeUpdateBatch(
+			reinterpret_cast<const int32_t*>(startHandles.data()), static_cast<int32_t>(startHandles.size()),
+			reinterpret_cast<const int32_t*>(updateHandles.data()), static_cast<int32_t>(updateHandles.size()));
+	}
+
 	void ScriptEngine::InvokeOnDestroy(uint32_t handle)
 	{
 		if (handle == 0 || !s_Callbacks.InvokeOnDestroy) return;
@@ -217,4 +225,10 @@ namespace Bolt {
 		return s_Callbacks.ClassExists(className.c_str()) != 0;
 	}
 
+	void ScriptEngine::DispatchContactEvents(std::span<const ScriptContactEvent> events)
+	{
+		if (events.empty() || !s_Callbacks.DispatchContactEvents) return;
+		s_Callbacks.DispatchContactEvents(events.data(), static_cast<int32_t>(events.size()));
+	}
+
 } // namespace Bolt
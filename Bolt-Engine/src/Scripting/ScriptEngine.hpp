@@ -5,6 +5,7 @@
 #include "Scripting/ScriptGlue.hpp"
 #include <string>
 #include <cstdint>
+#include <span>
 
 namespace Bolt {
 
@@ -40,8 +41,12 @@ namespace Bolt {
 		static void DestroyScriptInstance(uint32_t handle);
 		static void InvokeStart(uint32_t handle);
 		static void InvokeUpdate(uint32_t handle);
+		// Info: Runs Start for startHandles, then Update for updateHandles, in a single managed transition
+		static void InvokeUpdateBatch(std::span<const uint32_t> startHandles, std::span<const uint32_t> updateHandles);
 		static void InvokeOnDestroy(uint32_t handle);
 		static bool ClassExists(const std::string& className);
+		// Info: Delivers a whole frame of contacts in one managed transition
+		static void DispatchContactEvents(std::span<const ScriptContactEvent> events);
 
 		static const ManagedCallbacks& GetCallbacks() { return s_Callbacks; }
 
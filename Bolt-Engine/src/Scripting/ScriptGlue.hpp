@@ -3,6 +3,18 @@
 
 namespace Bolt {
 
+	/// Component columns readable/writable in one Component_*FieldBatch call, must match C# ComponentField.
+	/// Values are packed floats per entity: positions, scales and velocities take 2, colors 4, the rest 1.
+	enum class ScriptComponentField : int32_t
+	{
+		Transform2DPosition = 0,
+		Transform2DRotation,
+		Transform2DScale,
+		SpriteRendererColor,
+		Rigidbody2DLinearVelocity,
+		Rigidbody2DAngularVelocity,
+	};
+
 	/// Layout must match C# NativeBindingsStruct exactly (Sequential, blittable).
 	struct NativeBindings
 	{
@@ -177,8 +189,28 @@ namespace Bolt {
 		void (*Gizmo_SetLineWidth)(float width);
 
 		// ── Physics2D ────────────────────────────────────────────────
-		int (*Physics2D_Raycast)(float originX, float originY, float dirX, float dirY, float distance,
+		int (*Physics2D_Raycast)(float originX, float originY, float dirX, float dirY, float distance, uint64_t layerMask,
 		                         uint64_t* hitEntityID, float* hitX, float* hitY, float* hitNormalX, float* hitNormalY);
+		// Info: 5 floats per command (originX, originY, dirX, dirY, distance) and per hit (x, y, normalX, normalY, distance)
+		int (*Physics2D_RaycastBatch)(const float* commands, int count, uint64_t layerMask, uint64_t* hitEntityIDs, float* hitData);
+
+		// ── Component Batches ────────────────────────────────────────
+		// Info: One call per column, values[i * stride] belongs to entityIDs[i]. Returns how many entities had the component,
+		// missing ones read the single getter defaults and are skipped on write
+		int (*Component_GetFieldBatch)(int field, const uint64_t* entityIDs, int count, float* outValues);
+		int (*Component_SetFieldBatch)(int field, const uint64_t* entityIDs, int count, const float* values);
+	};
+
+	/// One buffered contact for managed delivery, layout must match C# ContactEventNative.
+	/// Type: 0 = begin, 1 = end, 2 = hit. Entity IDs are 0 when the entity no longer exists.
+	struct ScriptContactEvent
+	{
+		uint64_t EntityA;
+		uint64_t EntityB;
+		float PointX, PointY;
+		float NormalX, NormalY;
+		float ApproachSpeed;
+		int32_t Type;
 	};
 
 	/// Layout must match C# ManagedCallbacksStruct exactly.
@@ -195,6 +227,8 @@ namespace Bolt {
 		const char* (*GetScriptFields)(int32_t handle);
 		void    (*SetScriptField)(int32_t handle, const char* fieldName, const char* value);
 		const char* (*GetClassFieldDefs)(const char* className);
+		void    (*DispatchContactEvents)(const ScriptContactEvent* events, int32_t count);
+		void    (*InvokeUpdateBatch)(const int32_t* startHandles, int32_t startCount, const int32_t* updateHandles, int32_t updateCount);
 	};
 
 } // namespace Bolt
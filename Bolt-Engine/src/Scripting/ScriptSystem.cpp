@@ -9,6 +9,8 @@
 #include "Core/Application.hpp"
 #include "Serialization/Path.hpp"
 #include "Project/ProjectManager.hpp"
+#include "Physics/PhysicsSystem2D.hpp"
+#include "Components/General/UUIDComponent.hpp"
 
 #include <imgui.h>
 #include <filesystem>
@@ -55,6 +57,37 @@ namespace Bolt {
 			return BT_BUILD_CONFIG_NAME;
 		}
 
+		uint64_t GetContactEntityId(const Scene& scene, EntityHandle entity)
+		{
+			if (entity == entt::null || !scene.IsValid(entity)) return 0;
+			if (const auto* uuid = scene.GetRegistry().try_get<UUIDComponent>(entity)) {
+				return static_cast<uint64_t>(uuid->Id);
+			}
+			return static_cast<uint64_t>(static_cast<uint32_t>(entity));
+		}
+
+		// Info: Contacts of every fixed step since the last frame, converted for the scene's scripts in one batch
+		void DispatchFrameContacts(const Scene& scene, std::vector<ScriptContactEvent>& buffer)
+		{
+			if (!PhysicsSystem2D::HasMainPhysicsWorld()) return;
+
+			buffer.clear();
+			for (const ContactEvent2D& event : PhysicsSystem2D::GetMainPhysicsWorld().GetDispatcher().GetFrameEvents()) {
+				const uint64_t entityA = GetContactEntityId(scene, event.EntityA);
+				const uint64_t entityB = GetContactEntityId(scene, event.EntityB);
+				if (entityA == 0 && entityB == 0) continue;
+
+				buffer.push_back({
+					entityA, entityB,
+					event.Point.x, event.Point.y,
+					event.Normal.x, event.Normal.y,
+					event.ApproachSpeed,
+					static_cast<int32_t>(event.Type)
+				});
+			}
+			ScriptEngine::DispatchContactEvents(buffer);
+		}
+
 		template <typename TFunc>
 		void ForEachLoadedScene(TFunc&& func)
 		{
@@ -135,7 +168,7 @@ namespace Bolt {
 				m_SandboxProjectPath = std::filesystem::canonical(csproj).string();
 				m_ScriptWatcher.Watch(
 					std::filesystem::canonical(scriptsDir).string(), ".cs",
-					[this]() { RebuildAndReloadScripts(); });
+					[this](const std::vector<FileChangeEvent>&) { RebuildAndReloadScripts(); });
 			}
 		}
 		else
@@ -147,7 +180,7 @@ namespace Bolt {
 				m_SandboxProjectPath = std::filesystem::canonical(sandboxCsproj).string();
 				m_ScriptWatcher.Watch(
 					std::filesystem::canonical(sandboxSourceDir).string(), ".cs",
-					[this]() { RebuildAndReloadScripts(); });
+					[this](const std::vector<FileChangeEvent>&) { RebuildAndReloadScripts(); });
 			}
 		}
 
@@ -168,7 +201,7 @@ namespace Bolt {
 			{
 				m_NativeWatcher.Watch(
 					std::filesystem::canonical(nativeSourceDir).string(), ".cpp",
-					[this]() { RebuildAndReloadNativeScripts(); });
+					[this](const std::vector<FileChangeEvent>&) { RebuildAndReloadNativeScripts(); });
 			}
 		}
 		else
@@ -188,7 +221,7 @@ namespace Bolt {
 			{
 				m_NativeWatcher.Watch(
 					std::filesystem::canonical(nativeSourceDir).string(), ".cpp",
-					[this]() { RebuildAndReloadNativeScripts(); });
+					[this](const std::vector<FileChangeEvent>&) { RebuildAndReloadNativeScripts(); });
 			}
 		}
 
@@ -426,6 +459,13 @@ namespace Bolt {
 
 		float dt = Application::GetInstance() ? Application::GetInstance()->GetTime().GetDeltaTime() : 0.0f;
 
+		// Info: Collision callbacks run before Update, like the fixed steps that produced them
+		DispatchFrameContacts(scene, m_ContactEventBuffer);
+
+		// Info: Managed scripts are only collected here and run in one transition after the loop
+		m_ManagedStartHandles.clear();
+		m_ManagedUpdateHandles.clear();
+
 		auto view = scene.GetRegistry().view<ScriptComponent>(entt::exclude<DisabledTag>);
 
 		for (auto [entity, scriptComp] : view.each())
@@ -485,9 +525,9 @@ namespace Bolt {
 					if (!instance.HasStarted())
 					{
 						instance.MarkStarted();
-						ScriptEngine::InvokeStart(instance.GetGCHandle());
+						m_ManagedStartHandles.push_back(instance.GetGCHandle());
 					}
-					ScriptEngine::InvokeUpdate(instance.GetGCHandle());
+					m_ManagedUpdateHandles.push_back(instance.GetGCHandle());
 				}
 				else if (instance.GetType() == ScriptType::Native)
 				{
@@ -510,6 +550,8 @@ namespace Bolt {
 				}
 			}
 		}
+
+		ScriptEngine::InvokeUpdateBatch(m_ManagedStartHandles, m_ManagedUpdateHandles);
 	}
 
 	void ScriptSystem::OnDestroy(Scene& scene)
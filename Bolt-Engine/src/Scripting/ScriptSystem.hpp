@@ -1,6 +1,7 @@
 #pragma once
 #include "Scene/ISystem.hpp"
 #include "Scripting/NativeScriptHost.hpp"
+#include "Scripting/ScriptGlue.hpp"
 #include "Serialization/FileWatcher.hpp"
 #include "Core/Export.hpp"
 #include "Utils/Process.hpp"
@@ -8,6 +9,7 @@
 #include <future>
 #include <cstddef>
 #include <chrono>
+#include <vector>
 
 namespace Bolt {
 
@@ -40,6 +42,9 @@ namespace Bolt {
 		static inline Scene* m_LastScene = nullptr;
 		static inline ScriptSystem* m_PollingOwner = nullptr;
 		static inline std::size_t m_ActiveSystemCount = 0;
+		static inline std::vector<ScriptContactEvent> m_ContactEventBuffer;
+		static inline std::vector<uint32_t> m_ManagedStartHandles;
+		static inline std::vector<uint32_t> m_ManagedUpdateHandles;
 
 		// C# hot-reload
 		static inline FileWatcher m_ScriptWatcher;
@@ -0,0 +1,200 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+// Info: On-disk layout of .bscene files. Little endian, every section and record array starts 8 byte aligned.
+//
+//   Header
+//   String table   uint32 offsets[StringCount + 1], then the NUL terminated characters
+//   Entity table   EntityRecord[EntityCount]
+//   Block table    BlockEntry[BlockCount]
+//   Blocks         per component: uint32 entity indices[Count], then Count records of that component
+//
+// Blocks are stored in the order the JSON deserializer applies components, restoring them in file order
+// gives the same result. Bump k_Version whenever a record layout changes.
+namespace Bolt::BinaryScene {
+	inline constexpr char k_Magic[4] = { 'B', 'S', 'C', 'N' };
+	inline constexpr uint32_t k_Version = 1;
+	inline constexpr uint32_t k_NoString = UINT32_MAX;
+	inline constexpr uint32_t k_Alignment = 8;
+	inline constexpr const char* k_FileExtension = ".bscene";
+
+	enum class ComponentId : uint32_t {
+		Transform2D = 1,
+		SpriteRenderer,
+		Rigidbody2D,
+		BoxCollider2D,
+		AudioSource,
+		Camera2D,
+		BoltBody2D,
+		BoltBoxCollider2D,
+		BoltCircleCollider2D,
+		ParticleSystem2D,
+		RectTransform,
+		Image,
+		Scripts,
+	};
+
+	enum EntityFlags : uint32_t {
+		EntityFlag_Static = 1 << 0,
+		EntityFlag_Disabled = 1 << 1,
+		EntityFlag_Deadly = 1 << 2,
+	};
+
+	struct Header {
+		char Magic[4];
+		uint32_t Version;
+		uint64_t SceneId;
+		uint32_t Name;
+		uint32_t EntityCount;
+		uint32_t BlockCount;
+		uint32_t StringCount;
+		uint64_t StringTableOffset;
+		uint64_t EntityTableOffset;
+		uint64_t BlockTableOffset;
+		uint64_t FileSize;
+	};
+
+	struct EntityRecord {
+		uint64_t UUID;
+		uint32_t Name;
+		uint32_t Flags;
+	};
+
+	struct BlockEntry {
+		ComponentId Component;
+		uint32_t Count;
+		uint32_t RecordSize;
+		uint32_t Reserved;
+		uint64_t EntitiesOffset;
+		uint64_t RecordsOffset;
+	};
+
+	// ── Component records ───────────────────────────────────────────
+	// String fields index the string table, asset fields are raw asset UUIDs (0 = none)
+
+	struct Transform2DRecord {
+		float PosX, PosY;
+		float Rotation;
+		float ScaleX, ScaleY;
+	};
+
+	struct SpriteRendererRecord {
+		uint64_t TextureAsset;
+		float R, G, B, A;
+		uint32_t Texture;
+		// Info: -1 = not stored, the loader keeps its defaults
+		int32_t Filter, WrapU, WrapV;
+		int16_t SortOrder;
+		uint8_t SortLayer;
+		uint8_t Padding[5];
+	};
+
+	struct Rigidbody2DRecord {
+		int32_t BodyType;
+		float GravityScale;
+		float Mass;
+		int32_t Interpolation;
+	};
+
+	struct BoxCollider2DRecord {
+		// Info: World space size like the JSON scaleX/scaleY, the loader divides by the transform scale
+		float ScaleX, ScaleY;
+		float CenterX, CenterY;
+		float Friction;
+		float Bounciness;
+		int32_t CollisionLayer;
+		uint8_t RegisterContacts;
+		uint8_t Sensor;
+		uint8_t Padding[2];
+	};
+
+	struct AudioSourceRecord {
+		uint64_t ClipAsset;
+		float Volume;
+		float Pitch;
+		uint32_t Clip;
+		uint8_t Loop;
+		uint8_t PlayOnAwake;
+		uint8_t Padding[2];
+	};
+
+	struct Camera2DRecord {
+		float OrthoSize;
+		float Zoom;
+		float ClearR, ClearG, ClearB, ClearA;
+	};
+
+	struct BoltBody2DRecord {
+		int32_t Type;
+		float Mass;
+		uint8_t UseGravity;
+		uint8_t BoundaryCheck;
+		uint8_t Padding[2];
+	};
+
+	struct BoltBoxCollider2DRecord {
+		float HalfX, HalfY;
+	};
+
+	struct BoltCircleCollider2DRecord {
+		float Radius;
+	};
+
+	struct ParticleSystem2DRecord {
+		uint64_t TextureAsset;
+		uint32_t Texture;
+		float LifeTime;
+		float Speed;
+		float Scale;
+		float GravityX, GravityY;
+		float MoveDirectionX, MoveDirectionY;
+		int32_t Simulation;
+		uint32_t MaxParticles;
+		float ColorR, ColorG, ColorB, ColorA;
+		// Info: Radius and unused for circles, half extents for squares
+		float ShapeX, ShapeY;
+		uint16_t EmitOverTime;
+		uint16_t RateOverDistance;
+		int16_t SortOrder;
+		uint8_t SortLayer;
+		uint8_t EmissionSpace;
+		uint8_t ShapeType;
+		uint8_t PlayOnAwake;
+		uint8_t UseGravity;
+		uint8_t UseRandomColors;
+		uint8_t IsOnCircle;
+		uint8_t Padding[3];
+	};
+
+	struct RectTransformRecord {
+		float PosX, PosY;
+		float PivotX, PivotY;
+		float Width, Height;
+		float Rotation;
+		float ScaleX, ScaleY;
+	};
+
+	struct ImageRecord {
+		uint64_t TextureAsset;
+		float R, G, B, A;
+		uint32_t Texture;
+		uint32_t Padding;
+	};
+
+	struct ScriptsRecord {
+		// Info: Class names joined with ';', fields are the compact JSON of the scene file's ScriptFields object
+		uint32_t ClassNames;
+		uint32_t FieldsJson;
+	};
+
+	static_assert(sizeof(Header) == 64);
+	static_assert(sizeof(EntityRecord) == 16);
+	static_assert(sizeof(BlockEntry) == 32);
+	static_assert(sizeof(SpriteRendererRecord) == 48);
+	static_assert(sizeof(BoxCollider2DRecord) == 32);
+	static_assert(sizeof(AudioSourceRecord) == 24);
+	static_assert(sizeof(ParticleSystem2DRecord) == 88);
+	static_assert(sizeof(ImageRecord) == 32);
+	static_assert(std::is_trivially_copyable_v<ParticleSystem2DRecord> && std::is_trivially_copyable_v<SpriteRendererRecord>);
+}
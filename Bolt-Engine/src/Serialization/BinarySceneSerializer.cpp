@@ -0,0 +1,1286 @@
+#include "pch.hpp"
+#include "Serialization/BinarySceneSerializer.hpp"
+#include "Serialization/BinarySceneFormat.hpp"
+#include "Serialization/MappedFile.hpp"
+#include "Serialization/SceneSerializer.hpp"
+#include "Serialization/SceneSerializerShared.hpp"
+#include "Serialization/File.hpp"
+#include "Serialization/Json.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/EntityHelper.hpp"
+#include "Components/General/Transform2DComponent.hpp"
+#include "Components/Graphics/SpriteRendererComponent.hpp"
+#include "Components/Graphics/Camera2DComponent.hpp"
+#include "Components/Physics/Rigidbody2DComponent.hpp"
+#include "Components/Physics/BoxCollider2DComponent.hpp"
+#include "Components/Audio/AudioSourceComponent.hpp"
+#include "Components/General/RectTransformComponent.hpp"
+#include "Components/Graphics/ImageComponent.hpp"
+#include "Components/Graphics/ParticleSystem2DComponent.hpp"
+#include "Components/General/UUIDComponent.hpp"
+#include "Components/Tags.hpp"
+#include "Scripting/ScriptComponent.hpp"
+#include "Components/Physics/BoltBody2DComponent.hpp"
+#include "Components/Physics/BoltBoxCollider2DComponent.hpp"
+#include "Components/Physics/BoltCircleCollider2DComponent.hpp"
+#include "Graphics/TextureManager.hpp"
+#include "Physics/PhysicsTypes.hpp"
+#include "Core/Log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+namespace Bolt {
+
+	using Json::Value;
+	using namespace SceneSerializerShared;
+	using BinaryScene::ComponentId;
+
+	namespace {
+		// Info: Matches SCENE_FORMAT_VERSION of the JSON serializer, written by ReadToJson
+		static constexpr int k_JsonSceneFormatVersion = 1;
+		static constexpr float k_MinScaleAxis = 0.0001f;
+		// Info: Box2D shape defaults, the JSON loader keeps them when a collider has no friction/bounciness keys
+		static constexpr float k_DefaultFriction = 0.6f;
+		static constexpr float k_DefaultBounciness = 0.0f;
+		static constexpr char k_ScriptNameSeparator = ';';
+
+		uint64_t AlignUp(uint64_t value) {
+			return (value + BinaryScene::k_Alignment - 1) & ~static_cast<uint64_t>(BinaryScene::k_Alignment - 1);
+		}
+
+		// Info: Records are copied out instead of cast in place, so unaligned fallback buffers stay well defined
+		template<typename T>
+		T ReadAt(const std::byte* data, uint64_t offset) {
+			T value;
+			std::memcpy(&value, data + offset, sizeof(T));
+			return value;
+		}
+
+		// ── Writing ─────────────────────────────────────────────────────
+
+		class SceneWriter {
+		public:
+			uint32_t AddString(const std::string& value) {
+				const auto [it, inserted] = m_StringLookup.try_emplace(value, static_cast<uint32_t>(m_Strings.size()));
+				if (inserted) {
+					m_Strings.push_back(value);
+				}
+				return it->second;
+			}
+
+			uint32_t AddOptionalString(const std::string& value) {
+				return value.empty() ? BinaryScene::k_NoString : AddString(value);
+			}
+
+			uint32_t AddEntity(const BinaryScene::EntityRecord& entity) {
+				m_Entities.push_back(entity);
+				return static_cast<uint32_t>(m_Entities.size() - 1);
+			}
+
+			template<typename TRecord>
+			void AddRecord(ComponentId component, uint32_t entityIndex, const TRecord& record) {
+				Block& block = GetBlock(component, sizeof(TRecord));
+				block.Entities.push_back(entityIndex);
+
+				const auto* bytes = reinterpret_cast<const std::byte*>(&record);
+				block.Records.insert(block.Records.end(), bytes, bytes + sizeof(TRecord));
+			}
+
+			std::vector<std::byte> Finish(uint64_t sceneId, uint32_t name);
+
+		private:
+			struct Block {
+				ComponentId Component;
+				uint32_t RecordSize;
+				std::vector<uint32_t> Entities;
+				std::vector<std::byte> Records;
+			};
+
+			Block& GetBlock(ComponentId component, uint32_t recordSize) {
+				for (Block& block : m_Blocks) {
+					if (block.Component == component) {
+						return block;
+					}
+				}
+				return m_Blocks.emplace_back(Block{ component, recordSize, {}, {} });
+			}
+
+			std::vector<std::string> m_Strings;
+			std::unordered_map<std::string, uint32_t> m_StringLookup;
+			std::vector<BinaryScene::EntityRecord> m_Entities;
+			std::vector<Block> m_Blocks;
+		};
+
+		std::vector<std::byte> SceneWriter::Finish(uint64_t sceneId, uint32_t name) {
+			// Component ids follow the JSON apply order, restoring blocks in id order keeps that order
+			std::sort(m_Blocks.begin(), m_Blocks.end(), [](const Block& a, const Block& b) {
+				return a.Component < b.Component;
+			});
+
+			std::vector<std::byte> out;
+			auto append = [&out](const void* data, size_t size) {
+				const auto* bytes = static_cast<const std::byte*>(data);
+				out.insert(out.end(), bytes, bytes + size);
+			};
+			auto align = [&out]() {
+				out.resize(AlignUp(out.size()));
+			};
+
+			BinaryScene::Header header{};
+			std::memcpy(header.Magic, BinaryScene::k_Magic, sizeof(header.Magic));
+			header.Version = BinaryScene::k_Version;
+			header.SceneId = sceneId;
+			header.Name = name;
+			header.EntityCount = static_cast<uint32_t>(m_Entities.size());
+			header.BlockCount = static_cast<uint32_t>(m_Blocks.size());
+			header.StringCount = static_cast<uint32_t>(m_Strings.size());
+			append(&header, sizeof(header));
+
+			align();
+			header.StringTableOffset = out.size();
+			std::vector<uint32_t> stringOffsets;
+			stringOffsets.reserve(m_Strings.size() + 1);
+			uint32_t charOffset = 0;
+			for (const std::string& value : m_Strings) {
+				stringOffsets.push_back(charOffset);
+				charOffset += static_cast<uint32_t>(value.size() + 1);
+			}
+			stringOffsets.push_back(charOffset);
+			append(stringOffsets.data(), stringOffsets.size() * sizeof(uint32_t));
+			for (const std::string& value : m_Strings) {
+				append(value.c_str(), value.size() + 1);
+			}
+
+			align();
+			header.EntityTableOffset = out.size();
+			append(m_Entities.data(), m_Entities.size() * sizeof(BinaryScene::EntityRecord));
+
+			align();
+			header.BlockTableOffset = out.size();
+			const size_t blockTable = out.size();
+			out.resize(out.size() + m_Blocks.size() * sizeof(BinaryScene::BlockEntry));
+
+			for (size_t i = 0; i < m_Blocks.size(); i++) {
+				const Block& block = m_Blocks[i];
+				BinaryScene::BlockEntry entry{};
+				entry.Component = block.Component;
+				entry.Count = static_cast<uint32_t>(block.Entities.size());
+				entry.RecordSize = block.RecordSize;
+
+				align();
+				entry.EntitiesOffset = out.size();
+				append(block.Entities.data(), block.Entities.size() * sizeof(uint32_t));
+
+				align();
+				entry.RecordsOffset = out.size();
+				append(block.Records.data(), block.Records.size());
+
+				std::memcpy(out.data() + blockTable + i * sizeof(entry), &entry, sizeof(entry));
+			}
+
+			header.FileSize = out.size();
+			std::memcpy(out.data(), &header, sizeof(header));
+			return out;
+		}
+
+		uint32_t JoinScriptNames(const Value& scriptsValue, SceneWriter& writer) {
+			std::string joined;
+			for (const Value& scriptNameValue : scriptsValue.GetArray()) {
+				if (!scriptNameValue.IsString()) {
+					continue;
+				}
+				if (!joined.empty()) {
+					joined += k_ScriptNameSeparator;
+				}
+				joined += scriptNameValue.AsStringOr();
+			}
+			return writer.AddString(joined);
+		}
+
+		// Info: Applies the same defaults as SceneSerializer::DeserializeEntity, so both load paths agree
+		void EncodeEntity(const Value& entityValue, SceneWriter& writer) {
+			uint32_t flags = 0;
+			if (GetBoolMember(entityValue, "static", false)) flags |= BinaryScene::EntityFlag_Static;
+			if (GetBoolMember(entityValue, "disabled", false)) flags |= BinaryScene::EntityFlag_Disabled;
+			if (GetBoolMember(entityValue, "deadly", false)) flags |= BinaryScene::EntityFlag_Deadly;
+
+			const uint32_t index = writer.AddEntity({
+				GetUInt64Member(entityValue, "uuid", 0),
+				writer.AddString(GetStringMember(entityValue, "name", "Entity")),
+				flags });
+
+			float transformScaleX = 1.0f;
+			float transformScaleY = 1.0f;
+			if (const Value* transformValue = GetObjectMember(entityValue, "Transform2D")) {
+				BinaryScene::Transform2DRecord record{};
+				record.PosX = GetFloatMember(*transformValue, "posX", 0.0f);
+				record.PosY = GetFloatMember(*transformValue, "posY", 0.0f);
+				record.Rotation = GetFloatMember(*transformValue, "rotation", 0.0f);
+				record.ScaleX = GetFloatMember(*transformValue, "scaleX", 1.0f);
+				record.ScaleY = GetFloatMember(*transformValue, "scaleY", 1.0f);
+				transformScaleX = record.ScaleX;
+				transformScaleY = record.ScaleY;
+				writer.AddRecord(ComponentId::Transform2D, index, record);
+			}
+
+			if (const Value* spriteValue = GetObjectMember(entityValue, "SpriteRenderer")) {
+				BinaryScene::SpriteRendererRecord record{};
+				record.TextureAsset = GetUInt64Member(*spriteValue, "textureAsset", 0);
+				record.R = GetFloatMember(*spriteValue, "r", 1.0f);
+				record.G = GetFloatMember(*spriteValue, "g", 1.0f);
+				record.B = GetFloatMember(*spriteValue, "b", 1.0f);
+				record.A = GetFloatMember(*spriteValue, "a", 1.0f);
+				record.Texture = writer.AddOptionalString(GetStringMember(*spriteValue, "texture"));
+				record.Filter = GetIntMember(*spriteValue, "filter", -1);
+				record.WrapU = GetIntMember(*spriteValue, "wrapU", -1);
+				record.WrapV = GetIntMember(*spriteValue, "wrapV", -1);
+				record.SortOrder = static_cast<int16_t>(GetIntMember(*spriteValue, "sortOrder", 0));
+				record.SortLayer = static_cast<uint8_t>(GetIntMember(*spriteValue, "sortLayer", 0));
+				writer.AddRecord(ComponentId::SpriteRenderer, index, record);
+			}
+
+			if (const Value* rigidbodyValue = GetObjectMember(entityValue, "Rigidbody2D")) {
+				BinaryScene::Rigidbody2DRecord record{};
+				record.BodyType = GetIntMember(*rigidbodyValue, "bodyType", static_cast<int>(BodyType::Dynamic));
+				record.GravityScale = GetFloatMember(*rigidbodyValue, "gravityScale", 1.0f);
+				record.Mass = GetFloatMember(*rigidbodyValue, "mass", 1.0f);
+				record.Interpolation = GetIntMember(*rigidbodyValue, "interpolation", static_cast<int>(InterpolationMode::None));
+				writer.AddRecord(ComponentId::Rigidbody2D, index, record);
+			}
+
+			if (const Value* colliderValue = GetObjectMember(entityValue, "BoxCollider2D")) {
+				BinaryScene::BoxCollider2DRecord record{};
+				record.ScaleX = GetFloatMember(*colliderValue, "scaleX", transformScaleX);
+				record.ScaleY = GetFloatMember(*colliderValue, "scaleY", transformScaleY);
+				record.CenterX = GetFloatMember(*colliderValue, "centerX", 0.0f);
+				record.CenterY = GetFloatMember(*colliderValue, "centerY", 0.0f);
+				record.Friction = GetFloatMember(*colliderValue, "friction", k_DefaultFriction);
+				record.Bounciness = GetFloatMember(*colliderValue, "bounciness", k_DefaultBounciness);
+				record.CollisionLayer = GetCollisionLayerMember(*colliderValue);
+				record.RegisterContacts = GetBoolMember(*colliderValue, "registerContacts", true) ? 1 : 0;
+				record.Sensor = GetBoolMember(*colliderValue, "sensor", false) ? 1 : 0;
+				writer.AddRecord(ComponentId::BoxCollider2D, index, record);
+			}
+
+			if (const Value* audioValue = GetObjectMember(entityValue, "AudioSource")) {
+				BinaryScene::AudioSourceRecord record{};
+				record.ClipAsset = GetUInt64Member(*audioValue, "clipAsset", 0);
+				record.Volume = GetFloatMember(*audioValue, "volume", 1.0f);
+				record.Pitch = GetFloatMember(*audioValue, "pitch", 1.0f);
+				record.Clip = writer.AddOptionalString(GetStringMember(*audioValue, "clip"));
+				record.Loop = GetBoolMember(*audioValue, "loop", false) ? 1 : 0;
+				record.PlayOnAwake = GetBoolMember(*audioValue, "playOnAwake", false) ? 1 : 0;
+				writer.AddRecord(ComponentId::AudioSource, index, record);
+			}
+
+			if (const Value* cameraValue = GetObjectMember(entityValue, "Camera2D")) {
+				BinaryScene::Camera2DRecord record{};
+				record.OrthoSize = GetFloatMember(*cameraValue, "orthoSize", 5.0f);
+				record.Zoom = GetFloatMember(*cameraValue, "zoom", 1.0f);
+				record.ClearR = GetFloatMember(*cameraValue, "clearR", 0.1f);
+				record.ClearG = GetFloatMember(*cameraValue, "clearG", 0.1f);
+				record.ClearB = GetFloatMember(*cameraValue, "clearB", 0.1f);
+				record.ClearA = GetFloatMember(*cameraValue, "clearA", 1.0f);
+				writer.AddRecord(ComponentId::Camera2D, index, record);
+			}
+
+			if (const Value* bodyValue = GetObjectMember(entityValue, "BoltBody2D")) {
+				BinaryScene::BoltBody2DRecord record{};
+				record.Type = GetIntMember(*bodyValue, "type", 1);
+				record.Mass = GetFloatMember(*bodyValue, "mass", 1.0f);
+				record.UseGravity = GetBoolMember(*bodyValue, "useGravity", true) ? 1 : 0;
+				record.BoundaryCheck = GetBoolMember(*bodyValue, "boundaryCheck", false) ? 1 : 0;
+				writer.AddRecord(ComponentId::BoltBody2D, index, record);
+			}
+
+			if (const Value* colliderValue = GetObjectMember(entityValue, "BoltBoxCollider2D")) {
+				BinaryScene::BoltBoxCollider2DRecord record{};
+				record.HalfX = GetFloatMember(*colliderValue, "halfX", 0.5f);
+				record.HalfY = GetFloatMember(*colliderValue, "halfY", 0.5f);
+				writer.AddRecord(ComponentId::BoltBoxCollider2D, index, record);
+			}
+
+			if (const Value* colliderValue = GetObjectMember(entityValue, "BoltCircleCollider2D")) {
+				BinaryScene::BoltCircleCollider2DRecord record{};
+				record.Radius = GetFloatMember(*colliderValue, "radius", 0.5f);
+				writer.AddRecord(ComponentId::BoltCircleCollider2D, index, record);
+			}
+
+			if (const Value* particleValue = GetObjectMember(entityValue, "ParticleSystem2D")) {
+				BinaryScene::ParticleSystem2DRecord record{};
+				record.TextureAsset = GetUInt64Member(*particleValue, "textureAsset", 0);
+				record.Texture = writer.AddOptionalString(GetStringMember(*particleValue, "texture"));
+				record.LifeTime = GetFloatMember(*particleValue, "lifetime", 1.0f);
+				record.Speed = GetFloatMember(*particleValue, "speed", 5.0f);
+				record.Scale = GetFloatMember(*particleValue, "scale", 1.0f);
+				record.GravityX = GetFloatMember(*particleValue, "gravityX", 0.0f);
+				record.GravityY = GetFloatMember(*particleValue, "gravityY", 0.0f);
+				record.MoveDirectionX = GetFloatMember(*particleValue, "moveDirectionX", 0.0f);
+				record.MoveDirectionY = GetFloatMember(*particleValue, "moveDirectionY", 0.0f);
+				record.Simulation = GetIntMember(*particleValue, "simulation", static_cast<int>(ParticleSystem2DComponent::SimulationMode::CPU));
+				record.MaxParticles = static_cast<uint32_t>(GetUInt64Member(*particleValue, "maxParticles", 1000));
+				record.ColorR = GetFloatMember(*particleValue, "colorR", 1.0f);
+				record.ColorG = GetFloatMember(*particleValue, "colorG", 1.0f);
+				record.ColorB = GetFloatMember(*particleValue, "colorB", 1.0f);
+				record.ColorA = GetFloatMember(*particleValue, "colorA", 1.0f);
+				record.EmitOverTime = static_cast<uint16_t>(GetIntMember(*particleValue, "emitOverTime", 10));
+				record.RateOverDistance = static_cast<uint16_t>(GetIntMember(*particleValue, "rateOverDistance", 0));
+				record.SortOrder = static_cast<int16_t>(GetIntMember(*particleValue, "sortOrder", 0));
+				record.SortLayer = static_cast<uint8_t>(GetIntMember(*particleValue, "sortLayer", 0));
+				record.EmissionSpace = static_cast<uint8_t>(
+					GetIntMember(*particleValue, "emissionSpace", static_cast<int>(ParticleSystem2DComponent::Space::World)));
+				record.ShapeType = GetIntMember(*particleValue, "shapeType", 0) == 0 ? 0 : 1;
+				if (record.ShapeType == 0) {
+					record.ShapeX = GetFloatMember(*particleValue, "radius", 1.0f);
+					record.IsOnCircle = GetBoolMember(*particleValue, "isOnCircle", false) ? 1 : 0;
+				}
+				else {
+					record.ShapeX = GetFloatMember(*particleValue, "halfExtendsX", 1.0f);
+					record.ShapeY = GetFloatMember(*particleValue, "halfExtendsY", 1.0f);
+				}
+				record.PlayOnAwake = GetBoolMember(*particleValue, "playOnAwake", true) ? 1 : 0;
+				record.UseGravity = GetBoolMember(*particleValue, "useGravity", false) ? 1 : 0;
+				record.UseRandomColors = GetBoolMember(*particleValue, "useRandomColors", false) ? 1 : 0;
+				writer.AddRecord(ComponentId::ParticleSystem2D, index, record);
+			}
+
+			if (const Value* rectValue = GetObjectMember(entityValue, "RectTransform")) {
+				BinaryScene::RectTransformRecord record{};
+				record.PosX = GetFloatMember(*rectValue, "posX", 0.0f);
+				record.PosY = GetFloatMember(*rectValue, "posY", 0.0f);
+				record.PivotX = GetFloatMember(*rectValue, "pivotX", 0.0f);
+				record.PivotY = GetFloatMember(*rectValue, "pivotY", 0.0f);
+				record.Width = GetFloatMember(*rectValue, "width", 100.0f);
+				record.Height = GetFloatMember(*rectValue, "height", 100.0f);
+				record.Rotation = GetFloatMember(*rectValue, "rotation", 0.0f);
+				record.ScaleX = GetFloatMember(*rectValue, "scaleX", 1.0f);
+				record.ScaleY = GetFloatMember(*rectValue, "scaleY", 1.0f);
+				writer.AddRecord(ComponentId::RectTransform, index, record);
+			}
+
+			if (const Value* imageValue = GetObjectMember(entityValue, "Image")) {
+				BinaryScene::ImageRecord record{};
+				record.TextureAsset = GetUInt64Member(*imageValue, "textureAsset", 0);
+				record.R = GetFloatMember(*imageValue, "r", 1.0f);
+				record.G = GetFloatMember(*imageValue, "g", 1.0f);
+				record.B = GetFloatMember(*imageValue, "b", 1.0f);
+				record.A = GetFloatMember(*imageValue, "a", 1.0f);
+				record.Texture = writer.AddOptionalString(GetStringMember(*imageValue, "texture"));
+				writer.AddRecord(ComponentId::Image, index, record);
+			}
+
+			if (const Value* scriptsValue = GetArrayMember(entityValue, "Scripts")) {
+				BinaryScene::ScriptsRecord record{};
+				record.ClassNames = JoinScriptNames(*scriptsValue, writer);
+				record.FieldsJson = BinaryScene::k_NoString;
+				if (const Value* fieldsByClass = GetObjectMember(entityValue, "ScriptFields")) {
+					record.FieldsJson = writer.AddString(Json::Stringify(*fieldsByClass, false));
+				}
+				writer.AddRecord(ComponentId::Scripts, index, record);
+			}
+		}
+
+		std::vector<std::byte> EncodeScene(const Value& root) {
+			SceneWriter writer;
+			const uint32_t name = writer.AddOptionalString(GetStringMember(root, "name"));
+
+			if (const Value* entitiesValue = GetArrayMember(root, "entities")) {
+				for (const Value& entityValue : entitiesValue->GetArray()) {
+					if (entityValue.IsObject()) {
+						EncodeEntity(entityValue, writer);
+					}
+				}
+			}
+
+			return writer.Finish(GetUInt64Member(root, "sceneId", 0), name);
+		}
+
+		// ── Reading ─────────────────────────────────────────────────────
+
+		class SceneView {
+		public:
+			bool Open(const std::byte* data, size_t size, const std::string& source);
+
+			const BinaryScene::Header& GetHeader() const { return m_Header; }
+
+			BinaryScene::EntityRecord GetEntity(uint32_t index) const {
+				return ReadAt<BinaryScene::EntityRecord>(m_Data, m_Header.EntityTableOffset + index * sizeof(BinaryScene::EntityRecord));
+			}
+
+			BinaryScene::BlockEntry GetBlock(uint32_t index) const {
+				return ReadAt<BinaryScene::BlockEntry>(m_Data, m_Header.BlockTableOffset + index * sizeof(BinaryScene::BlockEntry));
+			}
+
+			std::string GetString(uint32_t index, const std::string& fallback = {}) const {
+				if (index >= m_Header.StringCount) {
+					return fallback;
+				}
+
+				const uint32_t begin = ReadAt<uint32_t>(m_Data, m_Header.StringTableOffset + index * sizeof(uint32_t));
+				const uint32_t end = ReadAt<uint32_t>(m_Data, m_Header.StringTableOffset + (index + 1) * sizeof(uint32_t));
+				return std::string(reinterpret_cast<const char*>(m_Data + m_Chars + begin), end - begin - 1);
+			}
+
+			// Info: Calls fn(entityIndex, record) for every record, blocks whose record size doesn't match are skipped
+			template<typename TRecord, typename TFn>
+			void ForEachRecord(const BinaryScene::BlockEntry& block, TFn&& fn) const {
+				if (block.RecordSize != sizeof(TRecord)) {
+					BT_CORE_WARN_TAG("BinarySceneSerializer", "Skipping component block {} with record size {} (expected {})",
+						static_cast<uint32_t>(block.Component), block.RecordSize, sizeof(TRecord));
+					return;
+				}
+
+				for (uint32_t i = 0; i < block.Count; i++) {
+					const uint32_t entityIndex = ReadAt<uint32_t>(m_Data, block.EntitiesOffset + i * sizeof(uint32_t));
+					if (entityIndex >= m_Header.EntityCount) {
+						continue;
+					}
+					fn(entityIndex, ReadAt<TRecord>(m_Data, block.RecordsOffset + static_cast<uint64_t>(i) * sizeof(TRecord)));
+				}
+			}
+
+		private:
+			bool InRange(uint64_t offset, uint64_t count, uint64_t elementSize) const {
+				return offset <= m_Size && count <= (m_Size - offset) / elementSize;
+			}
+
+			const std::byte* m_Data = nullptr;
+			size_t m_Size = 0;
+			uint64_t m_Chars = 0;
+			BinaryScene::Header m_Header{};
+		};
+
+		bool SceneView::Open(const std::byte* data, size_t size, const std::string& source) {
+			m_Data = data;
+			m_Size = size;
+
+			if (size < sizeof(BinaryScene::Header)) {
+				BT_CORE_ERROR_TAG("BinarySceneSerializer", "Binary scene is truncated: {}", source);
+				return false;
+			}
+
+			m_Header = ReadAt<BinaryScene::Header>(data, 0);
+			if (std::memcmp(m_Header.Magic, BinaryScene::k_Magic, sizeof(m_Header.Magic)) != 0) {
+				BT_CORE_ERROR_TAG("BinarySceneSerializer", "Not a binary scene file: {}", source);
+				return false;
+			}
+			if (m_Header.Version != BinaryScene::k_Version) {
+				BT_CORE_ERROR_TAG("BinarySceneSerializer", "Binary scene version {} is not supported ({}): {}",
+					m_Header.Version, BinaryScene::k_Version, source);
+				return false;
+			}
+			if (m_Header.FileSize > size) {
+				BT_CORE_ERROR_TAG("BinarySceneSerializer", "Binary scene is truncated: {}", source);
+				return false;
+			}
+
+			const bool tablesInRange =
+				InRange(m_Header.StringTableOffset, static_cast<uint64_t>(m_Header.StringCount) + 1, sizeof(uint32_t))
+				&& InRange(m_Header.EntityTableOffset, m_Header.EntityCount, sizeof(BinaryScene::EntityRecord))
+				&& InRange(m_Header.BlockTableOffset, m_Header.BlockCount, sizeof(BinaryScene::BlockEntry));
+			if (!tablesInRange) {
+				BT_CORE_ERROR_TAG("BinarySceneSerializer", "Binary scene has out of range tables: {}", source);
+				return false;
+			}
+
+			// Validated once here, so GetString needs no checks beyond the index
+			m_Chars = m_Header.StringTableOffset + (static_cast<uint64_t>(m_Header.StringCount) + 1) * sizeof(uint32_t);
+			const uint32_t charsSize = ReadAt<uint32_t>(data, m_Header.StringTableOffset + m_Header.StringCount * sizeof(uint32_t));
+			if (!InRange(m_Chars, charsSize, 1)) {
+				BT_CORE_ERROR_TAG("BinarySceneSerializer", "Binary scene string table is truncated: {}", source);
+				return false;
+			}
+
+			uint32_t previousEnd = 0;
+			for (uint32_t i = 0; i < m_Header.StringCount; i++) {
+				const uint32_t begin = ReadAt<uint32_t>(data, m_Header.StringTableOffset + i * sizeof(uint32_t));
+				const uint32_t end = ReadAt<uint32_t>(data, m_Header.StringTableOffset + (i + 1) * sizeof(uint32_t));
+				if (begin != previousEnd || end <= begin || end > charsSize || data[m_Chars + end - 1] != std::byte{ 0 }) {
+					BT_CORE_ERROR_TAG("BinarySceneSerializer", "Binary scene string table is corrupt: {}", source);
+					return false;
+				}
+				previousEnd = end;
+			}
+
+			for (uint32_t i = 0; i < m_Header.BlockCount; i++) {
+				const BinaryScene::BlockEntry block = GetBlock(i);
+				if (block.RecordSize == 0
+					|| !InRange(block.EntitiesOffset, block.Count, sizeof(uint32_t))
+					|| !InRange(block.RecordsOffset, block.Count, block.RecordSize)) {
+					BT_CORE_ERROR_TAG("BinarySceneSerializer", "Binary scene component block {} is out of range: {}", i, source);
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		template<typename TComponent>
+		TComponent* AddComponentOnce(Scene& scene, EntityHandle entity) {
+			if (scene.HasComponent<TComponent>(entity)) {
+				return nullptr;
+			}
+			return &scene.AddComponent<TComponent>(entity);
+		}
+
+		void RestoreScripts(ScriptComponent& scriptComponent, const std::string& classNames, const std::string& fieldsJson) {
+			size_t start = 0;
+			while (start <= classNames.size()) {
+				const size_t end = std::min(classNames.find(k_ScriptNameSeparator, start), classNames.size());
+				if (end > start) {
+					scriptComponent.AddScript(classNames.substr(start, end - start));
+				}
+				start = end + 1;
+			}
+
+			if (fieldsJson.empty()) {
+				return;
+			}
+
+			Value fieldsByClass;
+			if (!Json::TryParse(fieldsJson, fieldsByClass) || !fieldsByClass.IsObject()) {
+				return;
+			}
+
+			for (const auto& [className, fieldsValue] : fieldsByClass.GetObject()) {
+				if (!scriptComponent.HasScript(className) || !fieldsValue.IsArray()) {
+					continue;
+				}
+
+				for (const Value& fieldValue : fieldsValue.GetArray()) {
+					if (!fieldValue.IsObject()) {
+						continue;
+					}
+
+					const std::string fieldName = GetStringMember(fieldValue, "name");
+					const Value* valueValue = fieldValue.FindMember("value");
+					if (fieldName.empty() || !valueValue) {
+						continue;
+					}
+
+					scriptComponent.PendingFieldValues[className + "." + fieldName] = ValueToFieldString(*valueValue);
+				}
+			}
+		}
+
+		void RestoreBlock(Scene& scene, const SceneView& view, const BinaryScene::BlockEntry& block, const std::vector<EntityHandle>& entities) {
+			switch (block.Component) {
+			case ComponentId::Transform2D:
+				view.ForEachRecord<BinaryScene::Transform2DRecord>(block, [&](uint32_t index, const BinaryScene::Transform2DRecord& record) {
+					auto& transform = scene.GetComponent<Transform2DComponent>(entities[index]);
+					transform.Position = { record.PosX, record.PosY };
+					transform.Rotation = record.Rotation;
+					transform.Scale = { record.ScaleX, record.ScaleY };
+				});
+				break;
+
+			case ComponentId::SpriteRenderer:
+				view.ForEachRecord<BinaryScene::SpriteRendererRecord>(block, [&](uint32_t index, const BinaryScene::SpriteRendererRecord& record) {
+					auto* spriteRenderer = AddComponentOnce<SpriteRendererComponent>(scene, entities[index]);
+					if (!spriteRenderer) {
+						return;
+					}
+
+					spriteRenderer->Color = Color(record.R, record.G, record.B, record.A);
+					spriteRenderer->SortingOrder = record.SortOrder;
+					spriteRenderer->SortingLayer = record.SortLayer;
+					spriteRenderer->TextureHandle = LoadTextureAsset(record.TextureAsset, view.GetString(record.Texture), &spriteRenderer->TextureAssetId);
+
+					if (Texture2D* texture = TextureManager::GetTexture(spriteRenderer->TextureHandle)) {
+						const int filter = record.Filter >= 0 ? record.Filter : static_cast<int>(Filter::Point);
+						const int wrapU = record.WrapU >= 0 ? record.WrapU : static_cast<int>(Wrap::Clamp);
+						const int wrapV = record.WrapV >= 0 ? record.WrapV : static_cast<int>(Wrap::Clamp);
+						texture->SetSampler(static_cast<Filter>(filter), static_cast<Wrap>(wrapU), static_cast<Wrap>(wrapV));
+					}
+				});
+				break;
+
+			case ComponentId::Rigidbody2D:
+				view.ForEachRecord<BinaryScene::Rigidbody2DRecord>(block, [&](uint32_t index, const BinaryScene::Rigidbody2DRecord& record) {
+					auto* rigidbody = AddComponentOnce<Rigidbody2DComponent>(scene, entities[index]);
+					if (!rigidbody) {
+						return;
+					}
+
+					rigidbody->SetBodyType(static_cast<BodyType>(record.BodyType));
+					rigidbody->SetGravityScale(record.GravityScale);
+					rigidbody->SetMass(record.Mass);
+					rigidbody->SetInterpolation(static_cast<InterpolationMode>(record.Interpolation));
+				});
+				break;
+
+			case ComponentId::BoxCollider2D:
+				view.ForEachRecord<BinaryScene::BoxCollider2DRecord>(block, [&](uint32_t index, const BinaryScene::BoxCollider2DRecord& record) {
+					const EntityHandle entity = entities[index];
+					auto* boxCollider = AddComponentOnce<BoxCollider2DComponent>(scene, entity);
+					if (!boxCollider) {
+						return;
+					}
+
+					boxCollider->SetCenter({ record.CenterX, record.CenterY }, scene);
+
+					const auto& transform = scene.GetComponent<Transform2DComponent>(entity);
+					Vec2 localScale{ 1.0f, 1.0f };
+					if (std::fabs(transform.Scale.x) > k_MinScaleAxis) {
+						localScale.x = record.ScaleX / transform.Scale.x;
+					}
+					if (std::fabs(transform.Scale.y) > k_MinScaleAxis) {
+						localScale.y = record.ScaleY / transform.Scale.y;
+					}
+					boxCollider->SetScale(localScale, scene);
+					boxCollider->SetSensor(record.Sensor != 0, scene);
+					boxCollider->SetFriction(record.Friction);
+					boxCollider->SetBounciness(record.Bounciness);
+					boxCollider->SetLayer(record.CollisionLayer);
+					boxCollider->SetRegisterContacts(record.RegisterContacts != 0);
+				});
+				break;
+
+			case ComponentId::AudioSource:
+				view.ForEachRecord<BinaryScene::AudioSourceRecord>(block, [&](uint32_t index, const BinaryScene::AudioSourceRecord& record) {
+					auto* audioSource = AddComponentOnce<AudioSourceComponent>(scene, entities[index]);
+					if (!audioSource) {
+						return;
+					}
+
+					audioSource->SetVolume(record.Volume);
+					audioSource->SetPitch(record.Pitch);
+					audioSource->SetLoop(record.Loop != 0);
+					audioSource->SetPlayOnAwake(record.PlayOnAwake != 0);
+
+					UUID audioAssetId = UUID(0);
+					const AudioHandle handle = LoadAudioAsset(record.ClipAsset, view.GetString(record.Clip), &audioAssetId);
+					if (handle.IsValid()) {
+						audioSource->SetAudioHandle(handle, audioAssetId);
+					}
+				});
+				break;
+
+			case ComponentId::Camera2D:
+				view.ForEachRecord<BinaryScene::Camera2DRecord>(block, [&](uint32_t index, const BinaryScene::Camera2DRecord& record) {
+					auto* camera = AddComponentOnce<Camera2DComponent>(scene, entities[index]);
+					if (!camera) {
+						return;
+					}
+
+					camera->SetOrthographicSize(record.OrthoSize);
+					camera->SetZoom(record.Zoom);
+					camera->SetClearColor(Color(record.ClearR, record.ClearG, record.ClearB, record.ClearA));
+				});
+				break;
+
+			case ComponentId::BoltBody2D:
+				view.ForEachRecord<BinaryScene::BoltBody2DRecord>(block, [&](uint32_t index, const BinaryScene::BoltBody2DRecord& record) {
+					auto* body = AddComponentOnce<BoltBody2DComponent>(scene, entities[index]);
+					if (!body) {
+						return;
+					}
+
+					body->Type = static_cast<BoltPhys::BodyType>(record.Type);
+					body->Mass = record.Mass;
+					body->UseGravity = record.UseGravity != 0;
+					body->BoundaryCheck = record.BoundaryCheck != 0;
+
+					if (body->m_Body) {
+						body->m_Body->SetBodyType(body->Type);
+						body->m_Body->SetMass(body->Mass);
+						body->m_Body->SetGravityEnabled(body->UseGravity);
+						body->m_Body->SetBoundaryCheckEnabled(body->BoundaryCheck);
+					}
+				});
+				break;
+
+			case ComponentId::BoltBoxCollider2D:
+				view.ForEachRecord<BinaryScene::BoltBoxCollider2DRecord>(block, [&](uint32_t index, const BinaryScene::BoltBoxCollider2DRecord& record) {
+					auto* collider = AddComponentOnce<BoltBoxCollider2DComponent>(scene, entities[index]);
+					if (!collider) {
+						return;
+					}
+
+					collider->HalfExtents = { record.HalfX, record.HalfY };
+					if (collider->m_Collider) {
+						collider->m_Collider->SetHalfExtents({ record.HalfX, record.HalfY });
+					}
+				});
+				break;
+
+			case ComponentId::BoltCircleCollider2D:
+				view.ForEachRecord<BinaryScene::BoltCircleCollider2DRecord>(block, [&](uint32_t index, const BinaryScene::BoltCircleCollider2DRecord& record) {
+					auto* collider = AddComponentOnce<BoltCircleCollider2DComponent>(scene, entities[index]);
+					if (!collider) {
+						return;
+					}
+
+					collider->Radius = record.Radius;
+					if (collider->m_Collider) {
+						collider->m_Collider->SetRadius(record.Radius);
+					}
+				});
+				break;
+
+			case ComponentId::ParticleSystem2D:
+				view.ForEachRecord<BinaryScene::ParticleSystem2DRecord>(block, [&](uint32_t index, const BinaryScene::ParticleSystem2DRecord& record) {
+					auto* particleSystem = AddComponentOnce<ParticleSystem2DComponent>(scene, entities[index]);
+					if (!particleSystem) {
+						return;
+					}
+
+					particleSystem->PlayOnAwake = record.PlayOnAwake != 0;
+					particleSystem->ParticleSettings.LifeTime = record.LifeTime;
+					particleSystem->ParticleSettings.Speed = record.Speed;
+					particleSystem->ParticleSettings.Scale = record.Scale;
+					particleSystem->ParticleSettings.Gravity = { record.GravityX, record.GravityY };
+					particleSystem->ParticleSettings.UseGravity = record.UseGravity != 0;
+					particleSystem->ParticleSettings.UseRandomColors = record.UseRandomColors != 0;
+					particleSystem->ParticleSettings.MoveDirection = { record.MoveDirectionX, record.MoveDirectionY };
+					particleSystem->ParticleSettings.Simulation = static_cast<ParticleSystem2DComponent::SimulationMode>(record.Simulation);
+					particleSystem->EmissionSettings.EmitOverTime = record.EmitOverTime;
+					particleSystem->EmissionSettings.RateOverDistance = record.RateOverDistance;
+					particleSystem->EmissionSettings.EmissionSpace = static_cast<ParticleSystem2DComponent::Space>(record.EmissionSpace);
+
+					if (record.ShapeType == 0) {
+						ParticleSystem2DComponent::CircleParams circle;
+						circle.Radius = record.ShapeX;
+						circle.IsOnCircle = record.IsOnCircle != 0;
+						particleSystem->Shape = circle;
+					}
+					else {
+						ParticleSystem2DComponent::SquareParams square;
+						square.HalfExtends = { record.ShapeX, record.ShapeY };
+						particleSystem->Shape = square;
+					}
+
+					particleSystem->RenderingSettings.MaxParticles = record.MaxParticles;
+					particleSystem->RenderingSettings.Color = Color(record.ColorR, record.ColorG, record.ColorB, record.ColorA);
+					particleSystem->RenderingSettings.SortingOrder = record.SortOrder;
+					particleSystem->RenderingSettings.SortingLayer = record.SortLayer;
+
+					UUID textureAssetId = UUID(0);
+					const TextureHandle textureHandle = LoadTextureAsset(record.TextureAsset, view.GetString(record.Texture), &textureAssetId);
+					if (textureHandle.IsValid()) {
+						particleSystem->SetTexture(textureHandle, textureAssetId);
+					}
+				});
+				break;
+
+			case ComponentId::RectTransform:
+				view.ForEachRecord<BinaryScene::RectTransformRecord>(block, [&](uint32_t index, const BinaryScene::RectTransformRecord& record) {
+					auto* rectTransform = AddComponentOnce<RectTransformComponent>(scene, entities[index]);
+					if (!rectTransform) {
+						return;
+					}
+
+					rectTransform->Position = { record.PosX, record.PosY };
+					rectTransform->Pivot = { record.PivotX, record.PivotY };
+					rectTransform->Width = record.Width;
+					rectTransform->Height = record.Height;
+					rectTransform->Rotation = record.Rotation;
+					rectTransform->Scale = { record.ScaleX, record.ScaleY };
+				});
+				break;
+
+			case ComponentId::Image:
+				view.ForEachRecord<BinaryScene::ImageRecord>(block, [&](uint32_t index, const BinaryScene::ImageRecord& record) {
+					auto* image = AddComponentOnce<ImageComponent>(scene, entities[index]);
+					if (!image) {
+						return;
+					}
+
+					image->Color = Color(record.R, record.G, record.B, record.A);
+					image->TextureHandle = LoadTextureAsset(record.TextureAsset, view.GetString(record.Texture), &image->TextureAssetId);
+				});
+				break;
+
+			case ComponentId::Scripts:
+				view.ForEachRecord<BinaryScene::ScriptsRecord>(block, [&](uint32_t index, const BinaryScene::ScriptsRecord& record) {
+					auto* scriptComponent = AddComponentOnce<ScriptComponent>(scene, entities[index]);
+					if (scriptComponent) {
+						RestoreScripts(*scriptComponent, view.GetString(record.ClassNames), view.GetString(record.FieldsJson));
+					}
+				});
+				break;
+
+			default:
+				BT_CORE_WARN_TAG("BinarySceneSerializer", "Skipping unknown component block {}", static_cast<uint32_t>(block.Component));
+				break;
+			}
+		}
+
+		void RestoreScene(Scene& scene, const SceneView& view, const std::string& path) {
+			const BinaryScene::Header& header = view.GetHeader();
+
+			const std::string serializedName = view.GetString(header.Name);
+			if (!path.empty()) {
+				scene.SetName(std::filesystem::path(path).stem().string());
+			}
+			else if (!serializedName.empty()) {
+				scene.SetName(serializedName);
+			}
+
+			if (header.SceneId != 0) {
+				scene.SetSceneId(UUID(header.SceneId));
+			}
+
+			scene.ClearEntities();
+
+			std::vector<EntityHandle> entities;
+			entities.reserve(header.EntityCount);
+			for (uint32_t i = 0; i < header.EntityCount; i++) {
+				const BinaryScene::EntityRecord record = view.GetEntity(i);
+				const EntityHandle entity = scene.CreateEntity(view.GetString(record.Name, "Entity")).GetHandle();
+
+				if (record.UUID != 0 && scene.HasComponent<UUIDComponent>(entity)) {
+					scene.SetEntityUUID(entity, UUID(record.UUID));
+				}
+				if (record.Flags & BinaryScene::EntityFlag_Static) {
+					scene.AddComponent<StaticTag>(entity);
+				}
+				if (record.Flags & BinaryScene::EntityFlag_Disabled) {
+					scene.AddComponent<DisabledTag>(entity);
+				}
+				if (record.Flags & BinaryScene::EntityFlag_Deadly) {
+					scene.AddComponent<DeadlyTag>(entity);
+				}
+
+				entities.push_back(entity);
+			}
+
+			for (uint32_t i = 0; i < header.BlockCount; i++) {
+				RestoreBlock(scene, view, view.GetBlock(i), entities);
+			}
+
+			if (scene.GetRegistry().view<Camera2DComponent>().size() == 0) {
+				EntityHelper::CreateCamera2DEntity(scene);
+				BT_CORE_INFO_TAG("BinarySceneSerializer", "Added default camera (none in scene data)");
+			}
+
+			scene.ClearDirty();
+		}
+
+		// ── Binary -> JSON ──────────────────────────────────────────────
+
+		void AddTextureMembers(Value& object, const SceneView& view, uint32_t texture, uint64_t textureAsset) {
+			if (texture != BinaryScene::k_NoString) {
+				object.AddMember("texture", Value(view.GetString(texture)));
+			}
+			if (textureAsset != 0) {
+				object.AddMember("textureAsset", Value(std::to_string(textureAsset)));
+			}
+		}
+
+		void DecodeBlock(const SceneView& view, const BinaryScene::BlockEntry& block, std::vector<Value>& entities) {
+			switch (block.Component) {
+			case ComponentId::Transform2D:
+				view.ForEachRecord<BinaryScene::Transform2DRecord>(block, [&](uint32_t index, const BinaryScene::Transform2DRecord& record) {
+					Value transformValue = Value::MakeObject();
+					transformValue.AddMember("posX", Value(record.PosX));
+					transformValue.AddMember("posY", Value(record.PosY));
+					transformValue.AddMember("rotation", Value(record.Rotation));
+					transformValue.AddMember("scaleX", Value(record.ScaleX));
+					transformValue.AddMember("scaleY", Value(record.ScaleY));
+					entities[index].AddMember("Transform2D", std::move(transformValue));
+				});
+				break;
+
+			case ComponentId::SpriteRenderer:
+				view.ForEachRecord<BinaryScene::SpriteRendererRecord>(block, [&](uint32_t index, const BinaryScene::SpriteRendererRecord& record) {
+					Value spriteValue = Value::MakeObject();
+					spriteValue.AddMember("r", Value(record.R));
+					spriteValue.AddMember("g", Value(record.G));
+					spriteValue.AddMember("b", Value(record.B));
+					spriteValue.AddMember("a", Value(record.A));
+					spriteValue.AddMember("sortOrder", Value(static_cast<int>(record.SortOrder)));
+					spriteValue.AddMember("sortLayer", Value(static_cast<int>(record.SortLayer)));
+					AddTextureMembers(spriteValue, view, record.Texture, record.TextureAsset);
+					if (record.Filter >= 0) spriteValue.AddMember("filter", Value(record.Filter));
+					if (record.WrapU >= 0) spriteValue.AddMember("wrapU", Value(record.WrapU));
+					if (record.WrapV >= 0) spriteValue.AddMember("wrapV", Value(record.WrapV));
+					entities[index].AddMember("SpriteRenderer", std::move(spriteValue));
+				});
+				break;
+
+			case ComponentId::Rigidbody2D:
+				view.ForEachRecord<BinaryScene::Rigidbody2DRecord>(block, [&](uint32_t index, const BinaryScene::Rigidbody2DRecord& record) {
+					Value rigidbodyValue = Value::MakeObject();
+					rigidbodyValue.AddMember("bodyType", Value(record.BodyType));
+					rigidbodyValue.AddMember("gravityScale", Value(record.GravityScale));
+					rigidbodyValue.AddMember("mass", Value(record.Mass));
+					rigidbodyValue.AddMember("interpolation", Value(record.Interpolation));
+					entities[index].AddMember("Rigidbody2D", std::move(rigidbodyValue));
+				});
+				break;
+
+			case ComponentId::BoxCollider2D:
+				view.ForEachRecord<BinaryScene::BoxCollider2DRecord>(block, [&](uint32_t index, const BinaryScene::BoxCollider2DRecord& record) {
+					Value colliderValue = Value::MakeObject();
+					colliderValue.AddMember("scaleX", Value(record.ScaleX));
+					colliderValue.AddMember("scaleY", Value(record.ScaleY));
+					colliderValue.AddMember("centerX", Value(record.CenterX));
+					colliderValue.AddMember("centerY", Value(record.CenterY));
+					colliderValue.AddMember("friction", Value(record.Friction));
+					colliderValue.AddMember("bounciness", Value(record.Bounciness));
+					colliderValue.AddMember("collisionLayer", Value(record.CollisionLayer));
+					colliderValue.AddMember("registerContacts", Value(record.RegisterContacts != 0));
+					colliderValue.AddMember("sensor", Value(record.Sensor != 0));
+					entities[index].AddMember("BoxCollider2D", std::move(colliderValue));
+				});
+				break;
+
+			case ComponentId::AudioSource:
+				view.ForEachRecord<BinaryScene::AudioSourceRecord>(block, [&](uint32_t index, const BinaryScene::AudioSourceRecord& record) {
+					Value audioValue = Value::MakeObject();
+					audioValue.AddMember("volume", Value(record.Volume));
+					audioValue.AddMember("pitch", Value(record.Pitch));
+					audioValue.AddMember("loop", Value(record.Loop != 0));
+					audioValue.AddMember("playOnAwake", Value(record.PlayOnAwake != 0));
+					if (record.Clip != BinaryScene::k_NoString) {
+						audioValue.AddMember("clip", Value(view.GetString(record.Clip)));
+					}
+					if (record.ClipAsset != 0) {
+						audioValue.AddMember("clipAsset", Value(std::to_string(record.ClipAsset)));
+					}
+					entities[index].AddMember("AudioSource", std::move(audioValue));
+				});
+				break;
+
+			case ComponentId::Camera2D:
+				view.ForEachRecord<BinaryScene::Camera2DRecord>(block, [&](uint32_t index, const BinaryScene::Camera2DRecord& record) {
+					Value cameraValue = Value::MakeObject();
+					cameraValue.AddMember("orthoSize", Value(record.OrthoSize));
+					cameraValue.AddMember("zoom", Value(record.Zoom));
+					cameraValue.AddMember("clearR", Value(record.ClearR));
+					cameraValue.AddMember("clearG", Value(record.ClearG));
+					cameraValue.AddMember("clearB", Value(record.ClearB));
+					cameraValue.AddMember("clearA", Value(record.ClearA));
+					entities[index].AddMember("Camera2D", std::move(cameraValue));
+				});
+				break;
+
+			case ComponentId::BoltBody2D:
+				view.ForEachRecord<BinaryScene::BoltBody2DRecord>(block, [&](uint32_t index, const BinaryScene::BoltBody2DRecord& record) {
+					Value bodyValue = Value::MakeObject();
+					bodyValue.AddMember("type", Value(record.Type));
+					bodyValue.AddMember("mass", Value(record.Mass));
+					bodyValue.AddMember("useGravity", Value(record.UseGravity != 0));
+					bodyValue.AddMember("boundaryCheck", Value(record.BoundaryCheck != 0));
+					entities[index].AddMember("BoltBody2D", std::move(bodyValue));
+				});
+				break;
+
+			case ComponentId::BoltBoxCollider2D:
+				view.ForEachRecord<BinaryScene::BoltBoxCollider2DRecord>(block, [&](uint32_t index, const BinaryScene::BoltBoxCollider2DRecord& record) {
+					Value colliderValue = Value::MakeObject();
+					colliderValue.AddMember("halfX", Value(record.HalfX));
+					colliderValue.AddMember("halfY", Value(record.HalfY));
+					entities[index].AddMember("BoltBoxCollider2D", std::move(colliderValue));
+				});
+				break;
+
+			case ComponentId::BoltCircleCollider2D:
+				view.ForEachRecord<BinaryScene::BoltCircleCollider2DRecord>(block, [&](uint32_t index, const BinaryScene::BoltCircleCollider2DRecord& record) {
+					Value colliderValue = Value::MakeObject();
+					colliderValue.AddMember("radius", Value(record.Radius));
+					entities[index].AddMember("BoltCircleCollider2D", std::move(colliderValue));
+				});
+				break;
+
+			case ComponentId::ParticleSystem2D:
+				view.ForEachRecord<BinaryScene::ParticleSystem2DRecord>(block, [&](uint32_t index, const BinaryScene::ParticleSystem2DRecord& record) {
+					Value particleValue = Value::MakeObject();
+					particleValue.AddMember("playOnAwake", Value(record.PlayOnAwake != 0));
+					particleValue.AddMember("lifetime", Value(record.LifeTime));
+					particleValue.AddMember("speed", Value(record.Speed));
+					particleValue.AddMember("scale", Value(record.Scale));
+					particleValue.AddMember("gravityX", Value(record.GravityX));
+					particleValue.AddMember("gravityY", Value(record.GravityY));
+					particleValue.AddMember("useGravity", Value(record.UseGravity != 0));
+					particleValue.AddMember("useRandomColors", Value(record.UseRandomColors != 0));
+					particleValue.AddMember("moveDirectionX", Value(record.MoveDirectionX));
+					particleValue.AddMember("moveDirectionY", Value(record.MoveDirectionY));
+					particleValue.AddMember("simulation", Value(record.Simulation));
+					particleValue.AddMember("emitOverTime", Value(static_cast<int>(record.EmitOverTime)));
+					particleValue.AddMember("rateOverDistance", Value(static_cast<int>(record.RateOverDistance)));
+					particleValue.AddMember("emissionSpace", Value(static_cast<int>(record.EmissionSpace)));
+					particleValue.AddMember("shapeType", Value(static_cast<int>(record.ShapeType)));
+					if (record.ShapeType == 0) {
+						particleValue.AddMember("radius", Value(record.ShapeX));
+						particleValue.AddMember("isOnCircle", Value(record.IsOnCircle != 0));
+					}
+					else {
+						particleValue.AddMember("halfExtendsX", Value(record.ShapeX));
+						particleValue.AddMember("halfExtendsY", Value(record.ShapeY));
+					}
+					particleValue.AddMember("maxParticles", Value(static_cast<int64_t>(record.MaxParticles)));
+					particleValue.AddMember("colorR", Value(record.ColorR));
+					particleValue.AddMember("colorG", Value(record.ColorG));
+					particleValue.AddMember("colorB", Value(record.ColorB));
+					particleValue.AddMember("colorA", Value(record.ColorA));
+					particleValue.AddMember("sortOrder", Value(static_cast<int>(record.SortOrder)));
+					particleValue.AddMember("sortLayer", Value(static_cast<int>(record.SortLayer)));
+					AddTextureMembers(particleValue, view, record.Texture, record.TextureAsset);
+					entities[index].AddMember("ParticleSystem2D", std::move(particleValue));
+				});
+				break;
+
+			case ComponentId::RectTransform:
+				view.ForEachRecord<BinaryScene::RectTransformRecord>(block, [&](uint32_t index, const BinaryScene::RectTransformRecord& record) {
+					Value rectValue = Value::MakeObject();
+					rectValue.AddMember("posX", Value(record.PosX));
+					rectValue.AddMember("posY", Value(record.PosY));
+					rectValue.AddMember("pivotX", Value(record.PivotX));
+					rectValue.AddMember("pivotY", Value(record.PivotY));
+					rectValue.AddMember("width", Value(record.Width));
+					rectValue.AddMember("height", Value(record.Height));
+					rectValue.AddMember("rotation", Value(record.Rotation));
+					rectValue.AddMember("scaleX", Value(record.ScaleX));
+					rectValue.AddMember("scaleY", Value(record.ScaleY));
+					entities[index].AddMember("RectTransform", std::move(rectValue));
+				});
+				break;
+
+			case ComponentId::Image:
+				view.ForEachRecord<BinaryScene::ImageRecord>(block, [&](uint32_t index, const BinaryScene::ImageRecord& record) {
+					Value imageValue = Value::MakeObject();
+					imageValue.AddMember("r", Value(record.R));
+					imageValue.AddMember("g", Value(record.G));
+					imageValue.AddMember("b", Value(record.B));
+					imageValue.AddMember("a", Value(record.A));
+					AddTextureMembers(imageValue, view, record.Texture, record.TextureAsset);
+					entities[index].AddMember("Image", std::move(imageValue));
+				});
+				break;
+
+			case ComponentId::Scripts:
+				view.ForEachRecord<BinaryScene::ScriptsRecord>(block, [&](uint32_t index, const BinaryScene::ScriptsRecord& record) {
+					const std::string classNames = view.GetString(record.ClassNames);
+					Value scriptsValue = Value::MakeArray();
+					size_t start = 0;
+					while (start <= classNames.size()) {
+						const size_t end = std::min(classNames.find(k_ScriptNameSeparator, start), classNames.size());
+						if (end > start) {
+							scriptsValue.Append(Value(classNames.substr(start, end - start)));
+						}
+						start = end + 1;
+					}
+					entities[index].AddMember("Scripts", std::move(scriptsValue));
+
+					Value fieldsByClass;
+					if (record.FieldsJson != BinaryScene::k_NoString
+						&& Json::TryParse(view.GetString(record.FieldsJson), fieldsByClass)
+						&& fieldsByClass.IsObject()) {
+						entities[index].AddMember("ScriptFields", std::move(fieldsByClass));
+					}
+				});
+				break;
+
+			default:
+				BT_CORE_WARN_TAG("BinarySceneSerializer", "Skipping unknown component block {}", static_cast<uint32_t>(block.Component));
+				break;
+			}
+		}
+
+		bool WriteBytes(const std::vector<std::byte>& bytes, const std::string& path) {
+			const std::filesystem::path parentDir = std::filesystem::path(path).parent_path();
+			if (!parentDir.empty() && !std::filesystem::exists(parentDir)) {
+				std::filesystem::create_directories(parentDir);
+			}
+
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			if (!file.is_open()) {
+				return false;
+			}
+
+			file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+			return file.good();
+		}
+	} // namespace
+
+	bool BinarySceneSerializer::IsBinaryScenePath(const std::string& path) {
+		return std::filesystem::path(path).extension() == BinaryScene::k_FileExtension;
+	}
+
+	std::string BinarySceneSerializer::GetBinaryPath(const std::string& scenePath) {
+		return std::filesystem::path(scenePath).replace_extension(BinaryScene::k_FileExtension).string();
+	}
+
+	std::string BinarySceneSerializer::GetUpToDateBinaryPath(const std::string& scenePath) {
+		std::error_code ec;
+		const std::string binaryPath = GetBinaryPath(scenePath);
+		if (binaryPath == scenePath || !std::filesystem::exists(binaryPath, ec)) {
+			return {};
+		}
+		if (!std::filesystem::exists(scenePath, ec)) {
+			return binaryPath;
+		}
+
+		const auto binaryTime = std::filesystem::last_write_time(binaryPath, ec);
+		if (ec) {
+			return {};
+		}
+		const auto sceneTime = std::filesystem::last_write_time(scenePath, ec);
+		if (ec) {
+			return {};
+		}
+		return binaryTime >= sceneTime ? binaryPath : std::string{};
+	}
+
+	bool BinarySceneSerializer::SaveToFile(Scene& scene, const std::string& path) {
+		try {
+			if (!WriteFromJson(SceneSerializer::SerializeScene(scene), path)) {
+				return false;
+			}
+
+			BT_CORE_INFO_TAG("BinarySceneSerializer", "Saved binary scene: {}", scene.GetName());
+			return true;
+		}
+		catch (const std::exception& exception) {
+			BT_CORE_ERROR_TAG("BinarySceneSerializer", "Save failed: {}", exception.what());
+			return false;
+		}
+	}
+
+	bool BinarySceneSerializer::LoadFromFile(Scene& scene, const std::string& path) {
+		try {
+			MappedFile file;
+			if (!file.Open(path)) {
+				BT_CORE_WARN_TAG("BinarySceneSerializer", "Binary scene file not found or empty: {}", path);
+				return false;
+			}
+
+			SceneView view;
+			if (!view.Open(file.GetData(), file.GetSize(), path)) {
+				return false;
+			}
+
+			RestoreScene(scene, view, path);
+			BT_CORE_INFO_TAG("BinarySceneSerializer", "Loaded binary scene: {} ({} entities)", scene.GetName(), view.GetHeader().EntityCount);
+			return true;
+		}
+		catch (const std::exception& exception) {
+			BT_CORE_ERROR_TAG("BinarySceneSerializer", "Load failed: {}", exception.what());
+			return false;
+		}
+	}
+
+	bool BinarySceneSerializer::WriteFromJson(const Json::Value& root, const std::string& path) {
+		if (!root.IsObject()) {
+			BT_CORE_ERROR_TAG("BinarySceneSerializer", "WriteFromJson requires an object root");
+			return false;
+		}
+
+		try {
+			if (!WriteBytes(EncodeScene(root), path)) {
+				BT_CORE_ERROR_TAG("BinarySceneSerializer", "Failed to write binary scene: {}", path);
+				return false;
+			}
+			return true;
+		}
+		catch (const std::exception& exception) {
+			BT_CORE_ERROR_TAG("BinarySceneSerializer", "WriteFromJson failed: {}", exception.what());
+			return false;
+		}
+	}
+
+	bool BinarySceneSerializer::ReadToJson(const std::string& path, Json::Value& outRoot) {
+		try {
+			MappedFile file;
+			if (!file.Open(path)) {
+				BT_CORE_WARN_TAG("BinarySceneSerializer", "Binary scene file not found or empty: {}", path);
+				return false;
+			}
+
+			SceneView view;
+			if (!view.Open(file.GetData(), file.GetSize(), path)) {
+				return false;
+			}
+
+			const BinaryScene::Header& header = view.GetHeader();
+			std::vector<Value> entities;
+			entities.reserve(header.EntityCount);
+			for (uint32_t i = 0; i < header.EntityCount; i++) {
+				const BinaryScene::EntityRecord record = view.GetEntity(i);
+				Value entityValue = Value::MakeObject();
+				entityValue.AddMember("name", Value(view.GetString(record.Name, "Entity")));
+				if (record.UUID != 0) {
+					entityValue.AddMember("uuid", Value(std::to_string(record.UUID)));
+				}
+				if (record.Flags & BinaryScene::EntityFlag_Static) entityValue.AddMember("static", Value(true));
+				if (record.Flags & BinaryScene::EntityFlag_Disabled) entityValue.AddMember("disabled", Value(true));
+				if (record.Flags & BinaryScene::EntityFlag_Deadly) entityValue.AddMember("deadly", Value(true));
+				entities.push_back(std::move(entityValue));
+			}
+
+			for (uint32_t i = 0; i < header.BlockCount; i++) {
+				DecodeBlock(view, view.GetBlock(i), entities);
+			}
+
+			Value root = Value::MakeObject();
+			root.AddMember("version", Value(k_JsonSceneFormatVersion));
+			root.AddMember("name", Value(view.GetString(header.Name)));
+			root.AddMember("sceneId", Value(std::to_string(header.SceneId)));
+
+			Value entitiesValue = Value::MakeArray();
+			for (Value& entityValue : entities) {
+				entitiesValue.Append(std::move(entityValue));
+			}
+			root.AddMember("entities", std::move(entitiesValue));
+
+			outRoot = std::move(root);
+			return true;
+		}
+		catch (const std::exception& exception) {
+			BT_CORE_ERROR_TAG("BinarySceneSerializer", "ReadToJson failed: {}", exception.what());
+			return false;
+		}
+	}
+
+	bool BinarySceneSerializer::ConvertJsonToBinary(const std::string& jsonPath, const std::string& binaryPath) {
+		try {
+			if (!File::Exists(jsonPath)) {
+				BT_CORE_WARN_TAG("BinarySceneSerializer", "Scene file not found: {}", jsonPath);
+				return false;
+			}
+
+			Value root;
+			std::string parseError;
+			if (!Json::TryParse(File::ReadAllText(jsonPath), root, &parseError) || !root.IsObject()) {
+				BT_CORE_ERROR_TAG("BinarySceneSerializer", "Failed to parse scene JSON {}: {}", jsonPath, parseError);
+				return false;
+			}
+
+			return WriteFromJson(root, binaryPath);
+		}
+		catch (const std::exception& exception) {
+			BT_CORE_ERROR_TAG("BinarySceneSerializer", "ConvertJsonToBinary failed: {}", exception.what());
+			return false;
+		}
+	}
+
+	bool BinarySceneSerializer::ConvertBinaryToJson(const std::string& binaryPath, const std::string& jsonPath) {
+		try {
+			Value root;
+			if (!ReadToJson(binaryPath, root)) {
+				return false;
+			}
+
+			const std::filesystem::path parentDir = std::filesystem::path(jsonPath).parent_path();
+			if (!parentDir.empty() && !std::filesystem::exists(parentDir)) {
+				std::filesystem::create_directories(parentDir);
+			}
+
+			File::WriteAllText(jsonPath, Json::Stringify(root, true));
+			return true;
+		}
+		catch (const std::exception& exception) {
+			BT_CORE_ERROR_TAG("BinarySceneSerializer", "ConvertBinaryToJson failed: {}", exception.what());
+			return false;
+		}
+	}
+
+} // namespace Bolt
@@ -0,0 +1,36 @@
+#pragma once
+#include "Core/Export.hpp"
+#include <string>
+
+namespace Bolt {
+
+	class Scene;
+
+	namespace Json {
+		class Value;
+	}
+
+	/// <summary>
+	/// Versioned binary scene format (.bscene), see BinarySceneFormat.hpp for the layout.
+	/// The .scene JSON stays the editable source, binary files are exported next to it
+	/// (e.g. by the build step) and loaded straight from a memory-mapped file without a JSON DOM.
+	/// </summary>
+	class BOLT_API BinarySceneSerializer {
+	public:
+		static bool IsBinaryScenePath(const std::string& path);
+		static std::string GetBinaryPath(const std::string& scenePath);
+		// Info: The .bscene next to scenePath if it exists and is at least as new, otherwise empty
+		static std::string GetUpToDateBinaryPath(const std::string& scenePath);
+
+		// Info: Exports the scene, the dirty flag is left alone since the JSON file was not written
+		static bool SaveToFile(Scene& scene, const std::string& path);
+		static bool LoadFromFile(Scene& scene, const std::string& path);
+
+		// JSON <-> binary conversion on scene data only, no scene, texture or audio is touched
+		static bool WriteFromJson(const Json::Value& root, const std::string& path);
+		static bool ReadToJson(const std::string& path, Json::Value& outRoot);
+		static bool ConvertJsonToBinary(const std::string& jsonPath, const std::string& binaryPath);
+		static bool ConvertBinaryToJson(const std::string& binaryPath, const std::string& jsonPath);
+	};
+
+} // namespace Bolt
@@ -2,31 +2,100 @@
 #include "Serialization/FileWatcher.hpp"
 #include "Core/Log.hpp"
 
-	namespace Bolt {
+#include <algorithm>
+#include <cctype>
+
+#if defined(BT_PLATFORM_LINUX)
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace Bolt {
 
 	namespace {
 		constexpr std::filesystem::directory_options kDirectoryOptions =
 			std::filesystem::directory_options::skip_permission_denied;
+
+		// Info: Native events are held back until the tree was quiet this long, so save bursts arrive as one batch
+		constexpr std::chrono::milliseconds kSettleTime{ 100 };
+
+		bool IsSameOrBelow(std::string_view path, std::string_view directory)
+		{
+			if (path.size() < directory.size() || path.compare(0, directory.size(), directory) != 0)
+				return false;
+			return path.size() == directory.size() || path[directory.size()] == '/' || path[directory.size()] == '\\';
+		}
+
+		bool EqualsIgnoreCase(std::string_view a, std::string_view b)
+		{
+			return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+				return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+			});
+		}
+	}
+
+	FileWatcher::~FileWatcher()
+	{
+		CloseNativeWatch();
 	}
 
 	void FileWatcher::Watch(const std::string& directory, const std::string& extension, Callback callback)
 	{
-		m_Directory = directory;
-		m_Extension = extension;
+		Watch(std::vector<std::string>{ directory }, std::vector<std::string>{ extension }, std::move(callback));
+	}
+
+	void FileWatcher::Watch(const std::vector<std::string>& directories, const std::vector<std::string>& extensions, Callback callback)
+	{
+		Stop();
+
+		for (const std::string& directory : directories)
+		{
+			std::string root = std::filesystem::path(directory).lexically_normal().string();
+			while (root.size() > 1 && (root.back() == '/' || root.back() == '\\'))
+				root.pop_back();
+			if (!root.empty())
+				m_Directories.push_back(std::move(root));
+		}
+
+		for (const std::string& extension : extensions)
+		{
+			std::string ext = extension;
+			std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+			m_Extensions.push_back(std::move(ext));
+		}
+
 		m_Callback = std::move(callback);
 		m_Watching = true;
 		m_LastPollTime = std::chrono::steady_clock::now();
 
-		// Initial scan to populate timestamps
-		ScanFiles();
+		// Native watches go in before the initial scan so nothing created in between is missed
+		const bool native = OpenNativeWatch();
+
+		++m_Generation;
+		for (const std::string& root : m_Directories)
+			ScanDirectory(root, false);
+
+		std::string extensionList;
+		for (const std::string& ext : m_Extensions)
+			extensionList += (extensionList.empty() ? "*" : ", *") + ext;
 
-		BT_CORE_INFO_TAG("FileWatcher", "Watching '{}' for *{} changes", directory, extension);
+		BT_CORE_INFO_TAG("FileWatcher", "Watching '{}'{} for {} changes ({})",
+			m_Directories.empty() ? std::string() : m_Directories.front(),
+			m_Directories.size() > 1 ? " and " + std::to_string(m_Directories.size() - 1) + " more" : std::string(),
+			extensionList.empty() ? "all" : extensionList, native ? "inotify" : "polling");
 	}
 
 	void FileWatcher::Stop()
 	{
+		CloseNativeWatch();
 		m_Watching = false;
-		m_FileTimestamps.clear();
+		m_Directories.clear();
+		m_Extensions.clear();
+		m_Files.clear();
+		m_Pending.clear();
+		m_PendingIndex.clear();
 		m_Callback = nullptr;
 	}
 
@@ -35,88 +104,537 @@
 		if (!m_Watching || !m_Callback) return;
 
 		auto now = std::chrono::steady_clock::now();
-		float elapsed = std::chrono::duration<float>(now - m_LastPollTime).count();
-		if (elapsed < pollIntervalSeconds) return;
-		m_LastPollTime = now;
+		if (m_NotifyFd >= 0)
+		{
+			ReadNativeEvents();
+		}
+		else
+		{
+			float elapsed = std::chrono::duration<float>(now - m_LastPollTime).count();
+			if (elapsed >= pollIntervalSeconds)
+			{
+				m_LastPollTime = now;
+				PollScan();
+			}
+		}
+
+		if (m_Pending.empty())
+			return;
 
-		bool changed = false;
+		// A rescan already covers a whole interval, only native events need to settle
+		if (m_NotifyFd < 0 || std::chrono::steady_clock::now() - m_LastEventTime >= kSettleTime)
+			Flush();
+	}
+
+	bool FileWatcher::MatchesExtension(std::string_view path) const
+	{
+		if (m_Extensions.empty())
+			return true;
 
-		// Check for modified or new files
+		const size_t dot = path.rfind('.');
+		const size_t separator = path.find_last_of("/\\");
+		if (dot == std::string_view::npos || (separator != std::string_view::npos && dot < separator))
+			return false;
+
+		const std::string_view extension = path.substr(dot);
+		for (const std::string& candidate : m_Extensions)
+		{
+			if (EqualsIgnoreCase(extension, candidate))
+				return true;
+		}
+		return false;
+	}
+
+	void FileWatcher::ScanDirectory(const std::filesystem::path& directory, bool reportAdded)
+	{
 		try
 		{
-			for (auto& dirEntry : std::filesystem::recursive_directory_iterator(m_Directory, kDirectoryOptions))
+			for (auto& dirEntry : std::filesystem::recursive_directory_iterator(directory, kDirectoryOptions))
 			{
 				if (!dirEntry.is_regular_file()) continue;
 
-				std::string ext = dirEntry.path().extension().string();
-				std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-				if (ext != m_Extension) continue;
-
 				std::string path = dirEntry.path().string();
-				auto writeTime = dirEntry.last_write_time();
+				if (!MatchesExtension(path)) continue;
 
-				auto it = m_FileTimestamps.find(path);
-				if (it == m_FileTimestamps.end())
-				{
-					// New file
-					m_FileTimestamps[path] = writeTime;
-					changed = true;
-				}
-				else if (it->second != writeTime)
+				if (reportAdded)
 				{
-					// Modified file
-					it->second = writeTime;
-					changed = true;
+					RecordAdded(path);
+					continue;
 				}
+
+				std::error_code ec;
+				m_Files[std::move(path)] = TrackedFile{ dirEntry.last_write_time(ec), m_Generation };
 			}
+		}
+		catch (const std::filesystem::filesystem_error& e)
+		{
+			BT_CORE_WARN_TAG("FileWatcher", "Scan error: {}", e.what());
+		}
+	}
+
+	void FileWatcher::PollScan()
+	{
+		// Info: Files are stamped with the scan generation, anything not stamped by this pass is gone.
+		//       That replaces an exists() call per tracked file.
+		++m_Generation;
 
-			// Check for deleted files
-			for (auto it = m_FileTimestamps.begin(); it != m_FileTimestamps.end(); )
+		try
+		{
+			for (const std::string& root : m_Directories)
 			{
-				if (!std::filesystem::exists(it->first))
+				for (auto& dirEntry : std::filesystem::recursive_directory_iterator(root, kDirectoryOptions))
 				{
-					it = m_FileTimestamps.erase(it);
-					changed = true;
-				}
-				else
-				{
-					++it;
+					if (!dirEntry.is_regular_file()) continue;
+
+					std::string path = dirEntry.path().string();
+					if (!MatchesExtension(path)) continue;
+
+					std::error_code ec;
+					auto writeTime = dirEntry.last_write_time(ec);
+					if (ec) continue;
+
+					auto it = m_Files.find(path);
+					if (it == m_Files.end())
+					{
+						m_Files.emplace(path, TrackedFile{ writeTime, m_Generation });
+						Record(FileChangeType::Added, path);
+						continue;
+					}
+
+					it->second.Generation = m_Generation;
+					if (it->second.WriteTime != writeTime)
+					{
+						it->second.WriteTime = writeTime;
+						Record(FileChangeType::Modified, path);
+					}
 				}
 			}
 		}
 		catch (const std::filesystem::filesystem_error& e)
 		{
+			// A partial pass would report everything after the failure as removed
 			BT_CORE_WARN_TAG("FileWatcher", "Filesystem error: {}", e.what());
+			return;
 		}
 
-		if (changed)
+		for (auto it = m_Files.begin(); it != m_Files.end(); )
 		{
-			BT_CORE_INFO_TAG("FileWatcher", "Changes detected in {}", m_Directory);
-			m_Callback();
+			if (it->second.Generation != m_Generation)
+			{
+				Record(FileChangeType::Removed, it->first);
+				it = m_Files.erase(it);
+			}
+			else
+			{
+				++it;
+			}
 		}
 	}
 
-	void FileWatcher::ScanFiles()
+	void FileWatcher::Flush()
 	{
-		m_FileTimestamps.clear();
+		std::vector<FileChangeEvent> events;
+		events.reserve(m_Pending.size());
+		for (FileChangeEvent& event : m_Pending)
+		{
+			if (!event.Path.empty())
+				events.push_back(std::move(event));
+		}
+		m_Pending.clear();
+		m_PendingIndex.clear();
 
-		try
+		if (events.empty())
+			return;
+
+		BT_CORE_TRACE_TAG("FileWatcher", "{} change(s) detected", events.size());
+
+		// The callback may stop or restart this watcher
+		Callback callback = m_Callback;
+		callback(events);
+	}
+
+	// ── Coalescing ──────────────────────────────────────────────────────
+
+	void FileWatcher::Record(FileChangeType type, const std::string& path, const std::string& oldPath)
+	{
+		m_LastEventTime = std::chrono::steady_clock::now();
+
+		// Info: Tombstoned entries keep an empty path and are skipped by Flush()
+		auto take = [this](const std::string& key, FileChangeEvent& outEvent) {
+			auto it = m_PendingIndex.find(key);
+			if (it == m_PendingIndex.end())
+				return false;
+			outEvent = std::move(m_Pending[it->second]);
+			m_Pending[it->second].Path.clear();
+			m_PendingIndex.erase(it);
+			return true;
+		};
+		auto put = [this](FileChangeType eventType, const std::string& key, std::string previousPath) {
+			auto it = m_PendingIndex.find(key);
+			if (it != m_PendingIndex.end())
+			{
+				m_Pending[it->second].Type = eventType;
+				m_Pending[it->second].OldPath = std::move(previousPath);
+				return;
+			}
+			m_PendingIndex.emplace(key, m_Pending.size());
+			m_Pending.push_back(FileChangeEvent{ eventType, key, std::move(previousPath) });
+		};
+
+		if (type == FileChangeType::Renamed)
 		{
-			for (auto& dirEntry : std::filesystem::recursive_directory_iterator(m_Directory, kDirectoryOptions))
+			// Fold what already happened to the old path into the rename
+			std::string origin = oldPath;
+			FileChangeEvent previous;
+			if (take(oldPath, previous))
 			{
-				if (!dirEntry.is_regular_file()) continue;
+				if (previous.Type == FileChangeType::Added)
+				{
+					put(FileChangeType::Added, path, {});
+					return;
+				}
+				if (previous.Type == FileChangeType::Renamed)
+					origin = std::move(previous.OldPath);
+			}
 
-				std::string ext = dirEntry.path().extension().string();
-				std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-				if (ext != m_Extension) continue;
+			if (origin == path)
+				put(FileChangeType::Modified, path, {});
+			else
+				put(FileChangeType::Renamed, path, std::move(origin));
+			return;
+		}
+
+		auto it = m_PendingIndex.find(path);
+		if (it == m_PendingIndex.end())
+		{
+			put(type, path, {});
+			return;
+		}
 
-				m_FileTimestamps[dirEntry.path().string()] = dirEntry.last_write_time();
+		FileChangeEvent& pending = m_Pending[it->second];
+		switch (type)
+		{
+		case FileChangeType::Added:
+			// Removed and re-created within one batch
+			if (pending.Type == FileChangeType::Removed)
+				pending.Type = FileChangeType::Modified;
+			break;
+		case FileChangeType::Modified:
+			break;
+		case FileChangeType::Removed:
+			if (pending.Type == FileChangeType::Added)
+			{
+				FileChangeEvent dropped;
+				take(path, dropped);
 			}
+			else if (pending.Type == FileChangeType::Renamed)
+			{
+				// Renamed and then deleted, only the original path is gone
+				FileChangeEvent renamed;
+				take(path, renamed);
+				auto originIt = m_PendingIndex.find(renamed.OldPath);
+				if (originIt == m_PendingIndex.end())
+					put(FileChangeType::Removed, renamed.OldPath, {});
+				else if (m_Pending[originIt->second].Type == FileChangeType::Added)
+					m_Pending[originIt->second].Type = FileChangeType::Modified;
+			}
+			else
+			{
+				pending.Type = FileChangeType::Removed;
+			}
+			break;
+		case FileChangeType::Renamed:
+			break;
 		}
-		catch (const std::filesystem::filesystem_error& e)
+	}
+
+	void FileWatcher::RecordAdded(const std::string& path)
+	{
+		// The write time is kept current so a later rescan (overflow or polling fallback) does not report this change again
+		std::error_code ec;
+		const auto writeTime = std::filesystem::last_write_time(path, ec);
+		auto [it, inserted] = m_Files.try_emplace(path, TrackedFile{ writeTime, m_Generation });
+		if (!inserted)
+			it->second.WriteTime = writeTime;
+		Record(inserted ? FileChangeType::Added : FileChangeType::Modified, path);
+	}
+
+	void FileWatcher::RecordRemoved(const std::string& path)
+	{
+		if (m_Files.erase(path) > 0)
+			Record(FileChangeType::Removed, path);
+	}
+
+	void FileWatcher::RecordRemovedBelow(const std::string& directory)
+	{
+		std::vector<std::string> removed;
+		for (const auto& [path, file] : m_Files)
+		{
+			if (IsSameOrBelow(path, directory))
+				removed.push_back(path);
+		}
+		for (const std::string& path : removed)
+			RecordRemoved(path);
+	}
+
+	void FileWatcher::RecordMoved(const std::string& from, const std::string& to)
+	{
+		auto it = m_Files.find(from);
+		const bool tracked = it != m_Files.end();
+		const bool matches = MatchesExtension(to);
+
+		if (tracked && matches)
 		{
-			BT_CORE_WARN_TAG("FileWatcher", "Initial scan error: {}", e.what());
+			TrackedFile file = it->second;
+			m_Files.erase(it);
+			m_Files[to] = file;
+			Record(FileChangeType::Renamed, to, from);
 		}
+		else if (tracked)
+		{
+			RecordRemoved(from);
+		}
+		else if (matches)
+		{
+			RecordAdded(to);
+		}
+	}
+
+	// ── Native notifications ────────────────────────────────────────────
+
+#if defined(BT_PLATFORM_LINUX)
+
+	namespace {
+		constexpr uint32_t kWatchMask = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+	}
+
+	bool FileWatcher::OpenNativeWatch()
+	{
+		m_NotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (m_NotifyFd < 0)
+		{
+			BT_CORE_WARN_TAG("FileWatcher", "inotify unavailable ({}), falling back to polling", std::strerror(errno));
+			return false;
+		}
+
+		for (const std::string& root : m_Directories)
+		{
+			if (!AddNativeWatchRecursive(root))
+			{
+				CloseNativeWatch();
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void FileWatcher::CloseNativeWatch()
+	{
+		if (m_NotifyFd >= 0)
+			close(m_NotifyFd);
+		m_NotifyFd = -1;
+		m_WatchPaths.clear();
+		m_PendingMoves.clear();
+	}
+
+	bool FileWatcher::AddNativeWatchRecursive(const std::filesystem::path& directory)
+	{
+		auto addWatch = [this](const std::string& path) {
+			const int watch = inotify_add_watch(m_NotifyFd, path.c_str(), kWatchMask);
+			if (watch >= 0)
+			{
+				m_WatchPaths[watch] = path;
+				return true;
+			}
+			// A directory that vanished in the meantime is not an error, running out of watches is
+			if (errno == ENOENT || errno == ENOTDIR || errno == EACCES)
+				return true;
+			BT_CORE_WARN_TAG("FileWatcher", "Cannot watch '{}' ({}), falling back to polling", path, std::strerror(errno));
+			return false;
+		};
+
+		if (!addWatch(directory.string()))
+			return false;
+
+		std::error_code ec;
+		for (std::filesystem::recursive_directory_iterator it(directory, kDirectoryOptions, ec), end; !ec && it != end; it.increment(ec))
+		{
+			if (it->is_directory(ec) && !it->is_symlink(ec) && !addWatch(it->path().string()))
+				return false;
+		}
+		return true;
+	}
+
+	void FileWatcher::RemoveNativeWatchesBelow(const std::string& directory)
+	{
+		for (auto it = m_WatchPaths.begin(); it != m_WatchPaths.end(); )
+		{
+			if (IsSameOrBelow(it->second, directory))
+			{
+				inotify_rm_watch(m_NotifyFd, it->first);
+				it = m_WatchPaths.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	void FileWatcher::MoveNativeWatches(const std::string& from, const std::string& to)
+	{
+		for (auto& [watch, path] : m_WatchPaths)
+		{
+			if (IsSameOrBelow(path, from))
+				path = to + path.substr(from.size());
+		}
+	}
+
+	void FileWatcher::ReadNativeEvents()
+	{
+		alignas(inotify_event) char buffer[16 * 1024];
+
+		while (m_NotifyFd >= 0)
+		{
+			const ssize_t length = read(m_NotifyFd, buffer, sizeof(buffer));
+			if (length < 0 && errno == EINTR)
+				continue;
+			if (length <= 0)
+				break;
+
+			for (ssize_t offset = 0; offset < length && m_NotifyFd >= 0; )
+			{
+				inotify_event event;
+				std::memcpy(&event, buffer + offset, sizeof(inotify_event));
+				const char* name = buffer + offset + sizeof(inotify_event);
+				offset += static_cast<ssize_t>(sizeof(inotify_event) + event.len);
+
+				HandleNativeEvent(event.wd, event.mask, event.cookie, event.len > 0 ? std::string_view(name) : std::string_view());
+			}
+		}
+
+		// Info: A move source without a matching target left the watched trees
+		for (auto& [cookie, move] : m_PendingMoves)
+		{
+			if (move.IsDirectory)
+			{
+				RemoveNativeWatchesBelow(move.Path);
+				RecordRemovedBelow(move.Path);
+			}
+			else
+			{
+				RecordRemoved(move.Path);
+			}
+		}
+		m_PendingMoves.clear();
 	}
 
+	void FileWatcher::HandleNativeEvent(int watch, uint32_t mask, uint32_t cookie, std::string_view name)
+	{
+		if (mask & IN_Q_OVERFLOW)
+		{
+			BT_CORE_WARN_TAG("FileWatcher", "Event queue overflowed, rescanning");
+			// Directories created or moved while events were lost have no watch yet, adding an existing one just returns its id
+			m_PendingMoves.clear();
+			for (const std::string& root : m_Directories)
+			{
+				if (!AddNativeWatchRecursive(root))
+				{
+					CloseNativeWatch();
+					break;
+				}
+			}
+			PollScan();
+			return;
+		}
+		if (mask & IN_IGNORED)
+		{
+			m_WatchPaths.erase(watch);
+			return;
+		}
+
+		auto dirIt = m_WatchPaths.find(watch);
+		if (dirIt == m_WatchPaths.end() || name.empty())
+			return;
+
+		std::string path = dirIt->second;
+		path += '/';
+		path += name;
+		const bool isDirectory = (mask & IN_ISDIR) != 0;
+
+		if (mask & IN_MOVED_FROM)
+		{
+			m_PendingMoves[cookie] = PendingMove{ std::move(path), isDirectory };
+			return;
+		}
+
+		if (mask & IN_MOVED_TO)
+		{
+			auto moveIt = m_PendingMoves.find(cookie);
+			if (moveIt != m_PendingMoves.end())
+			{
+				PendingMove from = std::move(moveIt->second);
+				m_PendingMoves.erase(moveIt);
+
+				if (!from.IsDirectory)
+				{
+					RecordMoved(from.Path, path);
+					return;
+				}
+
+				MoveNativeWatches(from.Path, path);
+				std::vector<std::string> moved;
+				for (const auto& [filePath, file] : m_Files)
+				{
+					if (IsSameOrBelow(filePath, from.Path))
+						moved.push_back(filePath);
+				}
+				for (const std::string& filePath : moved)
+					RecordMoved(filePath, path + filePath.substr(from.Path.size()));
+				return;
+			}
+		}
+
+		if (isDirectory)
+		{
+			if (mask & (IN_CREATE | IN_MOVED_TO))
+			{
+				if (!AddNativeWatchRecursive(path))
+				{
+					CloseNativeWatch();
+					return;
+				}
+				// Files may have been written before the watch existed
+				ScanDirectory(path, true);
+			}
+			else if (mask & IN_DELETE)
+			{
+				RecordRemovedBelow(path);
+			}
+			return;
+		}
+
+		if (mask & (IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO))
+		{
+			if (MatchesExtension(path))
+				RecordAdded(path);
+		}
+		else if (mask & IN_DELETE)
+		{
+			RecordRemoved(path);
+		}
+	}
+
+#else
+
+	bool FileWatcher::OpenNativeWatch() { return false; }
+	void FileWatcher::CloseNativeWatch() {}
+	bool FileWatcher::AddNativeWatchRecursive(const std::filesystem::path&) { return false; }
+	void FileWatcher::RemoveNativeWatchesBelow(const std::string&) {}
+	void FileWatcher::MoveNativeWatches(const std::string&, const std::string&) {}
+	void FileWatcher::ReadNativeEvents() {}
+	void FileWatcher::HandleNativeEvent(int, uint32_t, uint32_t, std::string_view) {}
+
+#endif
+
 } // namespace Bolt
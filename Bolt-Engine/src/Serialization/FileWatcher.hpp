@@ -1,49 +1,114 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <filesystem>
 #include <unordered_map>
+#include <vector>
 #include <functional>
 #include <chrono>
+#include <cstdint>
 
 namespace Bolt {
 
+	enum class FileChangeType : uint8_t {
+		Added,
+		Modified,
+		Removed,
+		Renamed
+	};
+
+	struct FileChangeEvent {
+		FileChangeType Type;
+		std::string Path;
+		// Info: Previous path for Renamed, empty otherwise
+		std::string OldPath;
+	};
+
 	/// <summary>
-	/// Polls a directory for file changes at a configurable interval.
-	/// Uses std::filesystem::last_write_time — no platform-specific APIs.
+	/// Watches one or more directory trees for changes to files with the given extensions.
+	/// On Linux changes come from inotify, elsewhere (or when inotify is unavailable) the trees
+	/// are rescanned at the poll interval. Either way the callback receives one coalesced event
+	/// per file, e.g. a file written several times and then deleted within a batch is reported once as Removed.
 	///
 	/// Usage:
 	///   FileWatcher watcher;
-	///   watcher.Watch("path/to/dir", ".cs", [](){ /* rebuild */ });
+	///   watcher.Watch({ "path/to/dir" }, { ".cs" }, [](const std::vector<FileChangeEvent>& events) { /* rebuild */ });
 	///   // In update loop:
 	///   watcher.Poll();
 	/// </summary>
 	class FileWatcher {
 	public:
-		using Callback = std::function<void()>;
+		using Callback = std::function<void(const std::vector<FileChangeEvent>&)>;
+
+		FileWatcher() = default;
+		FileWatcher(const FileWatcher&) = delete;
+		FileWatcher& operator=(const FileWatcher&) = delete;
+		~FileWatcher();
 
-		/// Start watching a directory for files matching the given extension.
-		/// callback is invoked when any matching file is created, modified, or deleted.
+		/// Start watching the directories for files matching any of the extensions (case insensitive, with dot).
+		/// An empty extension list matches every file. Replaces any previous watch.
+		void Watch(const std::vector<std::string>& directories, const std::vector<std::string>& extensions, Callback callback);
 		void Watch(const std::string& directory, const std::string& extension, Callback callback);
 
 		/// Stop watching.
 		void Stop();
 
-		/// Check for changes. Call this periodically (e.g. once per frame).
-		/// Internally throttled to pollIntervalMs.
+		/// Deliver pending changes. Call this periodically (e.g. once per frame).
+		/// Native notifications are drained on every call, the rescan fallback is throttled to pollIntervalSeconds.
 		void Poll(float pollIntervalSeconds = 1.0f);
 
 		bool IsWatching() const { return m_Watching; }
+		bool IsUsingNativeNotifications() const { return m_NotifyFd >= 0; }
 
 	private:
-		void ScanFiles();
+		bool MatchesExtension(std::string_view path) const;
+		void ScanDirectory(const std::filesystem::path& directory, bool reportAdded);
+		void PollScan();
+		void Flush();
+
+		void Record(FileChangeType type, const std::string& path, const std::string& oldPath = {});
+		void RecordAdded(const std::string& path);
+		void RecordRemoved(const std::string& path);
+		void RecordMoved(const std::string& from, const std::string& to);
+		void RecordRemovedBelow(const std::string& directory);
 
-		std::string m_Directory;
-		std::string m_Extension;
+		bool OpenNativeWatch();
+		void CloseNativeWatch();
+		bool AddNativeWatchRecursive(const std::filesystem::path& directory);
+		void RemoveNativeWatchesBelow(const std::string& directory);
+		void MoveNativeWatches(const std::string& from, const std::string& to);
+		void ReadNativeEvents();
+		void HandleNativeEvent(int watch, uint32_t mask, uint32_t cookie, std::string_view name);
+
+		struct TrackedFile {
+			std::filesystem::file_time_type WriteTime;
+			// Info: Scan generation, files not seen by the latest rescan were removed
+			uint32_t Generation;
+		};
+
+		struct PendingMove {
+			std::string Path;
+			bool IsDirectory;
+		};
+
+		std::vector<std::string> m_Directories;
+		std::vector<std::string> m_Extensions;
 		Callback m_Callback;
 		bool m_Watching = false;
 
-		// Tracked files: path -> last_write_time
-		std::unordered_map<std::string, std::filesystem::file_time_type> m_FileTimestamps;
+		// Tracked files with their last seen write time
+		std::unordered_map<std::string, TrackedFile> m_Files;
+		uint32_t m_Generation = 0;
+
+		// Pending coalesced changes in first-seen order
+		std::vector<FileChangeEvent> m_Pending;
+		std::unordered_map<std::string, size_t> m_PendingIndex;
+		std::chrono::steady_clock::time_point m_LastEventTime;
+
+		// inotify state, m_NotifyFd is -1 when the rescan fallback is used
+		int m_NotifyFd = -1;
+		std::unordered_map<int, std::string> m_WatchPaths;
+		std::unordered_map<uint32_t, PendingMove> m_PendingMoves;
 
 		// Throttle polling
 		std::chrono::steady_clock::time_point m_LastPollTime;
@@ -3,381 +3,40 @@
 
 #include <cctype>
 #include <cstdlib>
+#include <cstring>
 #include <charconv>
 #include <cmath>
+#include <functional>
 #include <limits>
 #include <sstream>
+#include <utility>
 
 namespace Bolt::Json {
 
 	namespace {
-		class Parser {
-		public:
-			explicit Parser(std::string_view text)
-				: m_Text(text) {
-			}
-
-			bool ParseValue(Value& outValue, std::string* outError) {
-				SkipWhitespace();
-				if (!ParseAny(outValue, outError)) {
-					return false;
-				}
-
-				SkipWhitespace();
-				if (!IsAtEnd()) {
-					SetError(outError, "Unexpected trailing characters");
-					return false;
-				}
+		// Info: Objects up to this size are scanned linearly, bigger ones keep an open addressing index
+		static constexpr size_t k_HashedLookupThreshold = 16;
 
-				return true;
+		void AppendUtf8(std::string& out, uint32_t codePoint) {
+			if (codePoint <= 0x7F) {
+				out.push_back(static_cast<char>(codePoint));
 			}
-
-		private:
-			bool ParseAny(Value& outValue, std::string* outError) {
-				SkipWhitespace();
-				if (IsAtEnd()) {
-					SetError(outError, "Unexpected end of JSON input");
-					return false;
-				}
-
-				switch (Peek()) {
-				case 'n':
-					return ParseLiteral("null", Value(), outValue, outError);
-				case 't':
-					return ParseLiteral("true", Value(true), outValue, outError);
-				case 'f':
-					return ParseLiteral("false", Value(false), outValue, outError);
-				case '"':
-					return ParseStringValue(outValue, outError);
-				case '{':
-					return ParseObject(outValue, outError);
-				case '[':
-					return ParseArray(outValue, outError);
-				default:
-					if (Peek() == '-' || std::isdigit(static_cast<unsigned char>(Peek()))) {
-						return ParseNumber(outValue, outError);
-					}
-
-					SetError(outError, "Unexpected token while parsing JSON");
-					return false;
-				}
+			else if (codePoint <= 0x7FF) {
+				out.push_back(static_cast<char>(0xC0 | ((codePoint >> 6) & 0x1F)));
+				out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
 			}
-
-			bool ParseLiteral(std::string_view literal, Value literalValue, Value& outValue, std::string* outError) {
-				if (m_Text.substr(m_Position, literal.size()) != literal) {
-					SetError(outError, "Invalid JSON literal");
-					return false;
-				}
-
-				m_Position += literal.size();
-				outValue = std::move(literalValue);
-				return true;
+			else if (codePoint <= 0xFFFF) {
+				out.push_back(static_cast<char>(0xE0 | ((codePoint >> 12) & 0x0F)));
+				out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
 			}
-
-			bool ParseStringValue(Value& outValue, std::string* outError) {
-				std::string parsed;
-				if (!ParseString(parsed, outError)) {
-					return false;
-				}
-
-				outValue = Value(std::move(parsed));
-				return true;
+			else {
+				out.push_back(static_cast<char>(0xF0 | ((codePoint >> 18) & 0x07)));
+				out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
 			}
-
-			bool ParseString(std::string& outValue, std::string* outError) {
-				if (!Consume('"')) {
-					SetError(outError, "Expected opening quote");
-					return false;
-				}
-
-				std::string result;
-				while (!IsAtEnd()) {
-					char ch = Advance();
-					if (ch == '"') {
-						outValue = std::move(result);
-						return true;
-					}
-
-					if (ch != '\\') {
-						result.push_back(ch);
-						continue;
-					}
-
-					if (IsAtEnd()) {
-						SetError(outError, "Invalid escape sequence");
-						return false;
-					}
-
-					char escaped = Advance();
-					switch (escaped) {
-					case '"': result.push_back('"'); break;
-					case '\\': result.push_back('\\'); break;
-					case '/': result.push_back('/'); break;
-					case 'b': result.push_back('\b'); break;
-					case 'f': result.push_back('\f'); break;
-					case 'n': result.push_back('\n'); break;
-					case 'r': result.push_back('\r'); break;
-					case 't': result.push_back('\t'); break;
-					case 'u':
-					{
-						uint32_t codePoint = 0;
-						if (!ParseUnicodeEscape(codePoint, outError)) {
-							return false;
-						}
-						AppendUtf8(result, codePoint);
-						break;
-					}
-					default:
-						SetError(outError, "Unsupported escape sequence");
-						return false;
-					}
-				}
-
-				SetError(outError, "Unterminated JSON string");
-				return false;
-			}
-
-			bool ParseUnicodeEscape(uint32_t& outCodePoint, std::string* outError) {
-				if (m_Position + 4 > m_Text.size()) {
-					SetError(outError, "Incomplete unicode escape");
-					return false;
-				}
-
-				uint32_t codePoint = 0;
-				for (int i = 0; i < 4; i++) {
-					char digit = m_Text[m_Position++];
-					codePoint <<= 4;
-					if (digit >= '0' && digit <= '9') {
-						codePoint |= static_cast<uint32_t>(digit - '0');
-					}
-					else if (digit >= 'a' && digit <= 'f') {
-						codePoint |= static_cast<uint32_t>(digit - 'a' + 10);
-					}
-					else if (digit >= 'A' && digit <= 'F') {
-						codePoint |= static_cast<uint32_t>(digit - 'A' + 10);
-					}
-					else {
-						SetError(outError, "Invalid unicode escape");
-						return false;
-					}
-				}
-
-				outCodePoint = codePoint;
-				return true;
-			}
-
-			static void AppendUtf8(std::string& out, uint32_t codePoint) {
-				if (codePoint <= 0x7F) {
-					out.push_back(static_cast<char>(codePoint));
-				}
-				else if (codePoint <= 0x7FF) {
-					out.push_back(static_cast<char>(0xC0 | ((codePoint >> 6) & 0x1F)));
-					out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
-				}
-				else if (codePoint <= 0xFFFF) {
-					out.push_back(static_cast<char>(0xE0 | ((codePoint >> 12) & 0x0F)));
-					out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
-					out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
-				}
-				else {
-					out.push_back(static_cast<char>(0xF0 | ((codePoint >> 18) & 0x07)));
-					out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
-					out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
-					out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
-				}
-			}
-
-			bool ParseNumber(Value& outValue, std::string* outError) {
-				const size_t start = m_Position;
-
-				if (Peek() == '-') {
-					Advance();
-				}
-
-				if (IsAtEnd()) {
-					SetError(outError, "Invalid JSON number");
-					return false;
-				}
-
-				if (Peek() == '0') {
-					Advance();
-				}
-				else if (std::isdigit(static_cast<unsigned char>(Peek()))) {
-					while (!IsAtEnd() && std::isdigit(static_cast<unsigned char>(Peek()))) {
-						Advance();
-					}
-				}
-				else {
-					SetError(outError, "Invalid JSON number");
-					return false;
-				}
-
-				if (!IsAtEnd() && Peek() == '.') {
-					Advance();
-					if (IsAtEnd() || !std::isdigit(static_cast<unsigned char>(Peek()))) {
-						SetError(outError, "Invalid JSON number fraction");
-						return false;
-					}
-					while (!IsAtEnd() && std::isdigit(static_cast<unsigned char>(Peek()))) {
-						Advance();
-					}
-				}
-
-				if (!IsAtEnd() && (Peek() == 'e' || Peek() == 'E')) {
-					Advance();
-					if (!IsAtEnd() && (Peek() == '+' || Peek() == '-')) {
-						Advance();
-					}
-					if (IsAtEnd() || !std::isdigit(static_cast<unsigned char>(Peek()))) {
-						SetError(outError, "Invalid JSON exponent");
-						return false;
-					}
-					while (!IsAtEnd() && std::isdigit(static_cast<unsigned char>(Peek()))) {
-						Advance();
-					}
-				}
-
-				const std::string numericText(m_Text.substr(start, m_Position - start));
-				char* endPtr = nullptr;
-				const double parsed = std::strtod(numericText.c_str(), &endPtr);
-				if (endPtr != numericText.c_str() + numericText.size()) {
-					SetError(outError, "Failed to parse JSON number");
-					return false;
-				}
-
-				outValue = Value(parsed);
-				return true;
-			}
-
-			bool ParseObject(Value& outValue, std::string* outError) {
-				if (!Consume('{')) {
-					SetError(outError, "Expected object start");
-					return false;
-				}
-
-				Value objectValue = Value::MakeObject();
-				SkipWhitespace();
-				if (Consume('}')) {
-					outValue = std::move(objectValue);
-					return true;
-				}
-
-				while (!IsAtEnd()) {
-					std::string key;
-					if (!ParseString(key, outError)) {
-						return false;
-					}
-
-					SkipWhitespace();
-					if (!Consume(':')) {
-						SetError(outError, "Expected ':' after object key");
-						return false;
-					}
-
-					Value childValue;
-					if (!ParseAny(childValue, outError)) {
-						return false;
-					}
-
-					objectValue.AddMember(std::move(key), std::move(childValue));
-
-					SkipWhitespace();
-					if (Consume('}')) {
-						outValue = std::move(objectValue);
-						return true;
-					}
-
-					if (!Consume(',')) {
-						SetError(outError, "Expected ',' between object members");
-						return false;
-					}
-
-					SkipWhitespace();
-				}
-
-				SetError(outError, "Unterminated JSON object");
-				return false;
-			}
-
-			bool ParseArray(Value& outValue, std::string* outError) {
-				if (!Consume('[')) {
-					SetError(outError, "Expected array start");
-					return false;
-				}
-
-				Value arrayValue = Value::MakeArray();
-				SkipWhitespace();
-				if (Consume(']')) {
-					outValue = std::move(arrayValue);
-					return true;
-				}
-
-				while (!IsAtEnd()) {
-					Value childValue;
-					if (!ParseAny(childValue, outError)) {
-						return false;
-					}
-
-					arrayValue.Append(std::move(childValue));
-
-					SkipWhitespace();
-					if (Consume(']')) {
-						outValue = std::move(arrayValue);
-						return true;
-					}
-
-					if (!Consume(',')) {
-						SetError(outError, "Expected ',' between array items");
-						return false;
-					}
-
-					SkipWhitespace();
-				}
-
-				SetError(outError, "Unterminated JSON array");
-				return false;
-			}
-
-			void SkipWhitespace() {
-				while (!IsAtEnd() && std::isspace(static_cast<unsigned char>(m_Text[m_Position]))) {
-					m_Position++;
-				}
-			}
-
-			bool IsAtEnd() const {
-				return m_Position >= m_Text.size();
-			}
-
-			char Peek() const {
-				return IsAtEnd() ? '\0' : m_Text[m_Position];
-			}
-
-			char Advance() {
-				return IsAtEnd() ? '\0' : m_Text[m_Position++];
-			}
-
-			bool Consume(char expected) {
-				if (Peek() != expected) {
-					return false;
-				}
-				m_Position++;
-				return true;
-			}
-
-			void SetError(std::string* outError, std::string_view message) const {
-				if (!outError) {
-					return;
-				}
-
-				std::ostringstream stream;
-				stream << message << " at byte " << m_Position;
-				*outError = stream.str();
-			}
-
-		private:
-			std::string_view m_Text;
-			size_t m_Position = 0;
-		};
+		}
 
 		void WriteIndent(std::string& out, int depth, int indentSize) {
 			out.append(static_cast<size_t>(depth * indentSize), ' ');
@@ -401,7 +60,7 @@ namespace Bolt::Json {
 			}
 			case Value::Type::String:
 				out += '"';
-				out += EscapeString(value.AsStringOr());
+				out += EscapeString(value.AsStringView());
 				out += '"';
 				break;
 			case Value::Type::Object:
@@ -470,17 +129,76 @@ namespace Bolt::Json {
 		}
 	} // namespace
 
+	// ── Value ───────────────────────────────────────────────────────────
+
+	struct Value::ObjectStorage {
+		Object Members;
+		// Info: Member index + 1 per slot (0 = empty), power of two sized, empty while not built
+		std::vector<uint32_t> Buckets;
+
+		const Value* Find(std::string_view key) const {
+			if (Buckets.empty()) {
+				for (const auto& [memberKey, memberValue] : Members) {
+					if (memberKey == key) {
+						return &memberValue;
+					}
+				}
+				return nullptr;
+			}
+
+			const size_t mask = Buckets.size() - 1;
+			for (size_t slot = std::hash<std::string_view>{}(key) & mask; Buckets[slot] != 0; slot = (slot + 1) & mask) {
+				const auto& member = Members[Buckets[slot] - 1];
+				if (member.first == key) {
+					return &member.second;
+				}
+			}
+			return nullptr;
+		}
+
+		void Insert(uint32_t memberIndex) {
+			const size_t mask = Buckets.size() - 1;
+			size_t slot = std::hash<std::string_view>{}(Members[memberIndex].first) & mask;
+			while (Buckets[slot] != 0) {
+				slot = (slot + 1) & mask;
+			}
+			Buckets[slot] = memberIndex + 1;
+		}
+
+		// Info: Keeps the load factor at or below one half, builds the index once the object grows past the threshold
+		void UpdateIndex() {
+			if (Members.size() < k_HashedLookupThreshold) {
+				return;
+			}
+
+			if (!Buckets.empty() && Members.size() * 2 <= Buckets.size()) {
+				Insert(static_cast<uint32_t>(Members.size() - 1));
+				return;
+			}
+
+			size_t bucketCount = 32;
+			while (bucketCount < Members.size() * 2) {
+				bucketCount *= 2;
+			}
+
+			Buckets.assign(bucketCount, 0);
+			for (uint32_t i = 0; i < Members.size(); i++) {
+				Insert(i);
+			}
+		}
+	};
+
 	Value::Value(std::nullptr_t) {
 	}
 
 	Value::Value(bool value)
-		: m_Type(Type::Bool)
-		, m_Bool(value) {
+		: m_Type(Type::Bool) {
+		m_Storage.Bool = value;
 	}
 
 	Value::Value(double value)
-		: m_Type(Type::Number)
-		, m_Number(value) {
+		: m_Type(Type::Number) {
+		m_Storage.Number = value;
 	}
 
 	Value::Value(int value)
@@ -488,22 +206,53 @@ namespace Bolt::Json {
 	}
 
 	Value::Value(int64_t value)
-		: m_Type(Type::Number)
-		, m_Number(static_cast<double>(value)) {
+		: Value(static_cast<double>(value)) {
 	}
 
 	Value::Value(uint64_t value)
-		: m_Type(Type::Number)
-		, m_Number(static_cast<double>(value)) {
+		: Value(static_cast<double>(value)) {
 	}
 
 	Value::Value(const char* value)
-		: Value(value ? std::string(value) : std::string()) {
+		: Value(value ? std::string_view(value) : std::string_view()) {
 	}
 
-	Value::Value(std::string value)
-		: m_Type(Type::String)
-		, m_String(std::move(value)) {
+	Value::Value(std::string_view value) {
+		AssignString(value);
+	}
+
+	Value::Value(const std::string& value)
+		: Value(std::string_view(value)) {
+	}
+
+	Value::Value(const Value& other) {
+		CopyFrom(other);
+	}
+
+	Value::Value(Value&& other) noexcept {
+		MoveFrom(other);
+	}
+
+	Value& Value::operator=(const Value& other) {
+		if (this != &other) {
+			// Copy first, other may live inside this value
+			Value copy(other);
+			Release();
+			MoveFrom(copy);
+		}
+		return *this;
+	}
+
+	Value& Value::operator=(Value&& other) noexcept {
+		if (this != &other) {
+			Release();
+			MoveFrom(other);
+		}
+		return *this;
+	}
+
+	Value::~Value() {
+		Release();
 	}
 
 	Value Value::MakeObject() {
@@ -519,11 +268,11 @@ namespace Bolt::Json {
 	}
 
 	bool Value::AsBoolOr(bool fallback) const {
-		return IsBool() ? m_Bool : fallback;
+		return IsBool() ? m_Storage.Bool : fallback;
 	}
 
 	double Value::AsDoubleOr(double fallback) const {
-		return IsNumber() ? m_Number : fallback;
+		return IsNumber() ? m_Storage.Number : fallback;
 	}
 
 	int Value::AsIntOr(int fallback) const {
@@ -531,12 +280,13 @@ namespace Bolt::Json {
 			return fallback;
 		}
 
-		if (m_Number < static_cast<double>(std::numeric_limits<int>::min()) ||
-			m_Number > static_cast<double>(std::numeric_limits<int>::max())) {
+		const double number = m_Storage.Number;
+		if (number < static_cast<double>(std::numeric_limits<int>::min()) ||
+			number > static_cast<double>(std::numeric_limits<int>::max())) {
 			return fallback;
 		}
 
-		return static_cast<int>(m_Number);
+		return static_cast<int>(number);
 	}
 
 	int64_t Value::AsInt64Or(int64_t fallback) const {
@@ -544,110 +294,545 @@ namespace Bolt::Json {
 			return fallback;
 		}
 
-		if (m_Number < static_cast<double>(std::numeric_limits<int64_t>::min()) ||
-			m_Number > static_cast<double>(std::numeric_limits<int64_t>::max())) {
+		const double number = m_Storage.Number;
+		if (number < static_cast<double>(std::numeric_limits<int64_t>::min()) ||
+			number > static_cast<double>(std::numeric_limits<int64_t>::max())) {
 			return fallback;
 		}
 
-		return static_cast<int64_t>(m_Number);
+		return static_cast<int64_t>(number);
 	}
 
 	uint64_t Value::AsUInt64Or(uint64_t fallback) const {
-		if (!IsNumber() || m_Number < 0.0 ||
-			m_Number > static_cast<double>(std::numeric_limits<uint64_t>::max())) {
+		const double number = IsNumber() ? m_Storage.Number : -1.0;
+		if (number < 0.0 || number > static_cast<double>(std::numeric_limits<uint64_t>::max())) {
 			return fallback;
 		}
 
-		return static_cast<uint64_t>(m_Number);
+		return static_cast<uint64_t>(number);
 	}
 
 	std::string Value::AsStringOr(std::string fallback) const {
-		return IsString() ? m_String : std::move(fallback);
+		return IsString() ? std::string(AsStringView()) : std::move(fallback);
+	}
+
+	std::string_view Value::AsStringView() const {
+		if (!IsString()) {
+			return {};
+		}
+		if (m_StringSize == k_HeapString) {
+			return std::string_view(m_Storage.Heap.Data, m_Storage.Heap.Size);
+		}
+		return std::string_view(m_Storage.Inline, m_StringSize);
 	}
 
 	Value::Object& Value::GetObject() {
-		SetType(Type::Object);
-		return m_Object;
+		ObjectStorage& storage = EnsureObjectStorage();
+		// The caller may rename or reorder members through this reference
+		storage.Buckets.clear();
+		return storage.Members;
 	}
 
 	const Value::Object& Value::GetObject() const {
 		static const Object emptyObject;
-		return IsObject() ? m_Object : emptyObject;
+		return IsObject() && m_Storage.Members ? m_Storage.Members->Members : emptyObject;
 	}
 
 	Value::Array& Value::GetArray() {
 		SetType(Type::Array);
-		return m_Array;
+		if (!m_Storage.Items) {
+			m_Storage.Items = new Array();
+		}
+		return *m_Storage.Items;
 	}
 
 	const Value::Array& Value::GetArray() const {
 		static const Array emptyArray;
-		return IsArray() ? m_Array : emptyArray;
+		return IsArray() && m_Storage.Items ? *m_Storage.Items : emptyArray;
 	}
 
 	Value* Value::FindMember(std::string_view key) {
-		if (!IsObject()) {
+		return const_cast<Value*>(std::as_const(*this).FindMember(key));
+	}
+
+	const Value* Value::FindMember(std::string_view key) const {
+		if (!IsObject() || !m_Storage.Members) {
 			return nullptr;
 		}
+		return m_Storage.Members->Find(key);
+	}
 
-		for (auto& [memberKey, memberValue] : m_Object) {
-			if (memberKey == key) {
-				return &memberValue;
-			}
+	Value& Value::AddMember(std::string key, Value value) {
+		ObjectStorage& storage = EnsureObjectStorage();
+		if (Value* existing = const_cast<Value*>(storage.Find(key))) {
+			*existing = std::move(value);
+			return *existing;
 		}
 
-		return nullptr;
+		storage.Members.emplace_back(std::move(key), std::move(value));
+		storage.UpdateIndex();
+		return storage.Members.back().second;
 	}
 
-	const Value* Value::FindMember(std::string_view key) const {
-		if (!IsObject()) {
-			return nullptr;
+	Value& Value::Append(Value value) {
+		return GetArray().emplace_back(std::move(value));
+	}
+
+	void Value::SetType(Type type) {
+		if (m_Type == type) {
+			return;
 		}
 
-		for (const auto& [memberKey, memberValue] : m_Object) {
-			if (memberKey == key) {
-				return &memberValue;
+		Release();
+		m_Type = type;
+	}
+
+	void Value::AssignString(std::string_view value) {
+		m_Type = Type::String;
+		if (value.size() <= k_InlineStringCapacity) {
+			if (!value.empty()) {
+				std::memcpy(m_Storage.Inline, value.data(), value.size());
 			}
+			m_StringSize = static_cast<uint8_t>(value.size());
+			return;
 		}
 
-		return nullptr;
+		m_Storage.Heap.Data = new char[value.size()];
+		std::memcpy(m_Storage.Heap.Data, value.data(), value.size());
+		m_Storage.Heap.Size = value.size();
+		m_StringSize = k_HeapString;
 	}
 
-	Value& Value::AddMember(std::string key, Value value) {
+	void Value::Release() {
+		switch (m_Type) {
+		case Type::String:
+			if (m_StringSize == k_HeapString) {
+				delete[] m_Storage.Heap.Data;
+			}
+			break;
+		case Type::Object:
+			delete m_Storage.Members;
+			break;
+		case Type::Array:
+			delete m_Storage.Items;
+			break;
+		default:
+			break;
+		}
+
+		m_Storage = Storage{};
+		m_Type = Type::Null;
+		m_StringSize = 0;
+	}
+
+	void Value::CopyFrom(const Value& other) {
+		switch (other.m_Type) {
+		case Type::String:
+			AssignString(other.AsStringView());
+			return;
+		case Type::Object:
+			m_Type = Type::Object;
+			m_Storage.Members = other.m_Storage.Members ? new ObjectStorage(*other.m_Storage.Members) : nullptr;
+			return;
+		case Type::Array:
+			m_Type = Type::Array;
+			m_Storage.Items = other.m_Storage.Items ? new Array(*other.m_Storage.Items) : nullptr;
+			return;
+		default:
+			m_Storage = other.m_Storage;
+			m_Type = other.m_Type;
+			return;
+		}
+	}
+
+	void Value::MoveFrom(Value& other) {
+		m_Storage = other.m_Storage;
+		m_Type = other.m_Type;
+		m_StringSize = other.m_StringSize;
+
+		other.m_Storage = Storage{};
+		other.m_Type = Type::Null;
+		other.m_StringSize = 0;
+	}
+
+	Value::ObjectStorage& Value::EnsureObjectStorage() {
 		SetType(Type::Object);
-		for (auto& [memberKey, memberValue] : m_Object) {
-			if (memberKey == key) {
-				memberValue = std::move(value);
-				return memberValue;
+		if (!m_Storage.Members) {
+			m_Storage.Members = new ObjectStorage();
+		}
+		return *m_Storage.Members;
+	}
+
+	// ── Reader ──────────────────────────────────────────────────────────
+
+	Reader::Reader(std::string_view text)
+		: m_Text(text) {
+	}
+
+	Token Reader::Next() {
+		if (m_Token == Token::Error || m_Token == Token::EndOfInput) {
+			return m_Token;
+		}
+
+		SkipWhitespace();
+
+		if (m_Stack.empty()) {
+			if (!m_RootDone) {
+				return m_Token = ParseValueStart();
 			}
+			if (!IsAtEnd()) {
+				return Fail("Unexpected trailing characters");
+			}
+			return m_Token = Token::EndOfInput;
+		}
+
+		Frame& frame = m_Stack.back();
+		if (frame.IsObject && frame.ExpectValue) {
+			frame.ExpectValue = false;
+			return m_Token = ParseValueStart();
 		}
 
-		m_Object.emplace_back(std::move(key), std::move(value));
-		return m_Object.back().second;
+		if (IsAtEnd()) {
+			return Fail(frame.IsObject ? "Unterminated JSON object" : "Unterminated JSON array");
+		}
+
+		if (Peek() == (frame.IsObject ? '}' : ']')) {
+			m_Position++;
+			return CloseContainer(frame.IsObject ? Token::EndObject : Token::EndArray);
+		}
+
+		if (frame.HasItems) {
+			if (Peek() != ',') {
+				return Fail(frame.IsObject ? "Expected ',' between object members" : "Expected ',' between array items");
+			}
+			m_Position++;
+			SkipWhitespace();
+		}
+		frame.HasItems = true;
+
+		if (!frame.IsObject) {
+			return m_Token = ParseValueStart();
+		}
+
+		if (!ParseString()) {
+			return m_Token;
+		}
+
+		SkipWhitespace();
+		if (Peek() != ':') {
+			return Fail("Expected ':' after object key");
+		}
+		m_Position++;
+		frame.ExpectValue = true;
+		return m_Token = Token::Key;
 	}
 
-	Value& Value::Append(Value value) {
-		SetType(Type::Array);
-		m_Array.emplace_back(std::move(value));
-		return m_Array.back();
+	bool Reader::SkipValue() {
+		if (m_Token != Token::BeginObject && m_Token != Token::BeginArray) {
+			return m_Token != Token::Error && m_Token != Token::None && m_Token != Token::EndOfInput;
+		}
+
+		const size_t depth = m_Stack.size();
+		while (m_Stack.size() >= depth) {
+			if (Next() == Token::Error) {
+				return false;
+			}
+		}
+		return true;
 	}
 
-	void Value::SetType(Type type) {
-		if (m_Type == type) {
-			return;
+	bool Reader::ReadValue(Value& outValue) {
+		switch (m_Token) {
+		case Token::BeginObject:
+		{
+			Value objectValue = Value::MakeObject();
+			while (Next() == Token::Key) {
+				std::string key(m_String);
+				Next();
+				Value childValue;
+				if (!ReadValue(childValue)) {
+					return false;
+				}
+				objectValue.AddMember(std::move(key), std::move(childValue));
+			}
+
+			if (m_Token != Token::EndObject) {
+				return false;
+			}
+			outValue = std::move(objectValue);
+			return true;
 		}
+		case Token::BeginArray:
+		{
+			Value arrayValue = Value::MakeArray();
+			while (Next() != Token::EndArray) {
+				Value childValue;
+				if (!ReadValue(childValue)) {
+					return false;
+				}
+				arrayValue.Append(std::move(childValue));
+			}
 
-		m_Type = type;
-		m_Bool = false;
-		m_Number = 0.0;
-		m_String.clear();
-		m_Object.clear();
-		m_Array.clear();
+			outValue = std::move(arrayValue);
+			return true;
+		}
+		case Token::String:
+			outValue = Value(m_String);
+			return true;
+		case Token::Number:
+			outValue = Value(m_Number);
+			return true;
+		case Token::Bool:
+			outValue = Value(m_Bool);
+			return true;
+		case Token::Null:
+			outValue = Value();
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	Token Reader::ParseValueStart() {
+		if (IsAtEnd()) {
+			return Fail("Unexpected end of JSON input");
+		}
+
+		switch (Peek()) {
+		case '{':
+			m_Position++;
+			m_Stack.push_back({ true, false, false });
+			return Token::BeginObject;
+		case '[':
+			m_Position++;
+			m_Stack.push_back({ false, false, false });
+			return Token::BeginArray;
+		case '"':
+			if (!ParseString()) {
+				return m_Token;
+			}
+			m_RootDone = m_Stack.empty();
+			return Token::String;
+		case 'n':
+			return ParseLiteral("null", Token::Null, false);
+		case 't':
+			return ParseLiteral("true", Token::Bool, true);
+		case 'f':
+			return ParseLiteral("false", Token::Bool, false);
+		default:
+			if (Peek() == '-' || std::isdigit(static_cast<unsigned char>(Peek()))) {
+				return ParseNumber();
+			}
+			return Fail("Unexpected token while parsing JSON");
+		}
+	}
+
+	Token Reader::ParseLiteral(std::string_view literal, Token token, bool value) {
+		if (m_Text.substr(m_Position, literal.size()) != literal) {
+			return Fail("Invalid JSON literal");
+		}
+
+		m_Position += literal.size();
+		m_Bool = value;
+		m_RootDone = m_Stack.empty();
+		return token;
+	}
+
+	Token Reader::ParseNumber() {
+		const size_t start = m_Position;
+		auto isDigit = [this]() { return !IsAtEnd() && std::isdigit(static_cast<unsigned char>(Peek())); };
+
+		if (Peek() == '-') {
+			m_Position++;
+		}
+
+		if (IsAtEnd()) {
+			return Fail("Invalid JSON number");
+		}
+
+		if (Peek() == '0') {
+			m_Position++;
+		}
+		else if (isDigit()) {
+			while (isDigit()) {
+				m_Position++;
+			}
+		}
+		else {
+			return Fail("Invalid JSON number");
+		}
+
+		if (Peek() == '.') {
+			m_Position++;
+			if (!isDigit()) {
+				return Fail("Invalid JSON number fraction");
+			}
+			while (isDigit()) {
+				m_Position++;
+			}
+		}
+
+		if (Peek() == 'e' || Peek() == 'E') {
+			m_Position++;
+			if (Peek() == '+' || Peek() == '-') {
+				m_Position++;
+			}
+			if (!isDigit()) {
+				return Fail("Invalid JSON exponent");
+			}
+			while (isDigit()) {
+				m_Position++;
+			}
+		}
+
+		const char* first = m_Text.data() + start;
+		const char* last = m_Text.data() + m_Position;
+		const auto [end, error] = std::from_chars(first, last, m_Number);
+		if (error == std::errc::result_out_of_range) {
+			// from_chars leaves the value untouched here, strtod saturates like the DOM parser always did
+			m_Number = std::strtod(std::string(first, last).c_str(), nullptr);
+		}
+		else if (error != std::errc() || end != last) {
+			return Fail("Failed to parse JSON number");
+		}
+
+		m_RootDone = m_Stack.empty();
+		return Token::Number;
+	}
+
+	bool Reader::ParseString() {
+		if (Peek() != '"') {
+			Fail("Expected opening quote");
+			return false;
+		}
+		m_Position++;
+
+		// Fast path: no escapes, the view points into the input
+		const size_t start = m_Position;
+		while (!IsAtEnd() && Peek() != '"' && Peek() != '\\') {
+			m_Position++;
+		}
+
+		if (IsAtEnd()) {
+			Fail("Unterminated JSON string");
+			return false;
+		}
+
+		if (Peek() == '"') {
+			m_String = m_Text.substr(start, m_Position - start);
+			m_Position++;
+			return true;
+		}
+
+		m_Scratch.assign(m_Text.substr(start, m_Position - start));
+		while (!IsAtEnd()) {
+			const char ch = m_Text[m_Position++];
+			if (ch == '"') {
+				m_String = m_Scratch;
+				return true;
+			}
+
+			if (ch != '\\') {
+				m_Scratch.push_back(ch);
+				continue;
+			}
+
+			if (IsAtEnd()) {
+				Fail("Invalid escape sequence");
+				return false;
+			}
+
+			const char escaped = m_Text[m_Position++];
+			switch (escaped) {
+			case '"': m_Scratch.push_back('"'); break;
+			case '\\': m_Scratch.push_back('\\'); break;
+			case '/': m_Scratch.push_back('/'); break;
+			case 'b': m_Scratch.push_back('\b'); break;
+			case 'f': m_Scratch.push_back('\f'); break;
+			case 'n': m_Scratch.push_back('\n'); break;
+			case 'r': m_Scratch.push_back('\r'); break;
+			case 't': m_Scratch.push_back('\t'); break;
+			case 'u':
+			{
+				uint32_t codePoint = 0;
+				if (!ParseUnicodeEscape(codePoint)) {
+					return false;
+				}
+				AppendUtf8(m_Scratch, codePoint);
+				break;
+			}
+			default:
+				Fail("Unsupported escape sequence");
+				return false;
+			}
+		}
+
+		Fail("Unterminated JSON string");
+		return false;
+	}
+
+	bool Reader::ParseUnicodeEscape(uint32_t& outCodePoint) {
+		if (m_Position + 4 > m_Text.size()) {
+			Fail("Incomplete unicode escape");
+			return false;
+		}
+
+		uint32_t codePoint = 0;
+		for (int i = 0; i < 4; i++) {
+			const char digit = m_Text[m_Position++];
+			codePoint <<= 4;
+			if (digit >= '0' && digit <= '9') {
+				codePoint |= static_cast<uint32_t>(digit - '0');
+			}
+			else if (digit >= 'a' && digit <= 'f') {
+				codePoint |= static_cast<uint32_t>(digit - 'a' + 10);
+			}
+			else if (digit >= 'A' && digit <= 'F') {
+				codePoint |= static_cast<uint32_t>(digit - 'A' + 10);
+			}
+			else {
+				Fail("Invalid unicode escape");
+				return false;
+			}
+		}
+
+		outCodePoint = codePoint;
+		return true;
+	}
+
+	Token Reader::CloseContainer(Token token) {
+		m_Stack.pop_back();
+		m_RootDone = m_Stack.empty();
+		return m_Token = token;
 	}
 
+	Token Reader::Fail(std::string_view message) {
+		std::ostringstream stream;
+		stream << message << " at byte " << m_Position;
+		m_Error = stream.str();
+		return m_Token = Token::Error;
+	}
+
+	void Reader::SkipWhitespace() {
+		while (!IsAtEnd() && std::isspace(static_cast<unsigned char>(m_Text[m_Position]))) {
+			m_Position++;
+		}
+	}
+
+	// ── Free functions ──────────────────────────────────────────────────
+
 	bool TryParse(std::string_view text, Value& outValue, std::string* outError) {
-		Parser parser(text);
-		return parser.ParseValue(outValue, outError);
+		Reader reader(text);
+		Value parsed;
+		if (reader.Next() == Token::Error || !reader.ReadValue(parsed) || reader.Next() != Token::EndOfInput) {
+			if (outError) {
+				*outError = reader.GetError();
+			}
+			return false;
+		}
+
+		outValue = std::move(parsed);
+		return true;
 	}
 
 	Value Parse(std::string_view text, std::string* outError) {
@@ -656,6 +841,17 @@ namespace Bolt::Json {
 		return parsed;
 	}
 
+	bool Validate(std::string_view text, std::string* outError) {
+		Reader reader(text);
+		if (reader.Next() == Token::Error || !reader.SkipValue() || reader.Next() != Token::EndOfInput) {
+			if (outError) {
+				*outError = reader.GetError();
+			}
+			return false;
+		}
+		return true;
+	}
+
 	std::string EscapeString(std::string_view value) {
 		std::string escaped;
 		escaped.reserve(value.size());
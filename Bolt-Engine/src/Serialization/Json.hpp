@@ -11,7 +11,7 @@ namespace Bolt::Json {
 
 	class BOLT_API Value {
 	public:
-		enum class Type {
+		enum class Type : uint8_t {
 			Null,
 			Bool,
 			Number,
@@ -31,7 +31,14 @@ namespace Bolt::Json {
 		Value(int64_t value);
 		Value(uint64_t value);
 		Value(const char* value);
-		Value(std::string value);
+		Value(std::string_view value);
+		Value(const std::string& value);
+
+		Value(const Value& other);
+		Value(Value&& other) noexcept;
+		Value& operator=(const Value& other);
+		Value& operator=(Value&& other) noexcept;
+		~Value();
 
 		static Value MakeObject();
 		static Value MakeArray();
@@ -50,7 +57,10 @@ namespace Bolt::Json {
 		int64_t AsInt64Or(int64_t fallback) const;
 		uint64_t AsUInt64Or(uint64_t fallback) const;
 		std::string AsStringOr(std::string fallback = {}) const;
+		// Info: Empty for non strings, valid until the value is modified
+		std::string_view AsStringView() const;
 
+		// Info: Mutable access drops the member hash index, it is rebuilt on the next AddMember
 		Object& GetObject();
 		const Object& GetObject() const;
 		Array& GetArray();
@@ -63,19 +73,117 @@ namespace Bolt::Json {
 		Value& Append(Value value);
 
 	private:
+		struct ObjectStorage;
+
+		// Info: Strings up to this length live inside the value, longer ones on the heap
+		static constexpr size_t k_InlineStringCapacity = 16;
+		static constexpr uint8_t k_HeapString = 0xFF;
+
+		struct HeapString {
+			char* Data;
+			size_t Size;
+		};
+
+		union Storage {
+			bool Bool;
+			double Number;
+			char Inline[k_InlineStringCapacity];
+			HeapString Heap;
+			ObjectStorage* Members;
+			Array* Items;
+		};
+
 		void SetType(Type type);
+		void AssignString(std::string_view value);
+		void Release();
+		void CopyFrom(const Value& other);
+		void MoveFrom(Value& other);
+		ObjectStorage& EnsureObjectStorage();
 
 	private:
+		Storage m_Storage{};
 		Type m_Type = Type::Null;
-		bool m_Bool = false;
+		uint8_t m_StringSize = 0;
+	};
+
+	// Info: Token stream of a JSON document, Next() advances one token without building a DOM
+	enum class Token : uint8_t {
+		None,
+		BeginObject,
+		EndObject,
+		BeginArray,
+		EndArray,
+		Key,
+		String,
+		Number,
+		Bool,
+		Null,
+		EndOfInput,
+		Error
+	};
+
+	/// <summary>
+	/// Pull parser over a JSON text. Strings without escapes point straight into the input,
+	/// so walking a document allocates nothing; ReadValue() builds a DOM for one subtree when needed.
+	/// The input must outlive the reader.
+	/// </summary>
+	class BOLT_API Reader {
+	public:
+		explicit Reader(std::string_view text);
+
+		Token Next();
+		Token GetToken() const { return m_Token; }
+
+		// Info: Key or string contents, valid until the next call to Next()
+		std::string_view GetString() const { return m_String; }
+		double GetNumber() const { return m_Number; }
+		bool GetBool() const { return m_Bool; }
+		size_t GetDepth() const { return m_Stack.size(); }
+
+		// Info: Skips the value starting at the current token, e.g. a whole object after BeginObject
+		bool SkipValue();
+		// Info: Builds a DOM for the value starting at the current token
+		bool ReadValue(Value& outValue);
+
+		bool HasError() const { return m_Token == Token::Error; }
+		const std::string& GetError() const { return m_Error; }
+
+	private:
+		struct Frame {
+			bool IsObject;
+			bool HasItems;
+			bool ExpectValue;
+		};
+
+		Token ParseValueStart();
+		Token ParseLiteral(std::string_view literal, Token token, bool value);
+		Token ParseNumber();
+		bool ParseString();
+		bool ParseUnicodeEscape(uint32_t& outCodePoint);
+		Token CloseContainer(Token token);
+		Token Fail(std::string_view message);
+
+		void SkipWhitespace();
+		bool IsAtEnd() const { return m_Position >= m_Text.size(); }
+		char Peek() const { return IsAtEnd() ? '\0' : m_Text[m_Position]; }
+
+	private:
+		std::string_view m_Text;
+		size_t m_Position = 0;
+		Token m_Token = Token::None;
+		std::string_view m_String;
+		std::string m_Scratch;
 		double m_Number = 0.0;
-		std::string m_String;
-		Object m_Object;
-		Array m_Array;
+		bool m_Bool = false;
+		bool m_RootDone = false;
+		std::vector<Frame> m_Stack;
+		std::string m_Error;
 	};
 
 	BOLT_API bool TryParse(std::string_view text, Value& outValue, std::string* outError = nullptr);
 	BOLT_API Value Parse(std::string_view text, std::string* outError = nullptr);
+	// Info: Checks the whole document without building a DOM
+	BOLT_API bool Validate(std::string_view text, std::string* outError = nullptr);
 	BOLT_API std::string EscapeString(std::string_view value);
 	BOLT_API std::string Stringify(const Value& value, bool pretty = false, int indentSize = 2);
 
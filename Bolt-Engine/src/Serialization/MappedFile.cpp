@@ -0,0 +1,147 @@
+#include "pch.hpp"
+#include "Serialization/MappedFile.hpp"
+
+#ifdef BT_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Bolt {
+
+	namespace {
+		// Info: Returns nullptr when the file can't be mapped, the caller then reads it instead
+		const std::byte* MapWholeFile(const std::string& path, size_t& outSize) {
+#ifdef BT_PLATFORM_WINDOWS
+			const std::wstring widePath = std::filesystem::path(path).wstring();
+			HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file == INVALID_HANDLE_VALUE) {
+				return nullptr;
+			}
+
+			LARGE_INTEGER size{};
+			if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+				CloseHandle(file);
+				return nullptr;
+			}
+
+			HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			CloseHandle(file);
+			if (!mapping) {
+				return nullptr;
+			}
+
+			// The view keeps the mapping object alive on its own
+			void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+			if (!view) {
+				return nullptr;
+			}
+
+			outSize = static_cast<size_t>(size.QuadPart);
+			return static_cast<const std::byte*>(view);
+#else
+			const int fd = open(path.c_str(), O_RDONLY);
+			if (fd < 0) {
+				return nullptr;
+			}
+
+			struct stat info {};
+			if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+				close(fd);
+				return nullptr;
+			}
+
+			void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			close(fd);
+			if (view == MAP_FAILED) {
+				return nullptr;
+			}
+
+			outSize = static_cast<size_t>(info.st_size);
+			return static_cast<const std::byte*>(view);
+#endif
+		}
+
+		void UnmapWholeFile(const std::byte* data, size_t size) {
+#ifdef BT_PLATFORM_WINDOWS
+			(void)size;
+			UnmapViewOfFile(data);
+#else
+			munmap(const_cast<std::byte*>(data), size);
+#endif
+		}
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept {
+		*this = std::move(other);
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+		if (this == &other) {
+			return *this;
+		}
+
+		Close();
+		// Info: Moving the vector keeps its heap block, so a fallback buffer pointer stays valid too
+		m_Fallback = std::move(other.m_Fallback);
+		m_Data = other.m_Data;
+		m_Size = other.m_Size;
+		m_Mapped = other.m_Mapped;
+
+		other.m_Data = nullptr;
+		other.m_Size = 0;
+		other.m_Mapped = false;
+		return *this;
+	}
+
+	bool MappedFile::Open(const std::string& path) {
+		Close();
+
+		size_t size = 0;
+		if (const std::byte* mapped = MapWholeFile(path, size)) {
+			m_Data = mapped;
+			m_Size = size;
+			m_Mapped = true;
+			return true;
+		}
+
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file.is_open()) {
+			return false;
+		}
+
+		const std::streamsize fileSize = file.tellg();
+		if (fileSize <= 0) {
+			return false;
+		}
+
+		m_Fallback.resize(static_cast<size_t>(fileSize));
+		file.seekg(0, std::ios::beg);
+		if (!file.read(reinterpret_cast<char*>(m_Fallback.data()), fileSize)) {
+			m_Fallback.clear();
+			return false;
+		}
+
+		m_Data = m_Fallback.data();
+		m_Size = m_Fallback.size();
+		return true;
+	}
+
+	void MappedFile::Close() {
+		if (m_Mapped && m_Data) {
+			UnmapWholeFile(m_Data, m_Size);
+		}
+
+		m_Fallback.clear();
+		m_Fallback.shrink_to_fit();
+		m_Data = nullptr;
+		m_Size = 0;
+		m_Mapped = false;
+	}
+
+} // namespace Bolt
@@ -0,0 +1,41 @@
+#pragma once
+#include "Core/Export.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Bolt {
+
+	/// <summary>
+	/// Read-only view of a whole file. Memory-maps the file where the platform allows it
+	/// and falls back to reading it into an owned buffer otherwise, so callers never branch.
+	/// The data pointer stays valid until Close() or destruction.
+	/// </summary>
+	class BOLT_API MappedFile {
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const std::string& path) { Open(path); }
+		~MappedFile() { Close(); }
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		bool Open(const std::string& path);
+		void Close();
+
+		bool IsOpen() const { return m_Data != nullptr; }
+		bool IsMapped() const { return m_Mapped; }
+		const std::byte* GetData() const { return m_Data; }
+		size_t GetSize() const { return m_Size; }
+
+	private:
+		const std::byte* m_Data = nullptr;
+		size_t m_Size = 0;
+		bool m_Mapped = false;
+		std::vector<std::byte> m_Fallback;
+	};
+
+} // namespace Bolt
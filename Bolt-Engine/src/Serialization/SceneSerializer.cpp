@@ -183,6 +183,7 @@ namespace Bolt {
 				rigidbodyValue.AddMember("bodyType", Value(static_cast<int>(rigidbody.GetBodyType())));
 				rigidbodyValue.AddMember("gravityScale", Value(rigidbody.GetGravityScale()));
 				rigidbodyValue.AddMember("mass", Value(rigidbody.GetMass()));
+				rigidbodyValue.AddMember("interpolation", Value(static_cast<int>(rigidbody.GetInterpolation())));
 				entityValue.AddMember("Rigidbody2D", std::move(rigidbodyValue));
 			}
 
@@ -197,7 +198,7 @@ namespace Bolt {
 				colliderValue.AddMember("centerY", Value(center.y));
 				colliderValue.AddMember("friction", Value(collider.GetFriction()));
 				colliderValue.AddMember("bounciness", Value(collider.GetBounciness()));
-				colliderValue.AddMember("layer", Value(collider.GetLayer()));
+				colliderValue.AddMember("collisionLayer", Value(collider.GetLayer()));
 				colliderValue.AddMember("registerContacts", Value(collider.CanRegisterContacts()));
 				colliderValue.AddMember("sensor", Value(collider.IsSensor()));
 				entityValue.AddMember("BoxCollider2D", std::move(colliderValue));
@@ -294,6 +295,7 @@ namespace Bolt {
 				particleValue.AddMember("useRandomColors", Value(particleSystem.ParticleSettings.UseRandomColors));
 				particleValue.AddMember("moveDirectionX", Value(particleSystem.ParticleSettings.MoveDirection.x));
 				particleValue.AddMember("moveDirectionY", Value(particleSystem.ParticleSettings.MoveDirection.y));
+				particleValue.AddMember("simulation", Value(static_cast<int>(particleSystem.ParticleSettings.Simulation)));
 				particleValue.AddMember("emitOverTime", Value(static_cast<int>(particleSystem.EmissionSettings.EmitOverTime)));
 				particleValue.AddMember(
 					"rateOverDistance",
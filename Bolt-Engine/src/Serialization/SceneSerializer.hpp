@@ -18,6 +18,8 @@ namespace Bolt {
 	public:
 		static Json::Value SerializeScene(Scene& scene);
 		static bool DeserializeScene(Scene& scene, const Json::Value& root, std::string_view source = {});
+		// Info: Same result as DeserializeScene, but parses the text entity by entity instead of building the whole DOM
+		static bool DeserializeSceneStream(Scene& scene, std::string_view json, std::string_view source = {});
 
 		static bool SaveToFile(Scene& scene, const std::string& path);
 		static bool LoadFromFile(Scene& scene, const std::string& path);
@@ -1,6 +1,7 @@
 #include "pch.hpp"
 #include "Assets/AssetRegistry.hpp"
 #include "Serialization/SceneSerializer.hpp"
+#include "Serialization/BinarySceneSerializer.hpp"
 #include "Serialization/SceneSerializerShared.hpp"
 #include "Serialization/File.hpp"
 #include "Serialization/Json.hpp"
@@ -183,6 +184,7 @@ namespace Bolt {
 				rigidbodyValue.AddMember("bodyType", Value(static_cast<int>(rigidbody.GetBodyType())));
 				rigidbodyValue.AddMember("gravityScale", Value(rigidbody.GetGravityScale()));
 				rigidbodyValue.AddMember("mass", Value(rigidbody.GetMass()));
+				rigidbodyValue.AddMember("interpolation", Value(static_cast<int>(rigidbody.GetInterpolation())));
 				entityValue.AddMember("Rigidbody2D", std::move(rigidbodyValue));
 			}
 
@@ -197,7 +199,7 @@ namespace Bolt {
 				colliderValue.AddMember("centerY", Value(center.y));
 				colliderValue.AddMember("friction", Value(collider.GetFriction()));
 				colliderValue.AddMember("bounciness", Value(collider.GetBounciness()));
-				colliderValue.AddMember("layer", Value(collider.GetLayer()));
+				colliderValue.AddMember("collisionLayer", Value(collider.GetLayer()));
 				colliderValue.AddMember("registerContacts", Value(collider.CanRegisterContacts()));
 				colliderValue.AddMember("sensor", Value(collider.IsSensor()));
 				entityValue.AddMember("BoxCollider2D", std::move(colliderValue));
@@ -294,6 +296,7 @@ namespace Bolt {
 				particleValue.AddMember("useRandomColors", Value(particleSystem.ParticleSettings.UseRandomColors));
 				particleValue.AddMember("moveDirectionX", Value(particleSystem.ParticleSettings.MoveDirection.x));
 				particleValue.AddMember("moveDirectionY", Value(particleSystem.ParticleSettings.MoveDirection.y));
+				particleValue.AddMember("simulation", Value(static_cast<int>(particleSystem.ParticleSettings.Simulation)));
 				particleValue.AddMember("emitOverTime", Value(static_cast<int>(particleSystem.EmissionSettings.EmitOverTime)));
 				particleValue.AddMember(
 					"rateOverDistance",
@@ -401,10 +404,60 @@ namespace Bolt {
 
 			return entityValue;
 		}
+
+		void ApplySceneHeader(Scene& scene, int version, const std::string& serializedName, uint64_t sceneId, const std::string& sourcePath) {
+			if (version > SCENE_FORMAT_VERSION) {
+				BT_CORE_WARN_TAG(
+					"SceneSerializer",
+					"Scene version {} is newer than supported ({})",
+					version,
+					SCENE_FORMAT_VERSION);
+			}
+
+			if (!sourcePath.empty()) {
+				scene.SetName(std::filesystem::path(sourcePath).stem().string());
+			}
+			else if (!serializedName.empty()) {
+				scene.SetName(serializedName);
+			}
+
+			if (sceneId != 0) {
+				scene.SetSceneId(UUID(sceneId));
+			}
+		}
+
+		void FinishSceneLoad(Scene& scene, bool hasEntities, const std::string& sourcePath) {
+			if (!hasEntities) {
+				if (!sourcePath.empty()) {
+					BT_CORE_WARN_TAG("SceneSerializer", "No entities array in scene file: {}", sourcePath);
+				}
+				else {
+					BT_CORE_WARN_TAG("SceneSerializer", "No entities array in scene data");
+				}
+			}
+
+			if (scene.GetRegistry().view<Camera2DComponent>().size() == 0) {
+				EntityHelper::CreateCamera2DEntity(scene);
+				BT_CORE_INFO_TAG("SceneSerializer", "Added default camera (none in scene data)");
+			}
+
+			scene.ClearDirty();
+			BT_CORE_INFO_TAG("SceneSerializer", "Loaded scene: {}", scene.GetName());
+		}
 	} // namespace
 
 	bool SceneSerializer::LoadFromFile(Scene& scene, const std::string& path) {
 		try {
+			if (BinarySceneSerializer::IsBinaryScenePath(path)) {
+				return BinarySceneSerializer::LoadFromFile(scene, path);
+			}
+
+			// Info: An exported .bscene is only preferred while it is not older than the JSON, edits always win
+			const std::string binaryPath = BinarySceneSerializer::GetUpToDateBinaryPath(path);
+			if (!binaryPath.empty() && BinarySceneSerializer::LoadFromFile(scene, binaryPath)) {
+				return true;
+			}
+
 			if (!File::Exists(path)) {
 				BT_CORE_WARN_TAG("SceneSerializer", "Scene file not found: {}", path);
 				return false;
@@ -416,14 +469,14 @@ namespace Bolt {
 				return false;
 			}
 
-			Value root;
+			// Validating first keeps the current scene untouched on malformed files, the tokenizer pass allocates nothing
 			std::string parseError;
-			if (!Json::TryParse(json, root, &parseError) || !root.IsObject()) {
+			if (!Json::Validate(json, &parseError)) {
 				BT_CORE_ERROR_TAG("SceneSerializer", "Failed to parse scene JSON {}: {}", path, parseError);
 				return false;
 			}
 
-			return DeserializeScene(scene, root, path);
+			return DeserializeSceneStream(scene, json, path);
 		}
 		catch (const std::exception& exception) {
 			BT_CORE_ERROR_TAG("SceneSerializer", "Load failed: {}", exception.what());
@@ -437,32 +490,18 @@ namespace Bolt {
 			return false;
 		}
 
-		const int version = GetIntMember(root, "version", 1);
-		if (version > SCENE_FORMAT_VERSION) {
-			BT_CORE_WARN_TAG(
-				"SceneSerializer",
-				"Scene version {} is newer than supported ({})",
-				version,
-				SCENE_FORMAT_VERSION);
-		}
-
 		const std::string sourcePath(source);
-		const std::string serializedName = GetStringMember(root, "name");
-		if (!sourcePath.empty()) {
-			scene.SetName(std::filesystem::path(sourcePath).stem().string());
-		}
-		else if (!serializedName.empty()) {
-			scene.SetName(serializedName);
-		}
-
-		const uint64_t sceneId = GetUInt64Member(root, "sceneId", 0);
-		if (sceneId != 0) {
-			scene.SetSceneId(UUID(sceneId));
-		}
+		ApplySceneHeader(
+			scene,
+			GetIntMember(root, "version", 1),
+			GetStringMember(root, "name"),
+			GetUInt64Member(root, "sceneId", 0),
+			sourcePath);
 
 		scene.ClearEntities();
 
-		if (const Value* entitiesValue = GetArrayMember(root, "entities")) {
+		const Value* entitiesValue = GetArrayMember(root, "entities");
+		if (entitiesValue) {
 			for (const Value& entityValue : entitiesValue->GetArray()) {
 				if (!entityValue.IsObject()) {
 					continue;
@@ -470,22 +509,72 @@ namespace Bolt {
 				DeserializeEntity(scene, entityValue);
 			}
 		}
-		else {
-			if (!sourcePath.empty()) {
-				BT_CORE_WARN_TAG("SceneSerializer", "No entities array in scene file: {}", sourcePath);
+
+		FinishSceneLoad(scene, entitiesValue != nullptr, sourcePath);
+		return true;
+	}
+
+	bool SceneSerializer::DeserializeSceneStream(Scene& scene, std::string_view json, std::string_view source) {
+		Json::Reader reader(json);
+		if (reader.Next() != Json::Token::BeginObject) {
+			BT_CORE_ERROR_TAG("SceneSerializer", "DeserializeScene requires an object root");
+			return false;
+		}
+
+		const std::string sourcePath(source);
+		int version = 1;
+		std::string serializedName;
+		uint64_t sceneId = 0;
+		bool hasEntities = false;
+
+		scene.ClearEntities();
+
+		// Info: Only one entity DOM is alive at a time, the scene root is never materialized
+		Value memberValue;
+		while (reader.Next() == Json::Token::Key) {
+			const std::string key(reader.GetString());
+			const Json::Token token = reader.Next();
+
+			if (key == "entities" && token == Json::Token::BeginArray) {
+				hasEntities = true;
+				while (reader.Next() != Json::Token::EndArray) {
+					if (!reader.ReadValue(memberValue)) {
+						break;
+					}
+					if (memberValue.IsObject()) {
+						DeserializeEntity(scene, memberValue);
+					}
+				}
+				continue;
+			}
+
+			if (key != "version" && key != "name" && key != "sceneId") {
+				reader.SkipValue();
+				continue;
+			}
+
+			if (!reader.ReadValue(memberValue)) {
+				break;
+			}
+
+			if (key == "version") {
+				version = memberValue.AsIntOr(1);
+			}
+			else if (key == "name") {
+				serializedName = memberValue.AsStringOr();
 			}
 			else {
-				BT_CORE_WARN_TAG("SceneSerializer", "No entities array in scene data");
+				sceneId = ValueToUInt64(memberValue, 0);
 			}
 		}
 
-		if (scene.GetRegistry().view<Camera2DComponent>().size() == 0) {
-			EntityHelper::CreateCamera2DEntity(scene);
-			BT_CORE_INFO_TAG("SceneSerializer", "Added default camera (none in scene data)");
+		if (reader.HasError()) {
+			BT_CORE_ERROR_TAG("SceneSerializer", "Failed to parse scene JSON {}: {}", sourcePath, reader.GetError());
+			return false;
 		}
 
-		scene.ClearDirty();
-		BT_CORE_INFO_TAG("SceneSerializer", "Loaded scene: {}", scene.GetName());
+		ApplySceneHeader(scene, version, serializedName, sceneId, sourcePath);
+		FinishSceneLoad(scene, hasEntities, sourcePath);
 		return true;
 	}
 
@@ -499,7 +588,7 @@ namespace Bolt {
 
 		const uint64_t savedUuid = GetUInt64Member(entityValue, "uuid", 0);
 		if (savedUuid != 0 && scene.HasComponent<UUIDComponent>(entity)) {
-			scene.GetComponent<UUIDComponent>(entity).Id = UUID(savedUuid);
+			scene.SetEntityUUID(entity, UUID(savedUuid));
 		}
 
 		if (const Value* transformValue = GetObjectMember(entityValue, "Transform2D")) {
@@ -545,6 +634,7 @@ namespace Bolt {
 			rigidbody.SetBodyType(static_cast<BodyType>(GetIntMember(*rigidbodyValue, "bodyType", static_cast<int>(BodyType::Dynamic))));
 			rigidbody.SetGravityScale(GetFloatMember(*rigidbodyValue, "gravityScale", 1.0f));
 			rigidbody.SetMass(GetFloatMember(*rigidbodyValue, "mass", 1.0f));
+			rigidbody.SetInterpolation(static_cast<InterpolationMode>(GetIntMember(*rigidbodyValue, "interpolation", static_cast<int>(InterpolationMode::None))));
 		}
 
 		if (const Value* colliderValue = GetObjectMember(entityValue, "BoxCollider2D")) {
@@ -571,7 +661,7 @@ namespace Bolt {
 			boxCollider.SetSensor(GetBoolMember(*colliderValue, "sensor", false), scene);
 			boxCollider.SetFriction(GetFloatMember(*colliderValue, "friction", boxCollider.GetFriction()));
 			boxCollider.SetBounciness(GetFloatMember(*colliderValue, "bounciness", boxCollider.GetBounciness()));
-			boxCollider.SetLayer(GetUInt64Member(*colliderValue, "layer", boxCollider.GetLayer()));
+			boxCollider.SetLayer(GetCollisionLayerMember(*colliderValue));
 			boxCollider.SetRegisterContacts(GetBoolMember(*colliderValue, "registerContacts", boxCollider.CanRegisterContacts()));
 		}
 
@@ -646,6 +736,8 @@ namespace Bolt {
 			particleSystem.ParticleSettings.UseRandomColors = GetBoolMember(*particleValue, "useRandomColors", false);
 			particleSystem.ParticleSettings.MoveDirection.x = GetFloatMember(*particleValue, "moveDirectionX", 0.0f);
 			particleSystem.ParticleSettings.MoveDirection.y = GetFloatMember(*particleValue, "moveDirectionY", 0.0f);
+			particleSystem.ParticleSettings.Simulation = static_cast<ParticleSystem2DComponent::SimulationMode>(
+				GetIntMember(*particleValue, "simulation", static_cast<int>(ParticleSystem2DComponent::SimulationMode::CPU)));
 			particleSystem.EmissionSettings.EmitOverTime =
 				static_cast<uint16_t>(GetIntMember(*particleValue, "emitOverTime", 10));
 			particleSystem.EmissionSettings.RateOverDistance =
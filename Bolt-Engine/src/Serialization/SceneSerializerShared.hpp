@@ -2,6 +2,7 @@
 
 #include "Assets/AssetRegistry.hpp"
 #include "Audio/AudioManager.hpp"
+#include "Core/Log.hpp"
 #include "Core/UUID.hpp"
 #include "Graphics/TextureManager.hpp"
 #include "Serialization/Json.hpp"
@@ -25,22 +26,23 @@ namespace Bolt::SceneSerializerShared {
 		return value ? value->AsIntOr(fallback) : fallback;
 	}
 
-	inline uint64_t GetUInt64Member(const Value& object, std::string_view key, uint64_t fallback = 0) {
-		const Value* value = object.FindMember(key);
-		if (!value) {
-			return fallback;
-		}
-
-		if (value->IsString()) {
+	// Info: UUIDs are written as strings since doubles can't hold every 64 bit value, plain numbers are still accepted
+	inline uint64_t ValueToUInt64(const Value& value, uint64_t fallback = 0) {
+		if (value.IsString()) {
 			try {
-				return static_cast<uint64_t>(std::stoull(value->AsStringOr()));
+				return static_cast<uint64_t>(std::stoull(value.AsStringOr()));
 			}
 			catch (...) {
 				return fallback;
 			}
 		}
 
-		return value->AsUInt64Or(fallback);
+		return value.AsUInt64Or(fallback);
+	}
+
+	inline uint64_t GetUInt64Member(const Value& object, std::string_view key, uint64_t fallback = 0) {
+		const Value* value = object.FindMember(key);
+		return value ? ValueToUInt64(*value, fallback) : fallback;
 	}
 
 	inline bool GetBoolMember(const Value& object, std::string_view key, bool fallback = false) {
@@ -58,6 +60,43 @@ namespace Bolt::SceneSerializerShared {
 		return value && value->IsObject() ? value : nullptr;
 	}
 
+	// Info: Scenes saved before collision layers stored the Box2D mask bits under "layer".
+	// A full mask was the default and maps to layer 0, otherwise the lowest set bit is used as the layer.
+	inline int GetCollisionLayerMember(const Value& collider) {
+		if (const Value* layerValue = collider.FindMember("collisionLayer")) {
+			return layerValue->AsIntOr(0);
+		}
+
+		const Value* legacyValue = collider.FindMember("layer");
+		if (!legacyValue) {
+			return 0;
+		}
+
+		// Info: The old default mask (all 64 bits) was written as a double that rounds past UINT64_MAX
+		if (legacyValue->IsNumber() && legacyValue->AsDoubleOr(0.0) >= static_cast<double>(UINT32_MAX)) {
+			return 0;
+		}
+
+		const uint32_t bits = static_cast<uint32_t>(ValueToUInt64(*legacyValue, UINT64_MAX));
+		if (bits == 0 || bits == UINT32_MAX) {
+			return 0;
+		}
+
+		int layer = 0;
+		while ((bits & (uint32_t{ 1 } << layer)) == 0) {
+			layer++;
+		}
+
+		if ((bits & (bits - 1)) != 0) {
+			static bool s_WarnedLossyMask = false;
+			if (!s_WarnedLossyMask) {
+				s_WarnedLossyMask = true;
+				BT_CORE_WARN_TAG("SceneSerializer", "Legacy collider mask {:#x} covers several layers, loading it on layer {}; set the layer matrix in the project settings", bits, layer);
+			}
+		}
+		return layer;
+	}
+
 	inline const Value* GetArrayMember(const Value& object, std::string_view key) {
 		const Value* value = object.FindMember(key);
 		return value && value->IsArray() ? value : nullptr;
@@ -82,10 +121,11 @@ namespace Bolt::SceneSerializerShared {
 		return assetId != 0 ? std::to_string(assetId) : value;
 	}
 
-	inline TextureHandle LoadTextureFromValue(const Value& object, std::string_view assetKey, std::string_view pathKey, UUID* outAssetId = nullptr) {
-		uint64_t assetId = GetUInt64Member(object, assetKey, 0);
+	// Info: Prefers the asset UUID and falls back to the stored path, outAssetId receives the UUID actually in use.
+	// Textures load asynchronously, so a scene's images decode in parallel and show up as they are uploaded.
+	inline TextureHandle LoadTextureAsset(uint64_t assetId, const std::string& path, UUID* outAssetId = nullptr) {
 		if (assetId != 0) {
-			TextureHandle handle = TextureManager::LoadTextureByUUID(assetId);
+			TextureHandle handle = TextureManager::LoadTextureByUUIDAsync(assetId);
 			if (handle.IsValid()) {
 				if (outAssetId) {
 					*outAssetId = UUID(assetId);
@@ -94,7 +134,6 @@ namespace Bolt::SceneSerializerShared {
 			}
 		}
 
-		const std::string path = GetStringMember(object, pathKey);
 		if (path.empty()) {
 			if (outAssetId) {
 				*outAssetId = UUID(0);
@@ -102,7 +141,7 @@ namespace Bolt::SceneSerializerShared {
 			return TextureHandle::Invalid();
 		}
 
-		TextureHandle handle = TextureManager::LoadTexture(path);
+		TextureHandle handle = TextureManager::LoadTextureAsync(path);
 		if (handle.IsValid()) {
 			assetId = TextureManager::GetTextureAssetUUID(handle);
 			if (outAssetId) {
@@ -116,8 +155,11 @@ namespace Bolt::SceneSerializerShared {
 		return handle;
 	}
 
-	inline AudioHandle LoadAudioFromValue(const Value& object, std::string_view assetKey, std::string_view pathKey, UUID* outAssetId = nullptr) {
-		uint64_t assetId = GetUInt64Member(object, assetKey, 0);
+	inline TextureHandle LoadTextureFromValue(const Value& object, std::string_view assetKey, std::string_view pathKey, UUID* outAssetId = nullptr) {
+		return LoadTextureAsset(GetUInt64Member(object, assetKey, 0), GetStringMember(object, pathKey), outAssetId);
+	}
+
+	inline AudioHandle LoadAudioAsset(uint64_t assetId, const std::string& path, UUID* outAssetId = nullptr) {
 		if (assetId != 0) {
 			AudioHandle handle = AudioManager::LoadAudioByUUID(assetId);
 			if (handle.IsValid()) {
@@ -128,7 +170,6 @@ namespace Bolt::SceneSerializerShared {
 			}
 		}
 
-		const std::string path = GetStringMember(object, pathKey);
 		if (path.empty()) {
 			if (outAssetId) {
 				*outAssetId = UUID(0);
@@ -150,6 +191,10 @@ namespace Bolt::SceneSerializerShared {
 		return handle;
 	}
 
+	inline AudioHandle LoadAudioFromValue(const Value& object, std::string_view assetKey, std::string_view pathKey, UUID* outAssetId = nullptr) {
+		return LoadAudioAsset(GetUInt64Member(object, assetKey, 0), GetStringMember(object, pathKey), outAssetId);
+	}
+
 	inline std::string ValueToFieldString(const Value& value) {
 		if (value.IsString()) {
 			return value.AsStringOr();
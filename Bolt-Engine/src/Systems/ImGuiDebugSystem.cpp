@@ -220,6 +220,7 @@ namespace Bolt {
 
 			if (ImGui::CollapsingHeader("Renderer")) {
 				ImGui::BulletText("Instances: %d", renderer2D->GetRenderedInstancesCount());
+				ImGui::BulletText("Draw Calls: %zu", renderer2D->GetDrawCallCount());
 				ImGui::BulletText("Loop Duration: %.3f ms", renderer2D->GetRenderLoopDuration());
 
 				ImGui::Spacing();
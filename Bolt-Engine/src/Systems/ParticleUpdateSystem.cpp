@@ -6,8 +6,11 @@
 
 #include "Components/Graphics/ParticleSystem2DComponent.hpp"
 #include "Components/Tags.hpp"
+#include "Core/Application.hpp"
+#include "Core/JobSystem.hpp"
 
 #include <entt/entt.hpp>
+#include <algorithm>
 
 namespace Bolt {
 	void ParticleUpdateSystem::Awake(Scene& scene) {
@@ -17,7 +20,65 @@ namespace Bolt {
 	}
 
 	void ParticleUpdateSystem::Update(Scene& scene) {
+		const float deltaTime = Application::GetInstance()->GetTime().GetDeltaTime();
+		if (deltaTime == 0.f) return;
+
+		// Info: Emitter transforms are resolved here so the workers never touch the registry
+		m_Emitters.clear();
 		for (const auto& [ent, particleSystem] : scene.GetRegistry().view<ParticleSystem2DComponent>(entt::exclude<DisabledTag>).each())
-			particleSystem.Update();
+			m_Emitters.push_back({ &particleSystem, particleSystem.TryGetEmitterTransform() });
+
+		if (m_Emitters.empty()) return;
+
+		// Info: Every emitter draws from its own RandomStream, so emission needs no shared generator
+		JobSystem::ParallelFor(m_Emitters.size(), k_MinEmittersPerChunk, [this, deltaTime](size_t begin, size_t end, size_t) {
+			for (size_t i = begin; i < end; i++)
+				m_Emitters[i].System->UpdateEmission(deltaTime, m_Emitters[i].EmitterTransform);
+		});
+
+		// Info: GPU emitters only issue GL commands, which have to come from the main thread
+		for (const EmitterWork& emitter : m_Emitters) {
+			ParticleSystem2DComponent& particleSystem = *emitter.System;
+			if (particleSystem.UsesGpuSimulation()) {
+				if (particleSystem.m_IsSimulating)
+					particleSystem.StepGpuSimulation(deltaTime, emitter.EmitterTransform);
+			}
+			else if (particleSystem.m_GpuSimulation.IsInitialized()) {
+				particleSystem.m_GpuSimulation.Release();
+			}
+		}
+
+		m_Ranges.clear();
+		for (const EmitterWork& emitter : m_Emitters) {
+			ParticleSystem2DComponent& particleSystem = *emitter.System;
+			if (!particleSystem.m_IsSimulating) continue;
+
+			const size_t count = particleSystem.m_Particles.Size();
+			for (size_t begin = 0; begin < count; begin += k_ParticlesPerRange)
+				m_Ranges.push_back({ &particleSystem, begin, std::min(count, begin + k_ParticlesPerRange) });
+		}
+
+		m_RangeExpired.assign(m_Ranges.size(), 0);
+		JobSystem::ParallelFor(m_Ranges.size(), 1, [this, deltaTime](size_t begin, size_t end, size_t) {
+			for (size_t i = begin; i < end; i++) {
+				SimulationRange& range = m_Ranges[i];
+				const auto& settings = range.System->ParticleSettings;
+				const Vec2 gravity = settings.UseGravity ? settings.Gravity : Vec2(0.f, 0.f);
+				m_RangeExpired[i] = range.System->m_Particles.Integrate(range.Begin, range.End, deltaTime, gravity) ? 1 : 0;
+			}
+		});
+
+		// Info: Ranges of one emitter are contiguous, removal has to wait until all of them integrated
+		m_PendingRemoval.clear();
+		for (size_t i = 0; i < m_Ranges.size(); i++) {
+			if (!m_RangeExpired[i]) continue;
+			if (m_PendingRemoval.empty() || m_PendingRemoval.back() != m_Ranges[i].System)
+				m_PendingRemoval.push_back(m_Ranges[i].System);
+		}
+
+		JobSystem::ParallelFor(m_PendingRemoval.size(), k_MinEmittersPerChunk, [this](size_t begin, size_t end, size_t) {
+			for (size_t i = begin; i < end; i++)
+				m_PendingRemoval[i]->m_Particles.RemoveExpired();
+		});
 	}
-}
\ No newline at end of file
+}
@@ -1,10 +1,34 @@
 #pragma once
 #include "Scene/ISystem.hpp"
+#include "Components/Graphics/ParticleSystem2DComponent.hpp"
+
+#include <vector>
 
 namespace Bolt {
 	class ParticleUpdateSystem : public ISystem {
 	public:
 		virtual void Awake(Scene& scene);
 		virtual void Update(Scene& scene);
+
+	private:
+		// Info: Emitters with more live particles than this are integrated as several ranges
+		static constexpr size_t k_ParticlesPerRange = 16384;
+		static constexpr size_t k_MinEmittersPerChunk = 4;
+
+		struct EmitterWork {
+			ParticleSystem2DComponent* System;
+			const Transform2DComponent* EmitterTransform;
+		};
+
+		struct SimulationRange {
+			ParticleSystem2DComponent* System;
+			size_t Begin;
+			size_t End;
+		};
+
+		std::vector<EmitterWork> m_Emitters;
+		std::vector<SimulationRange> m_Ranges;
+		std::vector<uint8_t> m_RangeExpired;
+		std::vector<ParticleSystem2DComponent*> m_PendingRemoval;
 	};
-}
\ No newline at end of file
+}
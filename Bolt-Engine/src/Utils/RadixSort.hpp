@@ -0,0 +1,57 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Bolt {
+	// Info: Stable LSD radix sort on 64-bit keys, one byte per pass. Only bytes in [firstByte, lastByte]
+	// take part; bytes below firstByte keep their input order. Passes where every key shares the same
+	// byte are skipped, so constant fields (e.g. a single sorting layer) cost one histogram read.
+	inline void RadixSort64(std::vector<uint64_t>& keys, std::vector<uint64_t>& scratch, int firstByte = 0, int lastByte = 7) {
+		const size_t count = keys.size();
+		if (count < 2 || firstByte > lastByte) {
+			return;
+		}
+
+		scratch.resize(count);
+
+		std::array<std::array<size_t, 256>, 8> histograms{};
+		for (size_t i = 0; i < count; i++) {
+			const uint64_t key = keys[i];
+			for (int byte = firstByte; byte <= lastByte; byte++) {
+				histograms[byte][(key >> (byte * 8)) & 0xFF]++;
+			}
+		}
+
+		uint64_t* src = keys.data();
+		uint64_t* dst = scratch.data();
+
+		for (int byte = firstByte; byte <= lastByte; byte++) {
+			const int shift = byte * 8;
+			auto& histogram = histograms[byte];
+			if (histogram[(src[0] >> shift) & 0xFF] == count) {
+				continue;
+			}
+
+			size_t offset = 0;
+			for (size_t& bucket : histogram) {
+				const size_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (size_t i = 0; i < count; i++) {
+				const uint64_t key = src[i];
+				dst[histogram[(key >> shift) & 0xFF]++] = key;
+			}
+
+			std::swap(src, dst);
+		}
+
+		if (src != keys.data()) {
+			keys.swap(scratch);
+		}
+	}
+}
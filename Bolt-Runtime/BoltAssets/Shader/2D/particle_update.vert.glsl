@@ -0,0 +1,120 @@
+#version 330 core
+
+// Transform feedback pass: reads one particle per vertex and writes the advanced state.
+// Runs with GL_RASTERIZER_DISCARD, so there is no fragment stage.
+
+layout (location = 0) in vec2 aPosition;
+layout (location = 1) in vec2 aScale;
+layout (location = 2) in float aRotation;
+layout (location = 3) in vec4 aColor;
+layout (location = 4) in vec2 aVelocity;
+layout (location = 5) in float aLifeTime;
+
+uniform float uDeltaTime;
+uniform vec2 uGravity;
+
+// Slots [uEmitStart, uEmitStart + uEmitCount) of the ring are respawned this step
+uniform uint uEmitStart;
+uniform uint uEmitCount;
+uniform uint uCapacity;
+uniform uint uSeed;
+
+uniform float uLifeTime;
+uniform vec2 uVelocity;
+uniform vec2 uScale;
+uniform vec4 uColor;
+uniform bool uUseRandomColors;
+
+uniform int uShapeType;     // 0 = circle, 1 = square
+uniform vec2 uShapeParams;  // circle: x = radius, y = on circle; square: half extents
+uniform bool uWorldSpace;
+uniform vec2 uEmitterPosition;
+uniform vec2 uEmitterScale;
+uniform float uEmitterRotation;
+
+out vec2 tfPosition;
+out vec2 tfScale;
+out float tfRotation;
+out vec4 tfColor;
+out vec2 tfVelocity;
+out float tfLifeTime;
+
+uint Hash(uint x)
+{
+    x ^= x >> 16u;
+    x *= 0x7feb352du;
+    x ^= x >> 15u;
+    x *= 0x846ca68bu;
+    x ^= x >> 16u;
+    return x;
+}
+
+float NextFloat(inout uint state)
+{
+    state = Hash(state);
+    return float(state >> 8u) * (1.0 / 16777216.0);
+}
+
+vec2 RotateCCW(vec2 v, float radians)
+{
+    float c = cos(radians);
+    float s = sin(radians);
+    return vec2(v.x * c - v.y * s, v.x * s + v.y * c);
+}
+
+void main()
+{
+    uint slot = uint(gl_VertexID);
+    uint emitOffset = (slot + uCapacity - uEmitStart) % uCapacity;
+
+    if (emitOffset < uEmitCount)
+    {
+        uint state = Hash(slot ^ Hash(uSeed));
+        const float twoPi = 6.28318530717958647692;
+
+        vec2 position;
+        if (uShapeType == 0)
+        {
+            float theta = NextFloat(state) * twoPi;
+            float radius = uShapeParams.y > 0.5 ? uShapeParams.x : uShapeParams.x * sqrt(NextFloat(state));
+            position = vec2(cos(theta), sin(theta)) * radius;
+        }
+        else
+        {
+            position = (vec2(NextFloat(state), NextFloat(state)) * 2.0 - 1.0) * uShapeParams;
+        }
+
+        if (uWorldSpace)
+            position = RotateCCW(position * uEmitterScale, uEmitterRotation) + uEmitterPosition;
+
+        tfPosition = position;
+        tfScale = uScale;
+        tfRotation = 0.0;
+        tfColor = uUseRandomColors ? vec4(NextFloat(state), NextFloat(state), NextFloat(state), 1.0) : uColor;
+        tfVelocity = uVelocity;
+        tfLifeTime = uLifeTime;
+        return;
+    }
+
+    if (aLifeTime <= 0.0)
+    {
+        tfPosition = aPosition;
+        tfScale = vec2(0.0);
+        tfRotation = aRotation;
+        tfColor = aColor;
+        tfVelocity = aVelocity;
+        tfLifeTime = 0.0;
+        return;
+    }
+
+    vec2 velocity = aVelocity + uGravity * uDeltaTime;
+    float lifeTime = aLifeTime - uDeltaTime;
+
+    tfPosition = aPosition + velocity * uDeltaTime;
+    // Expired particles collapse to a zero sized quad so the render pass can draw the whole ring
+    tfScale = lifeTime > 0.0 ? aScale : vec2(0.0);
+    tfRotation = aRotation;
+    tfColor = aColor;
+    tfVelocity = velocity;
+    tfLifeTime = max(lifeTime, 0.0);
+}
@@ -2,8 +2,10 @@
 
 in vec2 vUV;
 in vec4 vColor;
+flat in float vAtlasLayer;
 
 uniform sampler2D uTexture;
+uniform sampler2DArray uAtlas;
 uniform bool uPremultipliedAlpha = false;
 uniform float uAlphaCutoff = 0.0;
 
@@ -11,7 +13,9 @@ out vec4 fragColor;
 
 void main()
 {
-    vec4 texel = texture(uTexture, vUV);
+    // Both lookups stay in uniform control flow; the layer only selects the result.
+    vec4 atlasTexel = texture(uAtlas, vec3(vUV, max(vAtlasLayer, 0.0)));
+    vec4 texel = vAtlasLayer >= 0.0 ? atlasTexel : texture(uTexture, vUV);
 
     if (texel.a <= uAlphaCutoff)
         discard;
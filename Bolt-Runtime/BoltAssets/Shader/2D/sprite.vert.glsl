@@ -4,11 +4,14 @@ layout (location = 0) in vec2 aPos;
 layout (location = 1) in vec2 aUV;
 layout (location = 2) in vec4 aColor;
 
-uniform mat4 uMVP;
-uniform vec2 uSpritePos;          
-uniform float uRotation;          
-uniform vec2 uScale;
+// Per-instance attributes (divisor 1 when drawn instanced, constant generic values otherwise)
+layout (location = 3) in vec2 aInstancePos;
+layout (location = 4) in vec2 aInstanceScale;
+layout (location = 5) in float aInstanceRotation;
+layout (location = 6) in vec4 aInstanceUVRect;     // xy = offset, zw = scale inside the atlas page
+layout (location = 7) in float aInstanceAtlasLayer; // < 0 samples uTexture instead of uAtlas
 
+uniform mat4 uMVP;
 
 uniform vec2 uUVOffset = vec2(0.0);
 uniform vec2 uUVScale  = vec2(1.0);
@@ -16,15 +19,16 @@ uniform bvec2 uFlip = bvec2(false, false);
 
 out vec2 vUV;
 out vec4 vColor;
+flat out float vAtlasLayer;
 
 void main()
 {
-    float c = cos(uRotation);
-    float s = sin(uRotation);
+    float c = cos(aInstanceRotation);
+    float s = sin(aInstanceRotation);
     mat2 R = mat2(c, -s, 
                   s,  c);
 
-    vec2 worldPos = (R * (aPos * uScale)) + uSpritePos;
+    vec2 worldPos = (R * (aPos * aInstanceScale)) + aInstancePos;
 
     gl_Position = uMVP * vec4(worldPos, 0.0, 1.0);
 
@@ -32,6 +36,7 @@ void main()
     if (uFlip.x) uv.x = 1.0 - uv.x;
     if (uFlip.y) uv.y = 1.0 - uv.y;
 
-    vUV    = uUVOffset + uv * uUVScale;
+    vUV    = aInstanceUVRect.xy + (uUVOffset + uv * uUVScale) * aInstanceUVRect.zw;
     vColor = aColor;
+    vAtlasLayer = aInstanceAtlasLayer;
 }
\ No newline at end of file
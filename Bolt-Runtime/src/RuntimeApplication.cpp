@@ -5,6 +5,7 @@
 #include "Systems/ImGuiDebugSystem.hpp"
 #include <Scene/EntityHelper.hpp>
 #include <Serialization/SceneSerializer.hpp>
+#include <Serialization/BinarySceneSerializer.hpp>
 #include <Serialization/Path.hpp>
 #include <Serialization/File.hpp>
 #include <Project/ProjectManager.hpp>
@@ -59,7 +60,8 @@ public:
 			if (project) {
 				std::string scenePath = project->GetSceneFilePath(sceneName);
 				def.OnLoad([scenePath](Scene& scene) {
-					if (File::Exists(scenePath))
+					// Builds may ship only the exported .bscene next to where the .scene would be
+					if (File::Exists(scenePath) || File::Exists(BinarySceneSerializer::GetBinaryPath(scenePath)))
 						SceneSerializer::LoadFromFile(scene, scenePath);
 				});
 			}
@@ -385,13 +385,37 @@ namespace Bolt
 
         // ── Physics2D ───────────────────────────────────────────────────
 
-        internal static bool Physics2D_Raycast(float originX, float originY, float dirX, float dirY, float distance,
+        internal static bool Physics2D_Raycast(float originX, float originY, float dirX, float dirY, float distance, ulong layerMask,
             out ulong hitEntityID, out float hitX, out float hitY, out float hitNormalX, out float hitNormalY)
         {
             ulong eid; float hx, hy, hnx, hny;
-            int result = NativeCallbacks.Bindings.Physics2D_Raycast(originX, originY, dirX, dirY, distance, &eid, &hx, &hy, &hnx, &hny);
+            int result = NativeCallbacks.Bindings.Physics2D_Raycast(originX, originY, dirX, dirY, distance, layerMask, &eid, &hx, &hy, &hnx, &hny);
             hitEntityID = eid; hitX = hx; hitY = hy; hitNormalX = hnx; hitNormalY = hny;
             return result != 0;
         }
+
+        internal static int Physics2D_RaycastBatch(ReadOnlySpan<RaycastCommand2D> commands, ulong layerMask, Span<ulong> hitEntityIDs, Span<float> hitData)
+        {
+            fixed (RaycastCommand2D* commandPtr = commands)
+            fixed (ulong* idPtr = hitEntityIDs)
+            fixed (float* dataPtr = hitData)
+                return NativeCallbacks.Bindings.Physics2D_RaycastBatch((float*)commandPtr, commands.Length, layerMask, idPtr, dataPtr);
+        }
+
+        // ── Component Batches ───────────────────────────────────────────
+
+        internal static int Component_GetFieldBatch(ComponentField field, ReadOnlySpan<ulong> entityIDs, Span<float> outValues)
+        {
+            fixed (ulong* idPtr = entityIDs)
+            fixed (float* valuePtr = outValues)
+                return NativeCallbacks.Bindings.Component_GetFieldBatch((int)field, idPtr, entityIDs.Length, valuePtr);
+        }
+
+        internal static int Component_SetFieldBatch(ComponentField field, ReadOnlySpan<ulong> entityIDs, ReadOnlySpan<float> values)
+        {
+            fixed (ulong* idPtr = entityIDs)
+            fixed (float* valuePtr = values)
+                return NativeCallbacks.Bindings.Component_SetFieldBatch((int)field, idPtr, entityIDs.Length, valuePtr);
+        }
     }
 }
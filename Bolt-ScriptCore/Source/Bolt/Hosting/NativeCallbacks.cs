@@ -179,7 +179,12 @@ namespace Bolt.Hosting
         public delegate* unmanaged<float, void> Gizmo_SetLineWidth;
 
         // ── Physics2D ────────────────────────────────────────────────
-        public delegate* unmanaged<float, float, float, float, float, ulong*, float*, float*, float*, float*, int> Physics2D_Raycast;
+        public delegate* unmanaged<float, float, float, float, float, ulong, ulong*, float*, float*, float*, float*, int> Physics2D_Raycast;
+        public delegate* unmanaged<float*, int, ulong, ulong*, float*, int> Physics2D_RaycastBatch;
+
+        // ── Component Batches ────────────────────────────────────────
+        public delegate* unmanaged<int, ulong*, int, float*, int> Component_GetFieldBatch;
+        public delegate* unmanaged<int, ulong*, int, float*, int> Component_SetFieldBatch;
     }
 
     internal static unsafe class NativeCallbacks
@@ -20,6 +20,8 @@ namespace Bolt.Hosting
         public delegate* unmanaged<int, byte*> GetScriptFields;
         public delegate* unmanaged<int, byte*, byte*, void> SetScriptField;
         public delegate* unmanaged<byte*, byte*> GetClassFieldDefs;
+        public delegate* unmanaged<ScriptInstanceManager.ContactEventNative*, int, void> DispatchContactEvents;
+        public delegate* unmanaged<int*, int, int*, int, void> InvokeUpdateBatch;
     }
 
     /// <summary>
@@ -48,6 +50,8 @@ namespace Bolt.Hosting
                 managedCallbacks->GetScriptFields = &ScriptInstanceManager.GetScriptFields;
                 managedCallbacks->SetScriptField = &ScriptInstanceManager.SetScriptField;
                 managedCallbacks->GetClassFieldDefs = &ScriptInstanceManager.GetClassFieldDefs;
+                managedCallbacks->DispatchContactEvents = &ScriptInstanceManager.DispatchContactEvents;
+                managedCallbacks->InvokeUpdateBatch = &ScriptInstanceManager.InvokeUpdateBatch;
 
                 ScriptInstanceManager.SetCoreAssembly(typeof(ScriptHostBridge).Assembly);
                 return 0;
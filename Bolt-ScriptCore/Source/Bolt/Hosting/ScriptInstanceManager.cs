@@ -113,6 +113,11 @@ namespace Bolt.Hosting
         private static readonly Dictionary<int, ScriptInstanceData> s_Instances = new();
         private static int s_NextHandle = 1;
 
+        // Entity ID -> handles of instances that implement a collision callback
+        private static readonly Dictionary<ulong, List<int>> s_ContactReceivers = new();
+        private static readonly List<int> s_ContactTargets = new();
+        private static readonly object?[] s_ContactArgs = new object?[1];
+
         private static Assembly? s_CoreAssembly;
         private static Assembly? s_UserAssembly;
         private static AssemblyLoadContext? s_UserLoadContext;
@@ -123,7 +128,12 @@ namespace Bolt.Hosting
             public BoltScript Instance;
             public MethodInfo? StartMethod;
             public MethodInfo? UpdateMethod;
+            // Bound once at creation, batched updates call it directly instead of through reflection
+            public Action? UpdateAction;
             public MethodInfo? OnDestroyMethod;
+            public MethodInfo? OnCollisionEnterMethod;
+            public MethodInfo? OnCollisionExitMethod;
+            public MethodInfo? OnCollisionHitMethod;
             public bool HasStarted;
         }
 
@@ -133,6 +143,11 @@ namespace Bolt.Hosting
             public MethodInfo? StartMethod;
             public MethodInfo? UpdateMethod;
             public MethodInfo? OnDestroyMethod;
+            public MethodInfo? OnCollisionEnterMethod;
+            public MethodInfo? OnCollisionExitMethod;
+            public MethodInfo? OnCollisionHitMethod;
+
+            public bool ReceivesContacts => OnCollisionEnterMethod != null || OnCollisionExitMethod != null || OnCollisionHitMethod != null;
         }
 
         internal static void SetCoreAssembly(Assembly assembly)
@@ -176,10 +191,23 @@ namespace Bolt.Hosting
                     Instance = instance,
                     StartMethod = classInfo.StartMethod,
                     UpdateMethod = classInfo.UpdateMethod,
+                    UpdateAction = classInfo.UpdateMethod != null
+                        ? (Action?)Delegate.CreateDelegate(typeof(Action), instance, classInfo.UpdateMethod, throwOnBindFailure: false)
+                        : null,
                     OnDestroyMethod = classInfo.OnDestroyMethod,
+                    OnCollisionEnterMethod = classInfo.OnCollisionEnterMethod,
+                    OnCollisionExitMethod = classInfo.OnCollisionExitMethod,
+                    OnCollisionHitMethod = classInfo.OnCollisionHitMethod,
                     HasStarted = false
                 };
 
+                if (classInfo.ReceivesContacts)
+                {
+                    if (!s_ContactReceivers.TryGetValue(entityID, out var receivers))
+                        s_ContactReceivers[entityID] = receivers = new List<int>();
+                    receivers.Add(handle);
+                }
+
                 return handle;
             }
             catch (Exception ex)
@@ -190,10 +218,19 @@ namespace Bolt.Hosting
         }
 
         [UnmanagedCallersOnly]
-        public static void DestroyScriptInstance(int handle) => s_Instances.Remove(handle);
+        public static void DestroyScriptInstance(int handle)
+        {
+            if (!s_Instances.Remove(handle, out var data)) return;
+
+            ulong entityID = data.Instance.Entity.ID;
+            if (s_ContactReceivers.TryGetValue(entityID, out var receivers) && receivers.Remove(handle) && receivers.Count == 0)
+                s_ContactReceivers.Remove(entityID);
+        }
 
         [UnmanagedCallersOnly]
-        public static void InvokeStart(int handle)
+        public static void InvokeStart(int handle) => RunStart(handle);
+
+        private static void RunStart(int handle)
         {
             if (!s_Instances.TryGetValue(handle, out var data) || data.HasStarted) return;
 
@@ -214,6 +251,30 @@ namespace Bolt.Hosting
             catch (TargetInvocationException ex) { Log.Error($"Exception in Update(): {ex.InnerException}"); }
         }
 
+        /// <summary>
+        /// Runs a whole frame of managed scripts in one transition: Start for every newly created
+        /// instance first, then Update for every active one, both in the order given by native.
+        /// Handles destroyed by an earlier script in the same batch are skipped.
+        /// </summary>
+        [UnmanagedCallersOnly]
+        public static unsafe void InvokeUpdateBatch(int* startHandles, int startCount, int* updateHandles, int updateCount)
+        {
+            for (int i = 0; i < startCount; i++)
+                RunStart(startHandles[i]);
+
+            for (int i = 0; i < updateCount; i++)
+            {
+                if (!s_Instances.TryGetValue(updateHandles[i], out var data)) continue;
+                try
+                {
+                    if (data.UpdateAction != null) data.UpdateAction();
+                    else data.UpdateMethod?.Invoke(data.Instance, null);
+                }
+                catch (TargetInvocationException ex) { Log.Error($"Exception in Update(): {ex.InnerException}"); }
+                catch (Exception ex) { Log.Error($"Exception in Update(): {ex}"); }
+            }
+        }
+
         [UnmanagedCallersOnly]
         public static void InvokeOnDestroy(int handle)
         {
@@ -222,6 +283,75 @@ namespace Bolt.Hosting
             catch (TargetInvocationException ex) { Log.Error($"Exception in OnDestroy(): {ex.InnerException}"); }
         }
 
+        /// <summary>
+        /// Layout must match the C++ ScriptContactEvent struct exactly.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        internal struct ContactEventNative
+        {
+            public ulong EntityA;
+            public ulong EntityB;
+            public float PointX, PointY;
+            public float NormalX, NormalY;
+            public float ApproachSpeed;
+            public int Type;
+        }
+
+        private static readonly Type[] s_CollisionParameter = { typeof(Collision2D) };
+
+        /// <summary>
+        /// Receives every contact of the frame in one call, in simulation order.
+        /// Each side of a contact gets the other entity, the normal always points away from the receiver.
+        /// </summary>
+        [UnmanagedCallersOnly]
+        public static unsafe void DispatchContactEvents(ContactEventNative* events, int count)
+        {
+            if (s_ContactReceivers.Count == 0) return;
+
+            for (int i = 0; i < count; i++)
+            {
+                ref readonly ContactEventNative e = ref events[i];
+                var point = new Vector2(e.PointX, e.PointY);
+                var normal = new Vector2(e.NormalX, e.NormalY);
+
+                DeliverContact(e.EntityA, e.EntityB, e.Type, point, normal, e.ApproachSpeed);
+                DeliverContact(e.EntityB, e.EntityA, e.Type, point, new Vector2(-normal.X, -normal.Y), e.ApproachSpeed);
+            }
+        }
+
+        private static void DeliverContact(ulong receiverID, ulong otherID, int type, Vector2 point, Vector2 normal, float approachSpeed)
+        {
+            if (receiverID == 0 || !s_ContactReceivers.TryGetValue(receiverID, out var receivers)) return;
+
+            // Snapshot, a callback may destroy scripts and change the receiver list
+            s_ContactTargets.Clear();
+            s_ContactTargets.AddRange(receivers);
+
+            s_ContactArgs[0] = new Collision2D
+            {
+                Other = otherID != 0 ? new Entity(otherID) : null,
+                Point = point,
+                Normal = normal,
+                ApproachSpeed = approachSpeed
+            };
+
+            foreach (int handle in s_ContactTargets)
+            {
+                if (!s_Instances.TryGetValue(handle, out var data)) continue;
+
+                MethodInfo? method = type switch
+                {
+                    0 => data.OnCollisionEnterMethod,
+                    1 => data.OnCollisionExitMethod,
+                    _ => data.OnCollisionHitMethod
+                };
+                if (method == null) continue;
+
+                try { method.Invoke(data.Instance, s_ContactArgs); }
+                catch (TargetInvocationException ex) { Log.Error($"Exception in {method.Name}(): {ex.InnerException}"); }
+            }
+        }
+
         [UnmanagedCallersOnly]
         public static unsafe int ClassExists(byte* classNamePtr)
         {
@@ -239,6 +369,7 @@ namespace Bolt.Hosting
                 if (s_UserLoadContext != null)
                 {
                     s_Instances.Clear();
+                    s_ContactReceivers.Clear();
                     s_ClassCache.Clear();
                     UnloadCurrentUserAssemblyContext();
                 }
@@ -266,6 +397,7 @@ namespace Bolt.Hosting
         public static void UnloadUserAssembly()
         {
             s_Instances.Clear();
+            s_ContactReceivers.Clear();
             s_ClassCache.Clear();
 
             UnloadCurrentUserAssemblyContext();
@@ -701,6 +833,9 @@ namespace Bolt.Hosting
                 StartMethod = type.GetMethod("Start", BindingFlags.Public | BindingFlags.Instance, Type.EmptyTypes),
                 UpdateMethod = type.GetMethod("Update", BindingFlags.Public | BindingFlags.Instance, Type.EmptyTypes),
                 OnDestroyMethod = type.GetMethod("OnDestroy", BindingFlags.Public | BindingFlags.Instance, Type.EmptyTypes),
+                OnCollisionEnterMethod = type.GetMethod("OnCollisionEnter2D", BindingFlags.Public | BindingFlags.Instance, s_CollisionParameter),
+                OnCollisionExitMethod = type.GetMethod("OnCollisionExit2D", BindingFlags.Public | BindingFlags.Instance, s_CollisionParameter),
+                OnCollisionHitMethod = type.GetMethod("OnCollisionHit2D", BindingFlags.Public | BindingFlags.Instance, s_CollisionParameter),
             };
 
             s_ClassCache[className] = info;
@@ -1,17 +1,54 @@
+using System;
+using System.Buffers;
+using System.Runtime.InteropServices;
+
 namespace Bolt
 {
+    [StructLayout(LayoutKind.Sequential)]
+    public struct RaycastCommand2D
+    {
+        public Vector2 Origin;
+        public Vector2 Direction;
+        public float MaxDistance;
+
+        public RaycastCommand2D(Vector2 origin, Vector2 direction, float maxDistance = Mathf.Infinity)
+        {
+            Origin = origin;
+            Direction = direction;
+            MaxDistance = maxDistance;
+        }
+    }
+
     public struct RaycastHit2D
     {
         public Entity? Entity;
         public Vector2 Point;
         public Vector2 Normal;
+        /// <summary>Distance from the ray origin to Point.</summary>
+        public float Distance;
         public bool Hit;
     }
 
+    /// <summary>
+    /// Passed to OnCollisionEnter2D / OnCollisionExit2D / OnCollisionHit2D(Collision2D) on a script.
+    /// Point and Normal are unset for exit events, ApproachSpeed is only set for hit events.
+    /// </summary>
+    public struct Collision2D
+    {
+        public Entity? Other;
+        public Vector2 Point;
+        public Vector2 Normal;
+        public float ApproachSpeed;
+    }
+
     public static class Physics2D
     {
+        /// <summary>
+        /// Matches every collision layer. Bit i of a layer mask selects the project collision layer i.
+        /// </summary>
+        public const ulong AllLayers = ulong.MaxValue;
 
-        public static RaycastHit2D Raycast(Vector2 origin, Vector2 direction, float maxDistance = Mathf.Infinity)
+        public static RaycastHit2D Raycast(Vector2 origin, Vector2 direction, float maxDistance = Mathf.Infinity, ulong layerMask = AllLayers)
         {
             RaycastHit2D result = new();
 
@@ -19,6 +56,7 @@ namespace Bolt
                 origin.X, origin.Y,
                 direction.X, direction.Y,
                 maxDistance,
+                layerMask,
                 out ulong hitEntityID,
                 out float hitX, out float hitY,
                 out float hitNormalX, out float hitNormalY
@@ -30,9 +68,55 @@ namespace Bolt
                 result.Entity = new Entity(hitEntityID);
                 result.Point = new Vector2(hitX, hitY);
                 result.Normal = new Vector2(hitNormalX, hitNormalY);
+                result.Distance = Vector2.Distance(origin, result.Point);
             }
 
             return result;
         }
+
+        /// <summary>
+        /// Casts every ray in one native call, the engine spreads them across its worker threads.
+        /// results[i] receives the hit for commands[i]. Returns the number of rays that hit.
+        /// </summary>
+        public static int RaycastBatch(ReadOnlySpan<RaycastCommand2D> commands, Span<RaycastHit2D> results, ulong layerMask = AllLayers)
+        {
+            if (results.Length < commands.Length)
+                throw new ArgumentException("results must be at least as long as commands", nameof(results));
+            if (commands.IsEmpty) return 0;
+
+            ulong[] hitEntityIDs = ArrayPool<ulong>.Shared.Rent(commands.Length);
+            float[] hitData = ArrayPool<float>.Shared.Rent(commands.Length * 5);
+            try
+            {
+                int hitCount = InternalCalls.Physics2D_RaycastBatch(commands, layerMask, hitEntityIDs, hitData);
+
+                for (int i = 0; i < commands.Length; i++)
+                {
+                    ulong entityID = hitEntityIDs[i];
+                    if (entityID == 0)
+                    {
+                        results[i] = default;
+                        continue;
+                    }
+
+                    int offset = i * 5;
+                    results[i] = new RaycastHit2D
+                    {
+                        Hit = true,
+                        Entity = new Entity(entityID),
+                        Point = new Vector2(hitData[offset], hitData[offset + 1]),
+                        Normal = new Vector2(hitData[offset + 2], hitData[offset + 3]),
+                        Distance = hitData[offset + 4]
+                    };
+                }
+
+                return hitCount;
+            }
+            finally
+            {
+                ArrayPool<ulong>.Shared.Return(hitEntityIDs);
+                ArrayPool<float>.Shared.Return(hitData);
+            }
+        }
     }
 }
@@ -1,7 +1,8 @@
 namespace Bolt
 {
     /// <summary>
-    /// Base class for user C# scripts. Subclass and implement Start()/Update()/OnDestroy().
+    /// Base class for user C# scripts. Subclass and implement Start()/Update()/OnDestroy(),
+    /// optionally OnCollisionEnter2D/OnCollisionExit2D/OnCollisionHit2D(Collision2D), delivered before Update.
     /// </summary>
     public abstract class BoltScript
     {
@@ -0,0 +1,87 @@
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+
+namespace Bolt
+{
+    /// <summary>Must match native ScriptComponentField.</summary>
+    internal enum ComponentField
+    {
+        Transform2DPosition = 0,
+        Transform2DRotation,
+        Transform2DScale,
+        SpriteRendererColor,
+        Rigidbody2DLinearVelocity,
+        Rigidbody2DAngularVelocity,
+    }
+
+    /// <summary>
+    /// A fixed set of entities whose component columns are read and written with one native call per column.
+    /// Element i of every span belongs to entity i. Entities missing the component read the same defaults
+    /// as the single property getters and are skipped on write. Get/Set return how many entities had the component.
+    /// </summary>
+    public sealed class EntityBatch
+    {
+        private readonly ulong[] _ids;
+
+        internal EntityBatch(ulong[] ids) { _ids = ids; }
+
+        public static EntityBatch FromEntities(IEnumerable<Entity> entities)
+        {
+            var ids = new List<ulong>();
+            foreach (Entity entity in entities)
+                ids.Add(entity.ID);
+            return new EntityBatch(ids.ToArray());
+        }
+
+        public int Count => _ids.Length;
+        public ReadOnlySpan<ulong> EntityIDs => _ids;
+        public Entity this[int index] => new Entity(_ids[index]);
+
+        // ── Transform2D ────────────────────────────────────────────
+
+        public int GetPositions(Span<Vector2> destination) => Read(ComponentField.Transform2DPosition, MemoryMarshal.Cast<Vector2, float>(destination), 2);
+        public int SetPositions(ReadOnlySpan<Vector2> values) => Write(ComponentField.Transform2DPosition, MemoryMarshal.Cast<Vector2, float>(values), 2);
+        public Vector2[] GetPositions() { var values = new Vector2[Count]; GetPositions(values); return values; }
+
+        public int GetRotations(Span<float> destination) => Read(ComponentField.Transform2DRotation, destination, 1);
+        public int SetRotations(ReadOnlySpan<float> values) => Write(ComponentField.Transform2DRotation, values, 1);
+        public float[] GetRotations() { var values = new float[Count]; GetRotations(values); return values; }
+
+        public int GetScales(Span<Vector2> destination) => Read(ComponentField.Transform2DScale, MemoryMarshal.Cast<Vector2, float>(destination), 2);
+        public int SetScales(ReadOnlySpan<Vector2> values) => Write(ComponentField.Transform2DScale, MemoryMarshal.Cast<Vector2, float>(values), 2);
+        public Vector2[] GetScales() { var values = new Vector2[Count]; GetScales(values); return values; }
+
+        // ── SpriteRenderer ─────────────────────────────────────────
+
+        public int GetColors(Span<Color> destination) => Read(ComponentField.SpriteRendererColor, MemoryMarshal.Cast<Color, float>(destination), 4);
+        public int SetColors(ReadOnlySpan<Color> values) => Write(ComponentField.SpriteRendererColor, MemoryMarshal.Cast<Color, float>(values), 4);
+        public Color[] GetColors() { var values = new Color[Count]; GetColors(values); return values; }
+
+        // ── Rigidbody2D ────────────────────────────────────────────
+
+        public int GetLinearVelocities(Span<Vector2> destination) => Read(ComponentField.Rigidbody2DLinearVelocity, MemoryMarshal.Cast<Vector2, float>(destination), 2);
+        public int SetLinearVelocities(ReadOnlySpan<Vector2> values) => Write(ComponentField.Rigidbody2DLinearVelocity, MemoryMarshal.Cast<Vector2, float>(values), 2);
+        public Vector2[] GetLinearVelocities() { var values = new Vector2[Count]; GetLinearVelocities(values); return values; }
+
+        public int GetAngularVelocities(Span<float> destination) => Read(ComponentField.Rigidbody2DAngularVelocity, destination, 1);
+        public int SetAngularVelocities(ReadOnlySpan<float> values) => Write(ComponentField.Rigidbody2DAngularVelocity, values, 1);
+        public float[] GetAngularVelocities() { var values = new float[Count]; GetAngularVelocities(values); return values; }
+
+        private int Read(ComponentField field, Span<float> destination, int stride)
+        {
+            if (destination.Length < _ids.Length * stride)
+                throw new ArgumentException("destination must hold one value per entity in the batch", nameof(destination));
+            if (_ids.Length == 0) return 0;
+            return InternalCalls.Component_GetFieldBatch(field, _ids, destination);
+        }
+
+        private int Write(ComponentField field, ReadOnlySpan<float> values, int stride)
+        {
+            if (values.Length < _ids.Length * stride)
+                throw new ArgumentException("values must hold one value per entity in the batch", nameof(values));
+            if (_ids.Length == 0) return 0;
+            return InternalCalls.Component_SetFieldBatch(field, _ids, values);
+        }
+    }
+}
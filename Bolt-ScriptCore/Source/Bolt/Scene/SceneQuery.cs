@@ -51,9 +51,15 @@ namespace Bolt
             Span<ulong> buffer = stackalloc ulong[MaxQueryResults];
             int count = InternalCalls.Scene_QueryEntities(queryString, buffer);
             if (count <= 0) return Array.Empty<ulong>();
-            int resultCount = Math.Min(count, MaxQueryResults);
-            ulong[] result = new ulong[resultCount];
-            buffer.Slice(0, resultCount).CopyTo(result);
+            if (count > MaxQueryResults)
+            {
+                // Native reports the full match count, query again straight into a buffer that fits
+                ulong[] all = new ulong[count];
+                int written = Math.Min(InternalCalls.Scene_QueryEntities(queryString, all), count);
+                return written == count ? all : all.AsSpan(0, written).ToArray();
+            }
+            ulong[] result = new ulong[count];
+            buffer.Slice(0, count).CopyTo(result);
             return result;
         }
 
@@ -67,9 +73,16 @@ namespace Bolt
                 withComponents, withoutComponents, mustHaveComponents,
                 enableFilter, buffer);
             if (count <= 0) return Array.Empty<ulong>();
-            int resultCount = Math.Min(count, MaxQueryResults);
-            ulong[] result = new ulong[resultCount];
-            buffer.Slice(0, resultCount).CopyTo(result);
+            if (count > MaxQueryResults)
+            {
+                ulong[] all = new ulong[count];
+                int written = Math.Min(InternalCalls.Scene_QueryEntitiesFiltered(
+                    withComponents, withoutComponents, mustHaveComponents,
+                    enableFilter, all), count);
+                return written == count ? all : all.AsSpan(0, written).ToArray();
+            }
+            ulong[] result = new ulong[count];
+            buffer.Slice(0, count).CopyTo(result);
             return result;
         }
 
@@ -123,6 +136,17 @@ namespace Bolt
             return Scene.ExecuteFilteredQuery(WithNames, WithoutNames, MustHaveNames, EnableFilter);
         }
 
+        internal EntityBatch ToBatch()
+        {
+            ulong[] ids = Execute();
+            if (Conditions == null) return new EntityBatch(ids);
+
+            var passing = new List<ulong>(ids.Length);
+            foreach (ulong id in ids)
+                if (PassesConditions(new Entity(id))) passing.Add(id);
+            return new EntityBatch(passing.ToArray());
+        }
+
         internal bool PassesConditions(Entity entity)
         {
             if (Conditions == null) return true;
@@ -179,6 +203,8 @@ namespace Bolt
 
         public EntityQueryResult<T1> WithEntity() => new EntityQueryResult<T1>(_filter);
 
+        public EntityBatch ToBatch() => _filter.ToBatch();
+
         public IEnumerator<T1> GetEnumerator()
         {
             foreach (ulong id in _filter.Execute())
@@ -254,6 +280,8 @@ namespace Bolt
 
         public EntityQueryResult<T1, T2> WithEntity() => new EntityQueryResult<T1, T2>(_filter);
 
+        public EntityBatch ToBatch() => _filter.ToBatch();
+
         public IEnumerator<(T1, T2)> GetEnumerator()
         {
             foreach (ulong id in _filter.Execute())
@@ -331,6 +359,8 @@ namespace Bolt
 
         public EntityQueryResult<T1, T2, T3> WithEntity() => new EntityQueryResult<T1, T2, T3>(_filter);
 
+        public EntityBatch ToBatch() => _filter.ToBatch();
+
         public IEnumerator<(T1, T2, T3)> GetEnumerator()
         {
             foreach (ulong id in _filter.Execute())
@@ -411,6 +441,8 @@ namespace Bolt
 
         public EntityQueryResult<T1, T2, T3, T4> WithEntity() => new EntityQueryResult<T1, T2, T3, T4>(_filter);
 
+        public EntityBatch ToBatch() => _filter.ToBatch();
+
         public IEnumerator<(T1, T2, T3, T4)> GetEnumerator()
         {
             foreach (ulong id in _filter.Execute())